@@ -1,7 +1,471 @@
 //AUCR.c
 
+/* fileno() is POSIX rather than C, so it is asked for before any header is
+	included, on the hosts where compiled alphabet files are mapped */
+#if ( defined( __unix__ ) || defined( __APPLE__ ) ) && !defined( _POSIX_C_SOURCE )
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include "AUCR.h"
 
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+/* compiled alphabet files are mapped where the host has mmap(), and read elsewhere */
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#define AUCR_MAP_FILES
+#endif
+
+/* the vector kernels check a whole row in a few steps, so there the bound from the
+	block sums costs more than it saves, and rows are only given up on between
+	longer runs of codes */
+#if defined( __AVX2__ ) || defined( __SSE2__ )
+#define AUCR_CHECKPOINT_CODES ( 4 * AUCR_CODE_ROW_ALIGNMENT )
+#else
+#define AUCR_CHECKPOINT_CODES AUCR_CODE_ROW_ALIGNMENT
+#define AUCR_CHECK_BLOCK_BOUND
+#endif
+
+/* snapshots are pinned and unpinned from any thread without a lock, so their
+	reference counts change by atomic adds, which give the new count, and the
+	stores that publish them are ordered by full barriers.  a plain add would
+	lose counts and free snapshots still in use, so there is no fallback. */
+#if defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( __GNUC__ == 4 && __GNUC_MINOR__ >= 1 ) )
+#define AUCR_ATOMIC_ADD( x, n ) __sync_add_and_fetch( &( x ), ( n ) )
+#define AUCR_ATOMIC_BARRIER() __sync_synchronize()
+#else
+#error "AUCR needs an atomic add and a full memory barrier for its publishers and snapshots"
+#endif
+
+/* a publish waiting out readers spins for AUCR_PUBLISH_SPINS barriers, which
+	covers a reader taking its reference, and after that gives up the processor
+	each time, so a reader descheduled mid-pin gets to finish */
+#define AUCR_PUBLISH_SPINS 64
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sched.h>
+#define AUCR_YIELD() sched_yield()
+#else
+#define AUCR_YIELD() AUCR_ATOMIC_BARRIER()
+#endif
+
+/* a compiled alphabet file is a header of AUCR_FILE_FIELDS 32 bit little-endian
+	fields, the last a checksum of the others, followed by the block of the compiled
+	alphabet laid out with 32 bit ints and unicode values and 16 bit shorts, all
+	little-endian.  AUCR_FILE_MAGIC is "AUCR" read as such a field. */
+#define AUCR_FILE_MAGIC 0x52435541UL
+#define AUCR_FILE_VERSION 1
+#define AUCR_FILE_FIELDS 64
+
+/* a positive divisor kept as a multiplier and a shift, so that dividing an int by
+	it takes a multiplication instead of a divide, which many ARM cores lack */
+typedef struct _AUCR_Reciprocal
+{
+	unsigned long int divisor;
+	unsigned long int multiplier;
+	int shift;
+} AUCR_Reciprocal;
+
+/* a slot of an alphabet's block of characters, followed by the character's
+	directional codes and activity measures.  the character comes first, so a
+	character's ptr is also its slot's ptr. */
+typedef struct _AUCR_Slot
+{
+	AUCR_Character character;
+	/* next character of the same class, or NULL if it is the last */
+	AUCR_Character_Ptr next_prototype;
+	/* where the character's ptr is in characters_ptr_ptr */
+	int index;
+	/* copy of the character the last publish shared, holding a reference of its
+		own, or NULL if the character has not been published since it was put in
+		the slot */
+	AUCR_Character_Ptr published;
+} AUCR_Slot;
+
+/* a character of one or more snapshots, followed by its directional codes and
+	activity measures.  the character comes first, as in a slot. */
+typedef struct _AUCR_Shared_Character
+{
+	AUCR_Character character;
+	/* number of snapshots the character is in */
+	volatile int references;
+} AUCR_Shared_Character;
+
+/* sections of a compiled alphabet's block, in the order they are laid out */
+typedef enum _AUCR_Section
+{
+	AUCR_SECTION_CODES,
+	AUCR_SECTION_MEASURES,
+	AUCR_SECTION_UNICODES,
+	AUCR_SECTION_INDICES,
+	AUCR_SECTION_BIAS,
+	AUCR_SECTION_REGIONS,
+	AUCR_SECTION_X,
+	AUCR_SECTION_Y,
+	AUCR_SECTION_TABLE,
+	AUCR_SECTION_SUMS,
+	AUCR_SECTION_COARSE,
+	AUCR_SECTIONS
+} AUCR_Section;
+
+/* fields of a compiled alphabet file's header.  the offset of each section of the
+	block follows AUCR_FIELD_SECTIONS, the fields after them are zero, and the last
+	is the checksum of the header. */
+typedef enum _AUCR_Field
+{
+	AUCR_FIELD_MAGIC,
+	AUCR_FIELD_VERSION,
+	AUCR_FIELD_HEADER_SIZE,
+	AUCR_FIELD_BLOCK_SIZE,
+	AUCR_FIELD_BLOCK_CHECKSUM,
+	AUCR_FIELD_NUM_CHARACTERS,
+	AUCR_FIELD_NUM_DIRECTIONAL_CODES,
+	AUCR_FIELD_NUM_ACTIVITY_REGIONS,
+	AUCR_FIELD_MAPPABLE_DIRECTIONAL_CODES,
+	AUCR_FIELD_DIRECTIONAL_CODE_STRIDE,
+	AUCR_FIELD_ACTIVITY_MEASURE_STRIDE,
+	AUCR_FIELD_BLOCK_SUM_STRIDE,
+	AUCR_FIELD_NUM_COARSE_CODES,
+	AUCR_FIELD_COARSE_CODE_WEIGHT,
+	AUCR_FIELD_COARSE_CODE_STRIDE,
+	AUCR_FIELD_POSITIVE_BEGIN,
+	AUCR_FIELD_NEGATIVE_BEGIN,
+	AUCR_FIELD_POSITIVE_END,
+	AUCR_FIELD_NEGATIVE_END,
+	AUCR_FIELD_BLOCK_CODES,
+	AUCR_FIELD_CODE_TABLE_SLOPES,
+	AUCR_FIELD_SECTIONS
+} AUCR_Field;
+
+
+/* ==============================================
+ STATIC FUNCTION DECLARATIONS
+ ============================================== */
+
+static void AUCR_Reciprocal_Init( int i_divisor, AUCR_Reciprocal * o_reciprocal_ptr );
+
+static int AUCR_Reciprocal_Rounding_Divide( int i_dividend, const AUCR_Reciprocal * i_reciprocal_ptr );
+
+static int AUCR_Scale_Rounding_Divide( long long int i_dividend );
+
+static unsigned long long int AUCR_Square_Scale_Rounding_Divide( unsigned long long int i_dividend );
+
+static int AUCR_Directional_Code_Search(
+										const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+										int i_dx,
+										int i_dy );
+
+static void AUCR_Code_Table_Fill( AUCR_Directional_Code_Map_Ptr io_directional_code_map_ptr );
+
+static void AUCR_Extract_Features(
+								  const AUCR_Coordinate * i_coordinates,
+								  int i_num_directional_codes,
+								  const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+								  int i_num_activity_regions,
+								  const AUCR_Activity_Region * i_activity_regions,
+								  int * io_hits,
+								  int * o_directional_codes,
+								  int * o_activity_measures );
+
+static int AUCR_Directional_Code(
+								 const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+								 int i_dx,
+								 int i_dy );
+
+static void AUCR_Mark_Activity_Regions(
+									   int i_mappable_directional_codes,
+									   int i_num_activity_regions,
+									   const AUCR_Activity_Region * i_activity_regions,
+									   int * io_hits );
+
+static void AUCR_Activity_Measures(
+								   int i_mappable_directional_codes,
+								   int i_num_activity_regions,
+								   const AUCR_Activity_Region * i_activity_regions,
+								   const int * i_hits,
+								   int * o_activity_measures );
+
+static unsigned int AUCR_Segment_Length( int i_from_x, int i_from_y, int i_to_x, int i_to_y );
+
+static int AUCR_Within_Tolerance(
+								 const AUCR_Coordinate * i_start_ptr,
+								 int i_end_x,
+								 int i_end_y,
+								 unsigned int i_length,
+								 const AUCR_Coordinate * i_point_ptr,
+								 int i_tolerance );
+
+static void AUCR_Arc_Lengths(
+							 int i_num_coordinates,
+							 const AUCR_Coordinate * i_coordinates,
+							 unsigned int * o_distances );
+
+static void AUCR_Resample(
+						  int i_num_coordinates,
+						  const AUCR_Coordinate * i_coordinates,
+						  const unsigned int * i_distances,
+						  AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr );
+
+static void AUCR_Resample_Features(
+								   int i_num_coordinates,
+								   const AUCR_Coordinate * i_coordinates,
+								   const unsigned int * i_distances,
+								   int i_num_directional_codes,
+								   const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+								   int i_num_activity_regions,
+								   const AUCR_Activity_Region * i_activity_regions,
+								   int * io_hits,
+								   int * o_directional_codes,
+								   int * o_activity_measures );
+
+static unsigned long int AUCR_Prototype_Difference(
+												   const AUCR_Alphabet * i_alphabet_ptr,
+												   const AUCR_Character * i_character_ptr,
+												   const AUCR_Character * i_prototype_ptr,
+												   unsigned long int i_bound );
+
+static int AUCR_Alphabet_Closest(
+								 const AUCR_Alphabet * i_alphabet_ptr,
+								 const AUCR_Character * i_character_ptr );
+
+static AUCR_Character_Ptr AUCR_Alphabet_Closest_Of_Classes(
+														   const AUCR_Alphabet * i_alphabet_ptr,
+														   const AUCR_Character * i_character_ptr,
+														   const AUCR_Class_Filter * i_filter_ptr );
+
+static AUCR_Error AUCR_Alphabet_Recognize_Path(
+											   int i_num_coordinates,
+											   const AUCR_Coordinate * i_coordinates,
+											   const unsigned int * i_distances,
+											   const AUCR_Alphabet * i_alphabet_ptr,
+											   const AUCR_Class_Filter * i_filter_ptr,
+											   wchar_t * o_unicode_ptr,
+											   AUCR_Workspace_Ptr io_workspace_ptr );
+
+static void AUCR_Alphabet_Scan(
+							   const AUCR_Alphabet * i_alphabet_ptr,
+							   const AUCR_Character * i_character_ptr,
+							   int i_max_candidates,
+							   AUCR_Candidate * io_candidates,
+							   int * io_num_candidates_ptr );
+
+static unsigned long int AUCR_Alphabet_Difference(
+												  const AUCR_Alphabet * i_alphabet_ptr,
+												  const AUCR_Character * i_character_ptr,
+												  int i_index );
+
+static AUCR_Error AUCR_Progressive_Character(
+											 const AUCR_Stroke * i_stroke_ptr,
+											 AUCR_Progressive_Ptr io_progressive_ptr );
+
+static unsigned long int AUCR_Microseconds( void );
+
+static AUCR_Error AUCR_Alphabet_Grow(
+									 int i_num_characters,
+									 AUCR_Alphabet_Ptr io_alphabet_ptr );
+
+static int AUCR_Class_Probe(
+							const AUCR_Class * i_classes,
+							int i_max_classes,
+							wchar_t i_unicode );
+
+static AUCR_Class_Ptr AUCR_Alphabet_Find_Class(
+											   const AUCR_Alphabet * i_alphabet_ptr,
+											   wchar_t i_unicode );
+
+static AUCR_Error AUCR_Alphabet_Add_Class(
+										  wchar_t i_unicode,
+										  AUCR_Alphabet_Ptr io_alphabet_ptr,
+										  AUCR_Class_Ptr * o_class_ptr_ptr );
+
+static void AUCR_Class_Append(
+							  AUCR_Character_Ptr i_character_ptr,
+							  AUCR_Class_Ptr io_class_ptr );
+
+static void AUCR_Alphabet_Swap_Out(
+								   int i_character_number,
+								   AUCR_Alphabet_Ptr io_alphabet_ptr );
+
+static unsigned long AUCR_Round_Up( unsigned long i_value, unsigned long i_multiple );
+
+static unsigned long AUCR_Activity_Difference(
+									int i_activity_measure,
+									int i_prototype_activity_measure,
+									int i_bias );
+
+static unsigned long AUCR_Direction_Difference(
+											   const unsigned char * i_directional_codes,
+											   const unsigned char * i_prototype_directional_codes,
+											   int i_directional_code_stride,
+											   int i_mappable_directional_codes );
+
+static void AUCR_Block_Sums(
+							const unsigned char * i_directional_codes,
+							int i_num_directional_codes,
+							int i_mappable_directional_codes,
+							int * o_block_sums );
+
+#if defined( AUCR_CHECK_BLOCK_BOUND )
+static unsigned long AUCR_Block_Bound(
+									  const int * i_block_sums,
+									  const int * i_prototype_block_sums,
+									  int i_num_blocks );
+#endif
+
+static void AUCR_Coarse_Codes(
+							  const unsigned char * i_directional_codes,
+							  int i_num_directional_codes,
+							  int i_num_coarse_codes,
+							  int i_mappable_directional_codes,
+							  unsigned char * o_coarse_codes );
+
+static int AUCR_Candidate_Precedes(
+								   const AUCR_Candidate * i_first_ptr,
+								   const AUCR_Candidate * i_second_ptr );
+
+static void AUCR_Candidates_Sift_Down(
+									  AUCR_Candidate * io_candidates,
+									  int i_num_candidates,
+									  int i_position );
+
+static void AUCR_Candidates_Offer(
+								  AUCR_Candidate * io_candidates,
+								  int * io_num_candidates_ptr,
+								  int i_max_candidates,
+								  wchar_t i_unicode,
+								  int i_index,
+								  unsigned long int i_difference );
+
+static void AUCR_Candidates_Sort(
+								 AUCR_Candidate * io_candidates,
+								 int i_num_candidates );
+
+static void AUCR_Compiled_Scan(
+							   const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+							   const unsigned char * i_directional_codes,
+							   const int * i_activity_measures,
+							   const int * i_block_sums,
+							   int i_first_row,
+							   int i_stop_row,
+							   int i_max_candidates,
+							   AUCR_Candidate * io_candidates,
+							   int * io_num_candidates_ptr,
+							   AUCR_Statistics * io_statistics_ptr );
+
+static void AUCR_Compiled_Shortlist(
+									const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+									const unsigned char * i_coarse_codes,
+									const int * i_activity_measures,
+									int i_shortlist_size,
+									AUCR_Candidate * io_shortlist,
+									int * io_num_shortlisted_ptr,
+									AUCR_Statistics * io_statistics_ptr );
+
+
+static void AUCR_Compiled_Query(
+								const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+								const AUCR_Coordinate * i_coordinates,
+								int * io_hits,
+								int * o_directional_codes,
+								int * o_activity_measures,
+								unsigned char * o_row,
+								int * o_block_sums );
+
+
+static AUCR_Error AUCR_Workspace_Create(
+										int i_num_directional_codes,
+										int i_num_activity_regions,
+										int i_mappable_directional_codes,
+										AUCR_Workspace_Ptr * o_workspace_ptr_ptr );
+
+static int AUCR_Workspace_Fits(
+							   const AUCR_Workspace * i_workspace_ptr,
+							   int i_num_directional_codes,
+							   int i_num_activity_regions,
+							   int i_mappable_directional_codes );
+
+static unsigned long AUCR_Square_Root_Floor( unsigned long i_number );
+
+static void AUCR_Index_Select(
+							  int * io_rows,
+							  unsigned long * io_distances,
+							  int i_count,
+							  int i_position );
+
+static int AUCR_Index_Build(
+							AUCR_Index_Ptr io_index_ptr,
+							int * io_rows,
+							unsigned long * io_distances,
+							int i_count,
+							int * io_num_nodes_ptr );
+
+static unsigned long AUCR_Index_Bound(
+									  int i_query_low,
+									  int i_query_high,
+									  int i_low,
+									  int i_high );
+
+static void AUCR_Index_Search(
+							  const AUCR_Index * i_index_ptr,
+							  int i_node,
+							  const unsigned char * i_directional_codes,
+							  const int * i_activity_measures,
+							  int i_max_candidates,
+							  AUCR_Candidate * io_candidates,
+							  int * io_num_candidates_ptr );
+
+static AUCR_Character_Ptr AUCR_Character_Share( AUCR_Character_Ptr io_character_ptr );
+
+static void AUCR_Character_Unshare( AUCR_Character_Ptr io_character_ptr );
+
+static void AUCR_Put_Le32( unsigned long i_value, unsigned char * o_bytes );
+
+static unsigned long AUCR_Get_Le32( const unsigned char * i_bytes );
+
+static int AUCR_Le32_To_Int( unsigned long i_value );
+
+static unsigned long AUCR_Checksum( const unsigned char * i_bytes, unsigned long i_length );
+
+static int AUCR_Host_Reads_Files( void );
+
+static void AUCR_Compiled_Shape( AUCR_Compiled_Alphabet_Ptr io_compiled_alphabet_ptr );
+
+static unsigned long AUCR_Compiled_Layout(
+										  const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+										  int i_mappable_directional_codes,
+										  unsigned long i_int_size,
+										  unsigned long i_short_size,
+										  unsigned long i_wchar_size,
+										  unsigned long * o_offsets );
+
+static void AUCR_Compiled_Point(
+								unsigned char * i_base,
+								const unsigned long * i_offsets,
+								AUCR_Compiled_Alphabet_Ptr io_compiled_alphabet_ptr );
+
+static void AUCR_Convert_Ints(
+							  int * io_ints,
+							  unsigned long i_num_ints,
+							  unsigned char * io_bytes,
+							  int i_to_file );
+
+static void AUCR_Compiled_Convert(
+								  AUCR_Compiled_Alphabet_Ptr io_compiled_alphabet_ptr,
+								  unsigned char * io_file_block,
+								  const unsigned long * i_file_offsets,
+								  int i_to_file );
+
+static AUCR_Error AUCR_Compiled_Verify( const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr );
+
+static AUCR_Error AUCR_Alphabet_From_Compiled(
+											  const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+											  AUCR_Alphabet_Ptr * o_alphabet_ptr_ptr );
+
 
 /* ==============================================
  FUNCTION IMPLEMENTATIONS
@@ -127,1066 +591,8432 @@ void AUCR_CHARACTER_Release(
 
 /*
  *	Name:
- *		AUCR_CHARACTER_From_Interpolated()
+ *		AUCR_Round_Up()
  *	Description:
- *		takes in an interpolated character and an alphabet and forms the character
- *		representation of the interpolated character based on the alphabet.
+ *		rounds a non-negative integer up to the next multiple of another
  *	Parameters:
- *		i_interpolated_character_ptr -> a pointer to an interpolated character
- *		i_alphabet_ptr -> a pointer to an alphabet
- *		io_character_ptr <-> a pointer to a character that we will fill in
+ *		i_value -> the integer to round up
+ *		i_multiple -> the positive integer to round up to a multiple of
  *	Preconditions:
- *		i_interpolated_character_ptr is non NULL and is a pointer to a valid
- *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
- *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
- *		character, num_directional_codes between the alphabet and the interpolated
- *		are in agreement
+ *		i_value is non-negative and i_multiple is positive
  *	Postconditions:
- *		io_character_ptr is populated with the character version of the
- *		interpolated character
+ *		nothing has changed
  *	Returns:
- *		AUCR_ERR_SUCCESS
- *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
- *													num_directional_codes are met
+ *		the smallest multiple of i_multiple that is not less than i_value
  */
-AUCR_Error AUCR_CHARACTER_From_Interpolated(
-											AUCR_Interpolated_Character_Ptr i_interpolated_character_ptr,
-											AUCR_Alphabet_Ptr i_alphabet_ptr,
-											AUCR_Character_Ptr io_character_ptr )
+static unsigned long AUCR_Round_Up( unsigned long i_value, unsigned long i_multiple )
+{
+	return( ( ( i_value + i_multiple - 1 ) / i_multiple ) * i_multiple );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Activity_Difference()
+ *	Description:
+ *		finds the biased, squared difference between two activity measures,
+ *		rounded as AUCR_Rounding_Divide() rounds.  it is found in 64 bit arithmetic,
+ *		so it never wraps around to a smaller difference however far apart the
+ *		measures are, and is held to AUCR_ACTIVITY_DIFFERENCE_LIMIT.  a region of
+ *		negative bias adds nothing.  every recognizer adds its activity differences
+ *		up with this, so they always agree, and a partial sum of differences is
+ *		never more than the whole.
+ *	Parameters:
+ *		i_activity_measure -> activity measure of the character being recognized
+ *		i_prototype_activity_measure -> activity measure of the character in the alphabet
+ *		i_bias -> the bias of the activity region the measures are from
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the difference, no more than AUCR_ACTIVITY_DIFFERENCE_LIMIT
+ */
+static unsigned long AUCR_Activity_Difference(
+									int i_activity_measure,
+									int i_prototype_activity_measure,
+									int i_bias )
 {
 	//local variables
-	int i, j;
-	int code, dx, dy, begin, end, max;
-	int * hits;
+	unsigned long long int delta, square, whole;
 	
-	//check for valid input
-	if( i_interpolated_character_ptr == NULL ||
-	   i_alphabet_ptr == NULL || io_character_ptr == NULL )
+	if( i_bias <= 0 )
 	{
-		return( AUCR_ERR_FAILED );
-	}
-	else if( i_interpolated_character_ptr->num_directional_codes
-			!= i_alphabet_ptr->num_directional_codes ||
-			i_interpolated_character_ptr->num_directional_codes
-			!= io_character_ptr->num_directional_codes ||
-			io_character_ptr->num_directional_codes
-			!= i_alphabet_ptr->num_directional_codes )
-	{
-		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		return( 0 );
 	}
 	
-	hits = (int *)malloc( sizeof( int ) * 
-						 ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ) );
-	if( hits == NULL )
+	//two ints are less than 2^32 apart, so the square fits in 64 bits
+	delta = ( i_activity_measure < i_prototype_activity_measure ) ?
+	(unsigned long long int)( (long long int)i_prototype_activity_measure - i_activity_measure ) :
+	(unsigned long long int)( (long long int)i_activity_measure - i_prototype_activity_measure );
+	square = delta * delta;
+	
+	//split the square at AUCR_SCALE * AUCR_SCALE, so that the bias multiplies the
+	//whole part and the remainder each without wrapping
+	whole = square / ( AUCR_SCALE * AUCR_SCALE );
+	if( whole > AUCR_ACTIVITY_DIFFERENCE_LIMIT / (unsigned long long int)i_bias )
 	{
-		return( AUCR_ERR_NO_MEMORY );
+		return( AUCR_ACTIVITY_DIFFERENCE_LIMIT );
 	}
+	whole = ( whole * i_bias ) +
+	AUCR_Square_Scale_Rounding_Divide( ( square - ( whole * ( AUCR_SCALE * AUCR_SCALE ) ) ) *
+									  (unsigned long long int)i_bias );
 	
-	//find all directional codes
-	for( i = 0; i < i_alphabet_ptr->num_directional_codes; i++ )
+	return( ( whole > AUCR_ACTIVITY_DIFFERENCE_LIMIT ) ?
+		   AUCR_ACTIVITY_DIFFERENCE_LIMIT : (unsigned long)whole );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Direction_Difference()
+ *	Description:
+ *		finds the sum of the squared circular distances between two rows of
+ *		packed directional codes.  the distance between two codes is the smaller
+ *		of their absolute difference and mappable_directional_codes minus it, which
+ *		is found for a whole vector of codes at once with a saturating subtract each
+ *		way, a subtract from mappable_directional_codes, and a byte minimum.  AVX2
+ *		handles 32 codes per step, SSE2 16, and other processors one at a time.
+ *	Parameters:
+ *		i_directional_codes -> first row of codes
+ *		i_prototype_directional_codes -> second row of codes, aligned to
+ *							AUCR_CODE_ROW_ALIGNMENT bytes
+ *		i_directional_code_stride -> number of bytes in each row, a multiple of
+ *							AUCR_CODE_ROW_ALIGNMENT
+ *		i_mappable_directional_codes -> number of unique directional codes, no more than 256
+ *	Preconditions:
+ *		both rows have i_directional_code_stride codes, each less than
+ *		i_mappable_directional_codes, and any padding codes past num_directional_codes
+ *		are zero in both rows
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		sum of the squared circular distances, not yet multiplied by AUCR_SCALE
+ */
+static unsigned long AUCR_Direction_Difference(
+											   const unsigned char * i_directional_codes,
+											   const unsigned char * i_prototype_directional_codes,
+											   int i_directional_code_stride,
+											   int i_mappable_directional_codes )
+{
+#if defined( __AVX2__ )
+	//local variables
+	int j;
+	__m256i a, b, delta, wrapped, zero, sum, lanes;
+	__m128i half;
+	
+	zero = _mm256_setzero_si256();
+	sum = _mm256_setzero_si256();
+	//256 codes wraps to 0 in a byte, which still gives 256 - delta
+	lanes = _mm256_set1_epi8( (char)i_mappable_directional_codes );
+	
+	for( j = 0; j < i_directional_code_stride; j += 32 )
 	{
-		//intialize code to invalid value
-		code = -1;
-		
-		//find change in x
-		dx = i_interpolated_character_ptr->coordinates[i + 1].x -
-		i_interpolated_character_ptr->coordinates[i].x;
-		//find change in y
-		dy = i_interpolated_character_ptr->coordinates[i + 1].y -
-		i_interpolated_character_ptr->coordinates[i].y;
-		
-		//setup for search in right halfplane
-		if( dx > 0 )
-		{
-			if( i_alphabet_ptr->directional_code_map_ptr->positive_begin == -1 )
-			{
-				code = i_alphabet_ptr->directional_code_map_ptr->negative_end;
-			}
-			begin = i_alphabet_ptr->directional_code_map_ptr->positive_begin;
-			end = i_alphabet_ptr->directional_code_map_ptr->positive_end;
-		}
-		//setup for search in left halfplane
-		else
-		{
-			if( i_alphabet_ptr->directional_code_map_ptr->negative_begin == -1 )
-			{
-				code = i_alphabet_ptr->directional_code_map_ptr->positive_end;
-			}
-			begin = i_alphabet_ptr->directional_code_map_ptr->negative_begin;
-			end = i_alphabet_ptr->directional_code_map_ptr->negative_end;
-		}
-		
-		if( code == -1 )
-		{
-			//start at the directional code that begins the quadrant, and advance thru the directional
-			//codes until you find one that has slope greater than the slope of the present vector,
-			//or until you reach the end of the quadrant
-			for ( j = begin; j != (( end + 1 ) %
-								   ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ) );
-				 j = (( j + 1 ) %
-					  ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ) ) )
-			{
-				if ( dy * i_alphabet_ptr->directional_code_map_ptr->x[j] <
-					dx * i_alphabet_ptr->directional_code_map_ptr->y[j] )
-				{
-					code =
-					( ( j + i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes - 1 ) %
-					 ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ) );
-					break;
-				}
-			}
-		}
-		
-		//if for loop went until the end of the quadrant,
-		//point must be in the last area of the quadrant
-		if ( code == -1 )
-		{
-			code = end;
-		}
-		//direction is now in code
-		
-		//store directional code i
-		io_character_ptr->directional_codes[i] = code;
+		a = _mm256_loadu_si256( (const __m256i *)( i_directional_codes + j ) );
+		b = _mm256_load_si256( (const __m256i *)( i_prototype_directional_codes + j ) );
+		//absolute difference, then the shorter way around the circle of directions
+		delta = _mm256_or_si256( _mm256_subs_epu8( a, b ), _mm256_subs_epu8( b, a ) );
+		wrapped = _mm256_sub_epi8( lanes, delta );
+		delta = _mm256_min_epu8( delta, wrapped );
+		//widen to 16 bits and square, adding pairs of squares into 32 bits
+		a = _mm256_unpacklo_epi8( delta, zero );
+		b = _mm256_unpackhi_epi8( delta, zero );
+		sum = _mm256_add_epi32( sum, _mm256_madd_epi16( a, a ) );
+		sum = _mm256_add_epi32( sum, _mm256_madd_epi16( b, b ) );
 	}
 	
-	//zero out counts for all directions
-	for( i = 0; i < 
-		i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes; i++ )
+	//add the eight 32 bit sums together
+	half = _mm_add_epi32( _mm256_castsi256_si128( sum ), _mm256_extracti128_si256( sum, 1 ) );
+	half = _mm_add_epi32( half, _mm_shuffle_epi32( half, 0x4E ) );
+	half = _mm_add_epi32( half, _mm_shuffle_epi32( half, 0xB1 ) );
+	
+	return( (unsigned long)(unsigned int)_mm_cvtsi128_si32( half ) );
+#elif defined( __SSE2__ )
+	//local variables
+	int j;
+	__m128i a, b, delta, wrapped, zero, sum, lanes;
+	
+	zero = _mm_setzero_si128();
+	sum = _mm_setzero_si128();
+	//256 codes wraps to 0 in a byte, which still gives 256 - delta
+	lanes = _mm_set1_epi8( (char)i_mappable_directional_codes );
+	
+	for( j = 0; j < i_directional_code_stride; j += 16 )
 	{
-		hits[i] = 0;
+		a = _mm_loadu_si128( (const __m128i *)( i_directional_codes + j ) );
+		b = _mm_load_si128( (const __m128i *)( i_prototype_directional_codes + j ) );
+		//absolute difference, then the shorter way around the circle of directions
+		delta = _mm_or_si128( _mm_subs_epu8( a, b ), _mm_subs_epu8( b, a ) );
+		wrapped = _mm_sub_epi8( lanes, delta );
+		delta = _mm_min_epu8( delta, wrapped );
+		//widen to 16 bits and square, adding pairs of squares into 32 bits
+		a = _mm_unpacklo_epi8( delta, zero );
+		b = _mm_unpackhi_epi8( delta, zero );
+		sum = _mm_add_epi32( sum, _mm_madd_epi16( a, a ) );
+		sum = _mm_add_epi32( sum, _mm_madd_epi16( b, b ) );
 	}
-	//find activity for all regions
-	for( i = 0; i < i_alphabet_ptr->num_activity_regions; i++ )
+	
+	//add the four 32 bit sums together
+	sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, 0x4E ) );
+	sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, 0xB1 ) );
+	
+	return( (unsigned long)(unsigned int)_mm_cvtsi128_si32( sum ) );
+#else
+	//local variables
+	int j;
+	unsigned int delta;
+	unsigned long difference = 0;
+	
+	for( j = 0; j < i_directional_code_stride; j++ )
 	{
-		for( j = i_alphabet_ptr->activity_regions[i].start;
-			j <= i_alphabet_ptr->activity_regions[i].stop; j++ )
-		{
-			hits[io_character_ptr->directional_codes[j]]++;
-		}
-		max = 0;
-		for( j = 0; j < 
-			i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes; j++ )
+		delta = (unsigned int)( ( i_directional_codes[j] < i_prototype_directional_codes[j] ) ?
+							   ( i_prototype_directional_codes[j] - i_directional_codes[j] ) :
+							   ( i_directional_codes[j] - i_prototype_directional_codes[j] ) );
+		//take the shorter way around the circle of directions
+		if( ( (unsigned int)i_mappable_directional_codes - delta ) < delta )
 		{
-			if( hits[j] > max )
-			{
-				max = hits[j];
-			}
-			hits[j] = 0;
+			delta = (unsigned int)i_mappable_directional_codes - delta;
 		}
-		io_character_ptr->activity_measures[i] =
-		AUCR_Rounding_Divide( ( AUCR_SCALE *
-							   ( 1 + i_alphabet_ptr->activity_regions[i].stop 
-								- i_alphabet_ptr->activity_regions[i].start ) ),
-							 ( max ) );
+		difference += delta * delta;
 	}
 	
-	free( hits );
-	
-	return( AUCR_ERR_SUCCESS );
+	return( difference );
+#endif
 }
 
 
 /*
  *	Name:
- *		AUCR_INTERPOLATED_CHARACTER_Init()
+ *		AUCR_Block_Sums()
  *	Description:
- *		Initializes a new AUCR_Interpolated_Character instance by allocating appropriate
- *		memories and setting member values.
+ *		sums, for each block of AUCR_BLOCK_CODES consecutive directional codes, their
+ *		circular distances from code 0 and separately from the code a quarter of the
+ *		way around.  the distance from a fixed code changes by no more than the
+ *		distance between two codes, so two rows whose block sums differ by s have
+ *		directional codes in that block at least s apart in total.
  *	Parameters:
- *		i_unicode -> the unicode value to be represented by the structure.
- *		i_num_directional_codes -> (i_num_directional_codes + 1) elements of the
- *							coordinates vector must have memory allocated.
- *		o_interpolated_character_ptr_ptr <- address of the AUCR_Interpolated_Character_Ptr
- *							to be populated with the new AUCR_Interpolated_Character.
+ *		i_directional_codes -> packed row of directional codes, zero padded to a
+ *							multiple of AUCR_BLOCK_CODES
+ *		i_num_directional_codes -> number of directional codes in the row
+ *		i_mappable_directional_codes -> number of unique directional codes
+ *		o_block_sums <- array of twice the number of blocks ints to fill in, the
+ *							sums from code 0 first
  *	Preconditions:
- *		i_num_directional_codes must be positive and non-zero.  i_unicode should not be
- *		0x0000 which is reserved as an error character.  The AUCR_Interpolated_Character_Ptr
- *		at o_interpolated_character_ptr_ptr must be NULL.
+ *		all pointers are valid and all arrays are of the sizes given above
  *	Postconditions:
- *		o_character_ptr_Ptr is the address of a newly allocated and initialized
- *		AUCR_Interpolated_Character_Ptr.  Its coordinates is a new array of
- *		(num_directional_codes + 1) "AUCR_Coordinate"s.
+ *		o_block_sums is filled in
  *	Returns:
- *		AUCR_ERR_SUCCESS
- *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		none
  */
-AUCR_Error AUCR_INTERPOLATED_CHARACTER_Init(
-											wchar_t i_unicode,
-											int i_num_directional_codes,
-											AUCR_Interpolated_Character_Ptr * o_interpolated_character_ptr_ptr )
+static void AUCR_Block_Sums(
+							const unsigned char * i_directional_codes,
+							int i_num_directional_codes,
+							int i_mappable_directional_codes,
+							int * o_block_sums )
 {
-	//check for valid input
-	if( ( i_unicode == 0x0000 ) || ( i_num_directional_codes < 1 ) ||
-	   ( o_interpolated_character_ptr_ptr == NULL ) ||
-	   ( ( * o_interpolated_character_ptr_ptr ) != NULL ) )
-	{
-		return( AUCR_ERR_FAILED );
-	}
+	//local variables
+	int i, block, num_blocks, code, quarter, distance;
 	
-	//malloc memory for character struct
-	( * o_interpolated_character_ptr_ptr ) = 
-	( AUCR_Interpolated_Character_Ptr )malloc( sizeof( AUCR_Interpolated_Character ) );
-	if( ( * o_interpolated_character_ptr_ptr ) == NULL )
+	num_blocks = ( i_num_directional_codes + AUCR_BLOCK_CODES - 1 ) / AUCR_BLOCK_CODES;
+	quarter = i_mappable_directional_codes / 4;
+	
+	for( block = 0; block < 2 * num_blocks; block++ )
 	{
-		return( AUCR_ERR_NO_MEMORY );
+		o_block_sums[block] = 0;
 	}
 	
-	//malloc memory for coordinates
-	( * o_interpolated_character_ptr_ptr )->coordinates = 
-	( AUCR_Coordinate_Ptr )malloc( (i_num_directional_codes + 1 ) 
-								  * sizeof( AUCR_Coordinate ) );
-	if( ( * o_interpolated_character_ptr_ptr )->coordinates == NULL )
+	//padding codes are zero in every row, so they add the same to every sum
+	for( i = 0; i < num_blocks * AUCR_BLOCK_CODES; i++ )
 	{
-		free( * o_interpolated_character_ptr_ptr );
-		return( AUCR_ERR_NO_MEMORY );
+		code = i_directional_codes[i];
+		block = i / AUCR_BLOCK_CODES;
+		
+		//circular distance from code 0
+		distance = code;
+		o_block_sums[block] += ( distance < i_mappable_directional_codes - distance ) ?
+		distance : ( i_mappable_directional_codes - distance );
+		
+		//circular distance from the code a quarter of the way around
+		distance = ( code < quarter ) ? ( quarter - code ) : ( code - quarter );
+		o_block_sums[num_blocks + block] += ( distance < i_mappable_directional_codes - distance ) ?
+		distance : ( i_mappable_directional_codes - distance );
 	}
 	
-	//memory allocations successful
-	//now fill in fields
-	( * o_interpolated_character_ptr_ptr )->unicode = i_unicode;
-	( * o_interpolated_character_ptr_ptr )->num_directional_codes = 
-	i_num_directional_codes;
-	
-	//return success
-	return( AUCR_ERR_SUCCESS );
+	return;
 }
 
 
+#if defined( AUCR_CHECK_BLOCK_BOUND )
 /*
  *	Name:
- *		AUCR_INTERPOLATED_CHARACTER_Release()
+ *		AUCR_Block_Bound()
  *	Description:
- *		Frees all dynamically allocated memories for the AUCR_Interpolated_Character and NULLs
- *		the AUCR_Interpolated_Character_Ptr.
+ *		finds a lower bound on the sum of the squared circular distances between two
+ *		rows of directional codes from their block sums.  the codes of a block are at
+ *		least s apart in total, where s is the larger difference of its two sums, and
+ *		AUCR_BLOCK_CODES distances that add up to s have squares adding up to at
+ *		least s * s / AUCR_BLOCK_CODES.
  *	Parameters:
- *		io__interpolatedcharacter_ptr <-> address of the AUCR_Interpolated_Character memory to be freed.
+ *		i_block_sums -> block sums of the first row
+ *		i_prototype_block_sums -> block sums of the second row
+ *		i_num_blocks -> number of blocks in each row
+ *	Preconditions:
+ *		both arrays have 2 * i_num_blocks sums, made by AUCR_Block_Sums()
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the bound, not yet multiplied by AUCR_SCALE
+ */
+static unsigned long AUCR_Block_Bound(
+									  const int * i_block_sums,
+									  const int * i_prototype_block_sums,
+									  int i_num_blocks )
+{
+	//local variables
+	int block, first, second;
+	unsigned long bound = 0;
+	
+	for( block = 0; block < i_num_blocks; block++ )
+	{
+		first = i_block_sums[block] - i_prototype_block_sums[block];
+		first = ( first < 0 ) ? -first : first;
+		second = i_block_sums[i_num_blocks + block] - i_prototype_block_sums[i_num_blocks + block];
+		second = ( second < 0 ) ? -second : second;
+		if( second > first )
+		{
+			first = second;
+		}
+		
+		//the squares are whole, so round up
+		bound += ( (unsigned long)( first * first ) + AUCR_BLOCK_CODES - 1 ) / AUCR_BLOCK_CODES;
+	}
+	
+	return( bound );
+}
+#endif
+
+
+/*
+ *	Name:
+ *		AUCR_Coarse_Codes()
+ *	Description:
+ *		finds the coarse codes of a row of directional codes.  the codes are split
+ *		into i_num_coarse_codes runs as even as can be, and each coarse code is the
+ *		mean of its run, taking each code the shorter way around the circle of
+ *		directions from the first code of the run.
+ *	Parameters:
+ *		i_directional_codes -> row of directional codes
+ *		i_num_directional_codes -> number of directional codes in the row
+ *		i_num_coarse_codes -> number of coarse codes to find, no more than
+ *							i_num_directional_codes
+ *		i_mappable_directional_codes -> number of unique directional codes
+ *		o_coarse_codes <- array of i_num_coarse_codes bytes to fill in
+ *	Preconditions:
+ *		all pointers are valid and all arrays are of the sizes given above
+ *	Postconditions:
+ *		o_coarse_codes is filled in
+ *	Returns:
+ *		none
+ */
+static void AUCR_Coarse_Codes(
+							  const unsigned char * i_directional_codes,
+							  int i_num_directional_codes,
+							  int i_num_coarse_codes,
+							  int i_mappable_directional_codes,
+							  unsigned char * o_coarse_codes )
+{
+	//local variables
+	int i, j, begin, end, first, delta, offset;
+	
+	for( i = 0; i < i_num_coarse_codes; i++ )
+	{
+		begin = ( i * i_num_directional_codes ) / i_num_coarse_codes;
+		end = ( ( i + 1 ) * i_num_directional_codes ) / i_num_coarse_codes;
+		first = i_directional_codes[begin];
+		
+		//add up how far each code of the run turns from its first code
+		offset = 0;
+		for( j = begin + 1; j < end; j++ )
+		{
+			delta = i_directional_codes[j] - first;
+			if( 2 * delta > i_mappable_directional_codes )
+			{
+				delta -= i_mappable_directional_codes;
+			}
+			else if( 2 * delta <= -i_mappable_directional_codes )
+			{
+				delta += i_mappable_directional_codes;
+			}
+			offset += delta;
+		}
+		
+		o_coarse_codes[i] = (unsigned char)( ( first + AUCR_Rounding_Divide( offset, end - begin ) +
+											  i_mappable_directional_codes ) % i_mappable_directional_codes );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Candidate_Precedes()
+ *	Description:
+ *		orders candidates by difference, breaking ties by the lower index, which
+ *		is the order in which the recognizers prefer them
+ *	Parameters:
+ *		i_first_ptr -> first candidate
+ *		i_second_ptr -> second candidate
+ *	Preconditions:
+ *		both pointers are valid
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		non-zero if the first candidate is closer than the second, zero otherwise
+ */
+static int AUCR_Candidate_Precedes(
+								   const AUCR_Candidate * i_first_ptr,
+								   const AUCR_Candidate * i_second_ptr )
+{
+	return( ( i_first_ptr->difference < i_second_ptr->difference ) ||
+		   ( ( i_first_ptr->difference == i_second_ptr->difference ) &&
+			( i_first_ptr->index < i_second_ptr->index ) ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Candidates_Sift_Down()
+ *	Description:
+ *		moves the candidate at the given position of a max-heap down until
+ *		neither of its children is farther than it
+ *	Parameters:
+ *		io_candidates <-> array of candidates kept as a max-heap, farthest first
+ *		i_num_candidates -> number of candidates in the heap
+ *		i_position -> position of the candidate to move down
+ *	Preconditions:
+ *		both subtrees of i_position are already heaps
+ *	Postconditions:
+ *		the subtree at i_position is a heap
+ *	Returns:
+ *		none
+ */
+static void AUCR_Candidates_Sift_Down(
+									  AUCR_Candidate * io_candidates,
+									  int i_num_candidates,
+									  int i_position )
+{
+	//local variables
+	int child;
+	AUCR_Candidate tempcandidate;
+	
+	tempcandidate = io_candidates[i_position];
+	
+	while( ( child = ( 2 * i_position ) + 1 ) < i_num_candidates )
+	{
+		//pick the farther of the two children
+		if( ( child + 1 ) < i_num_candidates &&
+		   AUCR_Candidate_Precedes( &( io_candidates[child] ), &( io_candidates[child + 1] ) ) )
+		{
+			child++;
+		}
+		if( !AUCR_Candidate_Precedes( &tempcandidate, &( io_candidates[child] ) ) )
+		{
+			break;
+		}
+		io_candidates[i_position] = io_candidates[child];
+		i_position = child;
+	}
+	io_candidates[i_position] = tempcandidate;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Candidates_Offer()
+ *	Description:
+ *		adds a candidate to a bounded max-heap of the closest candidates found so far.
+ *		while the heap is not yet full the candidate is always added, afterwards it
+ *		replaces the farthest candidate only if it is closer than it.
+ *	Parameters:
+ *		io_candidates <-> array of i_max_candidates candidates kept as a max-heap
+ *		io_num_candidates_ptr <-> number of candidates in the heap
+ *		i_max_candidates -> number of candidates the heap may hold
+ *		i_unicode -> unicode value of the new candidate
+ *		i_index -> index of the new candidate in its alphabet
+ *		i_difference -> difference of the new candidate
+ *	Preconditions:
+ *		i_max_candidates is positive and io_candidates is a valid heap
+ *	Postconditions:
+ *		io_candidates holds the closest of its old candidates and the new one
+ *	Returns:
+ *		none
+ */
+static void AUCR_Candidates_Offer(
+								  AUCR_Candidate * io_candidates,
+								  int * io_num_candidates_ptr,
+								  int i_max_candidates,
+								  wchar_t i_unicode,
+								  int i_index,
+								  unsigned long int i_difference )
+{
+	//local variables
+	int position, parent;
+	AUCR_Candidate tempcandidate;
+	
+	tempcandidate.unicode = i_unicode;
+	tempcandidate.index = i_index;
+	tempcandidate.difference = i_difference;
+	
+	if( ( *io_num_candidates_ptr ) < i_max_candidates )
+	{
+		//heap is not full, so move the new candidate up from the bottom
+		position = ( *io_num_candidates_ptr )++;
+		while( position > 0 )
+		{
+			parent = ( position - 1 ) / 2;
+			if( !AUCR_Candidate_Precedes( &( io_candidates[parent] ), &tempcandidate ) )
+			{
+				break;
+			}
+			io_candidates[position] = io_candidates[parent];
+			position = parent;
+		}
+		io_candidates[position] = tempcandidate;
+	}
+	else if( AUCR_Candidate_Precedes( &tempcandidate, &( io_candidates[0] ) ) )
+	{
+		//replace the farthest candidate
+		io_candidates[0] = tempcandidate;
+		AUCR_Candidates_Sift_Down( io_candidates, ( *io_num_candidates_ptr ), 0 );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Candidates_Sort()
+ *	Description:
+ *		turns a max-heap of candidates into an array sorted closest first
+ *	Parameters:
+ *		io_candidates <-> array of candidates kept as a max-heap
+ *		i_num_candidates -> number of candidates in the heap
+ *	Preconditions:
+ *		io_candidates is a valid heap
+ *	Postconditions:
+ *		io_candidates is sorted closest first
+ *	Returns:
+ *		none
+ */
+static void AUCR_Candidates_Sort(
+								 AUCR_Candidate * io_candidates,
+								 int i_num_candidates )
+{
+	//local variables
+	AUCR_Candidate tempcandidate;
+	
+	//repeatedly move the farthest remaining candidate to the end
+	while( i_num_candidates > 1 )
+	{
+		i_num_candidates--;
+		tempcandidate = io_candidates[0];
+		io_candidates[0] = io_candidates[i_num_candidates];
+		io_candidates[i_num_candidates] = tempcandidate;
+		AUCR_Candidates_Sift_Down( io_candidates, i_num_candidates, 0 );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Scan()
+ *	Description:
+ *		finds the rows in a range of the compiled alphabet that are closest to the
+ *		packed directional codes and activity measures given, keeping them in a bounded
+ *		max-heap of candidates.  scanning consecutive ranges into the same heap gives
+ *		the same candidates as scanning them all at once.  once the heap is full, each
+ *		row goes through a cascade of checks, each dearer and closer than the last,
+ *		and is dropped at the first one that is already farther than the farthest
+ *		candidate: its activity measure difference alone, then that plus the bound
+ *		from its block sums where there are no vector kernels, then that plus its
+ *		directional code differences so far, checked every AUCR_CHECKPOINT_CODES
+ *		codes.  every check is a lower bound on
+ *		the row's difference, so with one candidate, rows are scored, skipped and tie
+ *		broken exactly as AUCR_ALPHABET_Recognize_From_Interpolated() does.
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to scan
+ *		i_directional_codes -> packed directional codes of the character being recognized
+ *		i_activity_measures -> activity measures of the character being recognized
+ *		i_block_sums -> block sums of the character being recognized
+ *		i_first_row -> first row to check
+ *		i_stop_row -> row after the last row to check
+ *		i_max_candidates -> number of candidates the heap may hold
+ *		io_candidates <-> array of i_max_candidates candidates kept as a max-heap
+ *		io_num_candidates_ptr <-> number of candidates in the heap
+ *		io_statistics_ptr <-> counts of the rows checked and dropped at each check
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is a valid compiled alphabet, the arrays agree with
+ *		it in size, the range of rows is within it, and i_max_candidates is positive
+ *	Postconditions:
+ *		io_candidates holds the closest of its old candidates and the rows, and the
+ *		counts have been added to
+ *	Returns:
+ *		none
+ */
+static void AUCR_Compiled_Scan(
+							   const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+							   const unsigned char * i_directional_codes,
+							   const int * i_activity_measures,
+							   const int * i_block_sums,
+							   int i_first_row,
+							   int i_stop_row,
+							   int i_max_candidates,
+							   AUCR_Candidate * io_candidates,
+							   int * io_num_candidates_ptr,
+							   AUCR_Statistics * io_statistics_ptr )
+{
+	//local variables
+	int i, j, span, full;
+	const unsigned char * tempcodes;
+	const int * tempmeasures;
+	unsigned long int difference, direction;
+	AUCR_Statistics counts;
+#if defined( AUCR_CHECK_BLOCK_BOUND )
+	int num_blocks;
+	const int * tempsums;
+	
+	num_blocks = ( i_compiled_alphabet_ptr->num_directional_codes + AUCR_BLOCK_CODES - 1 ) /
+	AUCR_BLOCK_CODES;
+#else
+	//the vector kernels go without the bound from the block sums
+	(void)i_block_sums;
+#endif
+	
+	//count locally, so the counts are not reloaded after every candidate offered
+	counts = ( *io_statistics_ptr );
+	
+	//check character against each row in the range
+	for( i = i_first_row; i < i_stop_row; i++ )
+	{
+		tempcodes = i_compiled_alphabet_ptr->directional_codes +
+		( i * i_compiled_alphabet_ptr->directional_code_stride );
+		tempmeasures = i_compiled_alphabet_ptr->activity_measures +
+		( i * i_compiled_alphabet_ptr->activity_measure_stride );
+		counts.rows++;
+		
+		//rows are only dropped once there are enough candidates
+		full = ( ( *io_num_candidates_ptr ) == i_max_candidates );
+		
+		//zero out difference for newest row
+		difference = 0;
+		
+		//check all activity measure differences
+		for( j = 0; j < i_compiled_alphabet_ptr->num_activity_regions; j++ )
+		{
+			difference += AUCR_Activity_Difference( i_activity_measures[j],
+												   tempmeasures[j], i_compiled_alphabet_ptr->bias[j] );
+		}
+		if( full && ( difference > io_candidates[0].difference ) )
+		{
+			counts.activity_skips++;
+			continue;
+		}
+		
+#if defined( AUCR_CHECK_BLOCK_BOUND )
+		//check the bound from the block sums
+		tempsums = i_compiled_alphabet_ptr->block_sums +
+		( i * i_compiled_alphabet_ptr->block_sum_stride );
+		if( full && ( difference + ( AUCR_SCALE * AUCR_Block_Bound( i_block_sums, tempsums, num_blocks ) ) >
+					 io_candidates[0].difference ) )
+		{
+			counts.bound_skips++;
+			continue;
+		}
+#endif
+		
+		//check directional code differences a run at a time, giving up at the
+		//first checkpoint at which the row is already farther than the farthest
+		direction = 0;
+		j = 0;
+		do
+		{
+			span = i_compiled_alphabet_ptr->directional_code_stride - j;
+			if( span > AUCR_CHECKPOINT_CODES )
+			{
+				span = AUCR_CHECKPOINT_CODES;
+			}
+			direction += AUCR_Direction_Difference( i_directional_codes + j, tempcodes + j, span,
+												   i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes );
+			j += span;
+		}
+		while( ( j < i_compiled_alphabet_ptr->directional_code_stride ) &&
+			  !( full && ( difference + ( AUCR_SCALE * direction ) > io_candidates[0].difference ) ) );
+		if( j < i_compiled_alphabet_ptr->directional_code_stride )
+		{
+			counts.direction_abandons++;
+			continue;
+		}
+		
+		AUCR_Candidates_Offer( io_candidates, io_num_candidates_ptr, i_max_candidates,
+							  i_compiled_alphabet_ptr->unicodes[i],
+							  i_compiled_alphabet_ptr->indices[i], difference + ( AUCR_SCALE * direction ) );
+	}
+	
+	( *io_statistics_ptr ) = counts;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Shortlist()
+ *	Description:
+ *		finds the rows of the compiled alphabet whose coarse codes and activity
+ *		measures are closest to those given, keeping them in a bounded max-heap of
+ *		candidates.  each coarse code difference is weighted by the number of
+ *		directional codes per coarse code, so that the differences found are on
+ *		the same scale as full resolution differences.  the candidates hold rows
+ *		of the compiled alphabet in place of indices.  a row whose coarse code
+ *		difference alone is already farther than the farthest candidate of a full
+ *		heap is skipped without checking its activity measures.
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to scan
+ *		i_coarse_codes -> packed coarse codes of the character being recognized
+ *		i_activity_measures -> activity measures of the character being recognized
+ *		i_shortlist_size -> number of candidates the heap may hold
+ *		io_shortlist <-> array of i_shortlist_size candidates kept as a max-heap
+ *		io_num_shortlisted_ptr <-> number of candidates in the heap
+ *		io_statistics_ptr <-> counts of the rows checked and dropped
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is a valid compiled alphabet, the arrays agree with
+ *		it in size, and i_shortlist_size is positive
+ *	Postconditions:
+ *		io_shortlist holds the closest rows at the coarse resolution, and the counts
+ *		have been added to
+ *	Returns:
+ *		none
+ */
+static void AUCR_Compiled_Shortlist(
+									const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+									const unsigned char * i_coarse_codes,
+									const int * i_activity_measures,
+									int i_shortlist_size,
+									AUCR_Candidate * io_shortlist,
+									int * io_num_shortlisted_ptr,
+									AUCR_Statistics * io_statistics_ptr )
+{
+	//local variables
+	int i, j;
+	const int * tempmeasures;
+	unsigned long int difference;
+	AUCR_Statistics counts;
+	
+	counts = ( *io_statistics_ptr );
+	
+	//check character against each row
+	for( i = 0; i < i_compiled_alphabet_ptr->num_characters; i++ )
+	{
+		tempmeasures = i_compiled_alphabet_ptr->activity_measures +
+		( i * i_compiled_alphabet_ptr->activity_measure_stride );
+		counts.rows++;
+		
+		//check all coarse code differences first, as they are cheaper
+		//than the activity measure differences
+		difference = AUCR_SCALE * i_compiled_alphabet_ptr->coarse_code_weight *
+		AUCR_Direction_Difference( i_coarse_codes, i_compiled_alphabet_ptr->coarse_codes +
+								  ( i * i_compiled_alphabet_ptr->coarse_code_stride ),
+								  i_compiled_alphabet_ptr->coarse_code_stride,
+								  i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes );
+		if( ( ( *io_num_shortlisted_ptr ) == i_shortlist_size ) &&
+		   ( difference > io_shortlist[0].difference ) )
+		{
+			counts.bound_skips++;
+			continue;
+		}
+		
+		//check all activity measure differences
+		for( j = 0; j < i_compiled_alphabet_ptr->num_activity_regions; j++ )
+		{
+			difference += AUCR_Activity_Difference( i_activity_measures[j],
+												   tempmeasures[j], i_compiled_alphabet_ptr->bias[j] );
+		}
+		
+		AUCR_Candidates_Offer( io_shortlist, io_num_shortlisted_ptr, i_shortlist_size,
+							  i_compiled_alphabet_ptr->unicodes[i], i, difference );
+	}
+	
+	( *io_statistics_ptr ) = counts;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Query()
+ *	Description:
+ *		finds the directional codes and activity measures of interpolated
+ *		coordinates for a compiled alphabet, and packs the directional codes
+ *		into a row laid out like the rows of the compiled alphabet, along with
+ *		their block sums
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet the query will be checked against
+ *		i_coordinates -> (num_directional_codes + 1) interpolated coordinates
+ *		io_hits <-> scratch array of (num_directional_codes + 2) * mappable_directional_codes
+ *					ints, with no row left marked by anything but this function
+ *		o_directional_codes <- array of num_directional_codes codes to fill in
+ *		o_activity_measures <- array of num_activity_regions measures to fill in
+ *		o_row <- array of directional_code_stride bytes to pack the codes into
+ *		o_block_sums <- array of block_sum_stride ints to find the block sums in
+ *	Preconditions:
+ *		all pointers are valid and all arrays are of the sizes given above
+ *	Postconditions:
+ *		o_directional_codes, o_activity_measures, o_row and o_block_sums are filled in
+ *	Returns:
+ *		none
+ */
+static void AUCR_Compiled_Query(
+								const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+								const AUCR_Coordinate * i_coordinates,
+								int * io_hits,
+								int * o_directional_codes,
+								int * o_activity_measures,
+								unsigned char * o_row,
+								int * o_block_sums )
+{
+	//local variables
+	int i;
+	
+	//find the features of the coordinates
+	AUCR_Extract_Features( i_coordinates,
+						  i_compiled_alphabet_ptr->num_directional_codes,
+						  &( i_compiled_alphabet_ptr->directional_code_map ),
+						  i_compiled_alphabet_ptr->num_activity_regions,
+						  i_compiled_alphabet_ptr->activity_regions,
+						  io_hits, o_directional_codes, o_activity_measures );
+	
+	//pack the directional codes the same way the rows are packed
+	for( i = 0; i < i_compiled_alphabet_ptr->num_directional_codes; i++ )
+	{
+		o_row[i] = (unsigned char)o_directional_codes[i];
+	}
+	for( ; i < i_compiled_alphabet_ptr->directional_code_stride; i++ )
+	{
+		o_row[i] = 0;
+	}
+	
+	AUCR_Block_Sums( o_row, i_compiled_alphabet_ptr->num_directional_codes,
+					i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes,
+					o_block_sums );
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Workspace_Create()
+ *	Description:
+ *		allocates a workspace for the given sizes, laying every array except the
+ *		distances out in one block of memory
+ *	Parameters:
+ *		i_num_directional_codes -> number of directional codes per character
+ *		i_num_activity_regions -> number of activity regions per character
+ *		i_mappable_directional_codes -> number of unique directional codes
+ *		o_workspace_ptr_ptr <- address of the AUCR_Workspace_Ptr to be populated
+ *	Preconditions:
+ *		all sizes are positive and the AUCR_Workspace_Ptr at o_workspace_ptr_ptr is NULL
+ *	Postconditions:
+ *		o_workspace_ptr_ptr points to a newly allocated workspace
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+static AUCR_Error AUCR_Workspace_Create(
+										int i_num_directional_codes,
+										int i_num_activity_regions,
+										int i_mappable_directional_codes,
+										AUCR_Workspace_Ptr * o_workspace_ptr_ptr )
+{
+	//local variables
+	AUCR_Workspace_Ptr tempworkspace;
+	int * tempints;
+	int stride, sum_stride, coarse_stride;
+	
+	stride = (int)AUCR_Round_Up( i_num_directional_codes, AUCR_CODE_ROW_ALIGNMENT );
+	coarse_stride = (int)AUCR_Round_Up( ( i_num_directional_codes < AUCR_COARSE_SEGMENTS ) ?
+									   i_num_directional_codes : AUCR_COARSE_SEGMENTS,
+									   AUCR_CODE_ROW_ALIGNMENT );
+	sum_stride = (int)AUCR_Round_Up( 2 * ( ( i_num_directional_codes + AUCR_BLOCK_CODES - 1 ) /
+										  AUCR_BLOCK_CODES ), 4 );
+	
+	//allocate structure memory
+	tempworkspace = (AUCR_Workspace_Ptr)malloc( sizeof( AUCR_Workspace ) );
+	if( tempworkspace == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//allocate block memory, coordinates, candidates and ints first, then bytes
+	tempworkspace->block = malloc( ( ( i_num_directional_codes + 1 ) * sizeof( AUCR_Coordinate ) ) +
+								  ( AUCR_COARSE_SHORTLIST * sizeof( AUCR_Candidate ) ) +
+								  ( ( i_num_directional_codes + i_num_activity_regions +
+									 ( ( i_num_directional_codes + 2 ) * i_mappable_directional_codes ) +
+									 ( AUCR_BATCH_QUERIES * i_num_activity_regions ) +
+									 ( ( 1 + AUCR_BATCH_QUERIES ) * sum_stride ) ) * sizeof( int ) ) +
+								  ( ( 1 + AUCR_BATCH_QUERIES ) * stride ) + coarse_stride );
+	if( tempworkspace->block == NULL )
+	{
+		free( tempworkspace );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//allocate distance memory
+	tempworkspace->distances =
+	(unsigned int *)malloc( AUCR_WORKSPACE_COORDINATES * sizeof( unsigned int ) );
+	if( tempworkspace->distances == NULL )
+	{
+		free( tempworkspace->block );
+		free( tempworkspace );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	tempworkspace->num_distances = AUCR_WORKSPACE_COORDINATES;
+	
+	tempworkspace->num_directional_codes = i_num_directional_codes;
+	tempworkspace->num_activity_regions = i_num_activity_regions;
+	tempworkspace->mappable_directional_codes = i_mappable_directional_codes;
+	tempworkspace->directional_code_stride = stride;
+	tempworkspace->block_sum_stride = sum_stride;
+	memset( &( tempworkspace->statistics ), 0, sizeof( AUCR_Statistics ) );
+	
+	//lay out the block
+	tempworkspace->interpolated_character.unicode = 0x0001;
+	tempworkspace->interpolated_character.num_directional_codes = i_num_directional_codes;
+	tempworkspace->interpolated_character.coordinates = (AUCR_Coordinate *)tempworkspace->block;
+	
+	tempworkspace->shortlist = (AUCR_Candidate *)( tempworkspace->interpolated_character.coordinates +
+												  ( i_num_directional_codes + 1 ) );
+	
+	tempints = (int *)( tempworkspace->shortlist + AUCR_COARSE_SHORTLIST );
+	tempworkspace->character.unicode = 0x0001;
+	tempworkspace->character.num_directional_codes = i_num_directional_codes;
+	tempworkspace->character.num_activity_regions = i_num_activity_regions;
+	tempworkspace->character.directional_codes = tempints;
+	tempworkspace->character.activity_measures = tempints + i_num_directional_codes;
+	tempworkspace->hits = tempworkspace->character.activity_measures + i_num_activity_regions;
+	tempworkspace->batch_activity_measures = tempworkspace->hits +
+	( ( i_num_directional_codes + 2 ) * i_mappable_directional_codes );
+	tempworkspace->block_sums = tempworkspace->batch_activity_measures +
+	( AUCR_BATCH_QUERIES * i_num_activity_regions );
+	tempworkspace->batch_block_sums = tempworkspace->block_sums + sum_stride;
+	tempworkspace->row = (unsigned char *)( tempworkspace->batch_block_sums +
+										   ( AUCR_BATCH_QUERIES * sum_stride ) );
+	tempworkspace->batch_rows = tempworkspace->row + stride;
+	tempworkspace->coarse_row = tempworkspace->batch_rows + ( AUCR_BATCH_QUERIES * stride );
+	
+	//no row of the counts is marked yet
+	memset( tempworkspace->hits, 0,
+		   ( i_num_directional_codes + 2 ) * i_mappable_directional_codes * sizeof( int ) );
+	
+	( *o_workspace_ptr_ptr ) = tempworkspace;
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Workspace_Fits()
+ *	Description:
+ *		checks that a workspace was sized for the given sizes
+ *	Parameters:
+ *		i_workspace_ptr -> workspace to check
+ *		i_num_directional_codes -> number of directional codes per character
+ *		i_num_activity_regions -> number of activity regions per character
+ *		i_mappable_directional_codes -> number of unique directional codes
+ *	Preconditions:
+ *		i_workspace_ptr is a valid workspace
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		non-zero if the workspace fits the sizes, zero otherwise
+ */
+static int AUCR_Workspace_Fits(
+							   const AUCR_Workspace * i_workspace_ptr,
+							   int i_num_directional_codes,
+							   int i_num_activity_regions,
+							   int i_mappable_directional_codes )
+{
+	return( i_workspace_ptr->num_directional_codes == i_num_directional_codes &&
+		   i_workspace_ptr->num_activity_regions == i_num_activity_regions &&
+		   i_workspace_ptr->mappable_directional_codes == i_mappable_directional_codes );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Square_Root_Floor()
+ *	Description:
+ *		finds the largest integer whose square is no more than the number given,
+ *		exactly, one bit of the root at a time
+ *	Parameters:
+ *		i_number -> the number to take the square root of
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the square root of i_number, rounded down
+ */
+static unsigned long AUCR_Square_Root_Floor( unsigned long i_number )
+{
+	//local variables
+	unsigned long root, bit;
+	
+	//start at the highest power of four no more than the number
+	root = 0;
+	bit = 1UL << ( ( sizeof( unsigned long ) * 8 ) - 2 );
+	while( bit > i_number )
+	{
+		bit >>= 2;
+	}
+	
+	//decide each bit of the root from the highest down
+	while( bit != 0 )
+	{
+		if( i_number >= root + bit )
+		{
+			i_number -= root + bit;
+			root = ( root >> 1 ) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	
+	return( root );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Index_Select()
+ *	Description:
+ *		reorders rows and their distances so that the distance at i_position is
+ *		where it would be if they were sorted, with no farther distance before it and
+ *		no nearer distance after it
+ *	Parameters:
+ *		io_rows <-> array of i_count rows
+ *		io_distances <-> array of the i_count distances of the rows
+ *		i_count -> number of rows
+ *		i_position -> position to select
+ *	Preconditions:
+ *		i_position is at least zero and less than i_count
+ *	Postconditions:
+ *		the rows and distances are reordered together as described
+ *	Returns:
+ *		none
+ */
+static void AUCR_Index_Select(
+							  int * io_rows,
+							  unsigned long * io_distances,
+							  int i_count,
+							  int i_position )
+{
+	//local variables
+	int first, last, i, j, temprow;
+	unsigned long pivot, tempdistance;
+	
+	first = 0;
+	last = i_count - 1;
+	while( first < last )
+	{
+		//partition around the middle distance
+		pivot = io_distances[first + ( ( last - first ) / 2 )];
+		i = first;
+		j = last;
+		while( i <= j )
+		{
+			while( io_distances[i] < pivot )
+			{
+				i++;
+			}
+			while( io_distances[j] > pivot )
+			{
+				j--;
+			}
+			if( i <= j )
+			{
+				temprow = io_rows[i];
+				io_rows[i] = io_rows[j];
+				io_rows[j] = temprow;
+				tempdistance = io_distances[i];
+				io_distances[i] = io_distances[j];
+				io_distances[j] = tempdistance;
+				i++;
+				j--;
+			}
+		}
+		
+		//keep going in the part that holds the position
+		if( i_position <= j )
+		{
+			last = j;
+		}
+		else if( i_position >= i )
+		{
+			first = i;
+		}
+		else
+		{
+			break;
+		}
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Index_Build()
+ *	Description:
+ *		makes a node centred on the first of the rows given, then splits the
+ *		other rows at their median distance from it and builds a node below it from
+ *		each half
+ *	Parameters:
+ *		io_index_ptr <-> index whose nodes are being built
+ *		io_rows <-> array of i_count rows to build nodes for, reordered
+ *		io_distances <-> scratch array of i_count distances
+ *		i_count -> number of rows
+ *		io_num_nodes_ptr <-> number of nodes built so far
+ *	Preconditions:
+ *		io_index_ptr has room for a node for every row
+ *	Postconditions:
+ *		there is a node for every row given, and the number of nodes built is updated
+ *	Returns:
+ *		the node made for the rows given, or -1 if there are none
+ */
+static int AUCR_Index_Build(
+							AUCR_Index_Ptr io_index_ptr,
+							int * io_rows,
+							unsigned long * io_distances,
+							int i_count,
+							int * io_num_nodes_ptr )
+{
+	//local variables
+	const AUCR_Compiled_Alphabet * compiled;
+	const unsigned char * centre;
+	AUCR_Index_Node_Ptr tempnode;
+	unsigned long low, high, scale;
+	int node, split, inside, outside, i;
+	
+	if( i_count < 1 )
+	{
+		return( -1 );
+	}
+	
+	compiled = io_index_ptr->compiled_alphabet_ptr;
+	scale = AUCR_INDEX_RESOLUTION * AUCR_INDEX_RESOLUTION;
+	
+	//centre a new node on the first row
+	node = ( *io_num_nodes_ptr )++;
+	tempnode = &( io_index_ptr->nodes[node] );
+	tempnode->row = io_rows[0];
+	tempnode->inside = -1;
+	tempnode->outside = -1;
+	tempnode->inside_low = 0;
+	tempnode->inside_high = 0;
+	tempnode->outside_low = 0;
+	tempnode->outside_high = 0;
+	if( i_count == 1 )
+	{
+		return( node );
+	}
+	
+	//find the distance of every other row from the centre
+	centre = compiled->directional_codes + ( io_rows[0] * compiled->directional_code_stride );
+	for( i = 1; i < i_count; i++ )
+	{
+		io_distances[i] = AUCR_Direction_Difference( centre,
+													compiled->directional_codes + ( io_rows[i] * compiled->directional_code_stride ),
+													compiled->directional_code_stride,
+													compiled->directional_code_map.mappable_directional_codes );
+	}
+	
+	//split the other rows at the median distance, the nearer half inside
+	split = ( i_count - 1 ) / 2;
+	AUCR_Index_Select( io_rows + 1, io_distances + 1, i_count - 1, split );
+	inside = split + 1;
+	outside = i_count - 1 - inside;
+	
+	//bound the distances of each half, rounding outwards
+	low = io_distances[1];
+	high = io_distances[1];
+	for( i = 2; i <= inside; i++ )
+	{
+		low = ( io_distances[i] < low ) ? io_distances[i] : low;
+		high = ( io_distances[i] > high ) ? io_distances[i] : high;
+	}
+	tempnode->inside_low = (int)AUCR_Square_Root_Floor( low * scale );
+	tempnode->inside_high = (int)AUCR_Square_Root_Floor( high * scale );
+	if( (unsigned long)tempnode->inside_high * tempnode->inside_high < high * scale )
+	{
+		tempnode->inside_high++;
+	}
+	if( outside > 0 )
+	{
+		low = io_distances[inside + 1];
+		high = io_distances[inside + 1];
+		for( i = inside + 2; i < i_count; i++ )
+		{
+			low = ( io_distances[i] < low ) ? io_distances[i] : low;
+			high = ( io_distances[i] > high ) ? io_distances[i] : high;
+		}
+		tempnode->outside_low = (int)AUCR_Square_Root_Floor( low * scale );
+		tempnode->outside_high = (int)AUCR_Square_Root_Floor( high * scale );
+		if( (unsigned long)tempnode->outside_high * tempnode->outside_high < high * scale )
+		{
+			tempnode->outside_high++;
+		}
+	}
+	
+	//build the nodes below, now that the distances are no longer needed
+	i = AUCR_Index_Build( io_index_ptr, io_rows + 1, io_distances + 1, inside, io_num_nodes_ptr );
+	io_index_ptr->nodes[node].inside = i;
+	i = AUCR_Index_Build( io_index_ptr, io_rows + 1 + inside, io_distances + 1 + inside,
+						 outside, io_num_nodes_ptr );
+	io_index_ptr->nodes[node].outside = i;
+	
+	return( node );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Index_Bound()
+ *	Description:
+ *		finds a difference that no row below a node can be closer than, from the
+ *		bounds on the query's distance from the node's row and on the distances of
+ *		the rows below from the node's row.  by the triangle inequality the query's
+ *		distance from a row below is at least the gap between the two ranges, and
+ *		activity measure differences are never less than zero, so they can only add
+ *		to it.
+ *	Parameters:
+ *		i_query_low -> least distance of the query from the node's row, in steps
+ *		i_query_high -> most distance of the query from the node's row, in steps
+ *		i_low -> least distance of the rows below from the node's row, in steps
+ *		i_high -> most distance of the rows below from the node's row, in steps
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the bound on the difference of every row below the node
+ */
+static unsigned long AUCR_Index_Bound(
+									  int i_query_low,
+									  int i_query_high,
+									  int i_low,
+									  int i_high )
+{
+	//local variables
+	unsigned long steps;
+	
+	//gap between the ranges, if there is one
+	steps = 0;
+	if( i_low > i_query_high )
+	{
+		steps = i_low - i_query_high;
+	}
+	else if( i_query_low > i_high )
+	{
+		steps = i_query_low - i_high;
+	}
+	
+	//the least directional code difference the gap allows, rounded up as
+	//the difference is whole
+	return( AUCR_SCALE * ( ( ( steps * steps ) +
+							( AUCR_INDEX_RESOLUTION * AUCR_INDEX_RESOLUTION ) - 1 ) /
+						  ( AUCR_INDEX_RESOLUTION * AUCR_INDEX_RESOLUTION ) ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Index_Search()
+ *	Description:
+ *		offers the row of a node to a bounded max-heap of candidates, then searches
+ *		the nodes below it, nearer bound first, skipping any whose bound is already
+ *		farther than the farthest candidate of a full heap
+ *	Parameters:
+ *		i_index_ptr -> index to search
+ *		i_node -> node to search from
+ *		i_directional_codes -> packed directional codes of the character being recognized
+ *		i_activity_measures -> activity measures of the character being recognized
+ *		i_max_candidates -> number of candidates the heap may hold
+ *		io_candidates <-> array of i_max_candidates candidates kept as a max-heap
+ *		io_num_candidates_ptr <-> number of candidates in the heap
+ *	Preconditions:
+ *		i_node is a node of the index, the arrays agree with its compiled alphabet
+ *		in size, and i_max_candidates is positive
+ *	Postconditions:
+ *		io_candidates holds the closest of its old candidates and the rows below the node
+ *	Returns:
+ *		none
+ */
+static void AUCR_Index_Search(
+							  const AUCR_Index * i_index_ptr,
+							  int i_node,
+							  const unsigned char * i_directional_codes,
+							  const int * i_activity_measures,
+							  int i_max_candidates,
+							  AUCR_Candidate * io_candidates,
+							  int * io_num_candidates_ptr )
+{
+	//local variables
+	const AUCR_Compiled_Alphabet * compiled;
+	const AUCR_Index_Node * tempnode;
+	const int * tempmeasures;
+	unsigned long int distance, difference, scaled, insidebound, outsidebound;
+	int j, low, high;
+	
+	compiled = i_index_ptr->compiled_alphabet_ptr;
+	tempnode = &( i_index_ptr->nodes[i_node] );
+	tempmeasures = compiled->activity_measures + ( tempnode->row * compiled->activity_measure_stride );
+	
+	//find the whole difference of the node's own row
+	difference = 0;
+	for( j = 0; j < compiled->num_activity_regions; j++ )
+	{
+		difference += AUCR_Activity_Difference( i_activity_measures[j],
+											   tempmeasures[j], compiled->bias[j] );
+	}
+	distance = AUCR_Direction_Difference( i_directional_codes,
+										 compiled->directional_codes + ( tempnode->row * compiled->directional_code_stride ),
+										 compiled->directional_code_stride,
+										 compiled->directional_code_map.mappable_directional_codes );
+	difference += AUCR_SCALE * distance;
+	AUCR_Candidates_Offer( io_candidates, io_num_candidates_ptr, i_max_candidates,
+						  compiled->unicodes[tempnode->row], compiled->indices[tempnode->row], difference );
+	
+	//bound the query's distance from the row, in steps
+	scaled = distance * AUCR_INDEX_RESOLUTION * AUCR_INDEX_RESOLUTION;
+	low = (int)AUCR_Square_Root_Floor( scaled );
+	high = ( (unsigned long)low * low < scaled ) ? ( low + 1 ) : low;
+	
+	insidebound = AUCR_Index_Bound( low, high, tempnode->inside_low, tempnode->inside_high );
+	outsidebound = AUCR_Index_Bound( low, high, tempnode->outside_low, tempnode->outside_high );
+	
+	//search the nearer half first, it is the more likely to shrink the heap
+	if( insidebound <= outsidebound )
+	{
+		if( tempnode->inside != -1 && ( ( *io_num_candidates_ptr ) < i_max_candidates ||
+									   insidebound <= io_candidates[0].difference ) )
+		{
+			AUCR_Index_Search( i_index_ptr, tempnode->inside, i_directional_codes, i_activity_measures,
+							  i_max_candidates, io_candidates, io_num_candidates_ptr );
+		}
+		if( tempnode->outside != -1 && ( ( *io_num_candidates_ptr ) < i_max_candidates ||
+										outsidebound <= io_candidates[0].difference ) )
+		{
+			AUCR_Index_Search( i_index_ptr, tempnode->outside, i_directional_codes, i_activity_measures,
+							  i_max_candidates, io_candidates, io_num_candidates_ptr );
+		}
+	}
+	else
+	{
+		if( tempnode->outside != -1 && ( ( *io_num_candidates_ptr ) < i_max_candidates ||
+										outsidebound <= io_candidates[0].difference ) )
+		{
+			AUCR_Index_Search( i_index_ptr, tempnode->outside, i_directional_codes, i_activity_measures,
+							  i_max_candidates, io_candidates, io_num_candidates_ptr );
+		}
+		if( tempnode->inside != -1 && ( ( *io_num_candidates_ptr ) < i_max_candidates ||
+									   insidebound <= io_candidates[0].difference ) )
+		{
+			AUCR_Index_Search( i_index_ptr, tempnode->inside, i_directional_codes, i_activity_measures,
+							  i_max_candidates, io_candidates, io_num_candidates_ptr );
+		}
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Reciprocal_Init()
+ *	Description:
+ *		finds the multiplier and shift that divide any nonnegative int by the
+ *		divisor given exactly.  with l bits in the divisor, the multiplier is
+ *		2^(31 + l) / divisor rounded up, which is under 2^32, and the error it
+ *		carries is too small to move any quotient of a dividend under 2^31.
+ *	Parameters:
+ *		i_divisor -> the divisor, or 0 to divide everything to 0
+ *		o_reciprocal_ptr <- address of the reciprocal to fill in
+ *	Preconditions:
+ *		i_divisor is nonnegative, o_reciprocal_ptr is valid
+ *	Postconditions:
+ *		o_reciprocal_ptr holds the reciprocal of i_divisor
+ *	Returns:
+ *		none
+ */
+static void AUCR_Reciprocal_Init( int i_divisor, AUCR_Reciprocal * o_reciprocal_ptr )
+{
+	//local variables
+	int bits;
+	
+	o_reciprocal_ptr->divisor = (unsigned long int)i_divisor;
+	o_reciprocal_ptr->multiplier = 0;
+	o_reciprocal_ptr->shift = 0;
+	if( i_divisor < 1 )
+	{
+		return;
+	}
+	
+	//count the bits needed to hold the divisor minus one
+	bits = 0;
+	while( ( 1UL << bits ) < (unsigned long int)i_divisor )
+	{
+		bits++;
+	}
+	
+	o_reciprocal_ptr->shift = 31 + bits;
+	o_reciprocal_ptr->multiplier = (unsigned long int)
+	( ( ( 1ULL << o_reciprocal_ptr->shift ) + (unsigned long long int)i_divisor - 1 ) /
+	 (unsigned long long int)i_divisor );
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Reciprocal_Rounding_Divide()
+ *	Description:
+ *		divides and rounds exactly as AUCR_Rounding_Divide() does, halves away
+ *		from zero, by a divisor kept as a reciprocal
+ *	Parameters:
+ *		i_dividend -> the number to divide
+ *		i_reciprocal_ptr -> reciprocal of the divisor
+ *	Preconditions:
+ *		i_reciprocal_ptr was filled in by AUCR_Reciprocal_Init()
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the rounded quotient, or 0 if the divisor is 0
+ */
+static int AUCR_Reciprocal_Rounding_Divide( int i_dividend, const AUCR_Reciprocal * i_reciprocal_ptr )
+{
+	//local variables
+	unsigned long int magnitude, quotient;
+	
+	magnitude = ( i_dividend < 0 ) ? ( 0UL - (unsigned long int)i_dividend ) : (unsigned long int)i_dividend;
+	quotient = (unsigned long int)( ( (unsigned long long int)magnitude * i_reciprocal_ptr->multiplier ) >>
+								   i_reciprocal_ptr->shift );
+	
+	//round up when the remainder is at least half the divisor
+	if( 2 * ( magnitude - quotient * i_reciprocal_ptr->divisor ) >= i_reciprocal_ptr->divisor &&
+	   i_reciprocal_ptr->divisor != 0 )
+	{
+		quotient++;
+	}
+	
+	return( ( i_dividend < 0 ) ? -(int)quotient : (int)quotient );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Scale_Rounding_Divide()
+ *	Description:
+ *		divides by AUCR_SCALE and rounds exactly as AUCR_Rounding_Divide() does.
+ *		the divisor is a constant here, so the compiler makes the division a
+ *		multiplication and a shift.  the dividend is 64 bits, so that products of
+ *		scaled coordinates can be divided without overflowing first
+ *	Parameters:
+ *		i_dividend -> the number to divide
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the rounded quotient
+ */
+static int AUCR_Scale_Rounding_Divide( long long int i_dividend )
+{
+	//local variables
+	unsigned long long int magnitude, quotient;
+	
+	magnitude = ( i_dividend < 0 ) ? ( 0ULL - (unsigned long long int)i_dividend ) :
+	(unsigned long long int)i_dividend;
+	quotient = magnitude / AUCR_SCALE;
+	
+	//round up when the remainder is at least half the divisor
+	if( 2 * ( magnitude - quotient * AUCR_SCALE ) >= AUCR_SCALE )
+	{
+		quotient++;
+	}
+	
+	return( ( i_dividend < 0 ) ? -(int)quotient : (int)quotient );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Square_Scale_Rounding_Divide()
+ *	Description:
+ *		divides a nonnegative number by AUCR_SCALE * AUCR_SCALE and rounds exactly
+ *		as AUCR_Rounding_Divide() does, with the division made a multiplication
+ *		and a shift by the compiler as in AUCR_Scale_Rounding_Divide()
+ *	Parameters:
+ *		i_dividend -> the number to divide
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the rounded quotient
+ */
+static unsigned long long int AUCR_Square_Scale_Rounding_Divide( unsigned long long int i_dividend )
+{
+	//local variables
+	unsigned long long int quotient;
+	
+	quotient = i_dividend / ( AUCR_SCALE * AUCR_SCALE );
+	
+	//round up when the remainder is at least half the divisor
+	if( 2 * ( i_dividend - quotient * ( AUCR_SCALE * AUCR_SCALE ) ) >= AUCR_SCALE * AUCR_SCALE )
+	{
+		quotient++;
+	}
+	
+	return( quotient );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Directional_Code_Search()
+ *	Description:
+ *		finds the directional code of a segment by walking the directional codes of
+ *		the half plane it points into, until one begins beyond it
+ *	Parameters:
+ *		i_directional_code_map_ptr -> directional code map with its begins and ends set
+ *		i_dx -> change in x along the segment
+ *		i_dy -> change in y along the segment
+ *	Preconditions:
+ *		i_directional_code_map_ptr is valid
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the directional code of the segment
+ */
+static int AUCR_Directional_Code_Search(
+										const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+										int i_dx,
+										int i_dy )
+{
+	//local variables
+	int j;
+	int code, begin, end;
+	
+	//intialize code to invalid value
+	code = -1;
+	
+	//setup for search in right halfplane
+	if( i_dx > 0 )
+	{
+		if( i_directional_code_map_ptr->positive_begin == -1 )
+		{
+			code = i_directional_code_map_ptr->negative_end;
+		}
+		begin = i_directional_code_map_ptr->positive_begin;
+		end = i_directional_code_map_ptr->positive_end;
+	}
+	//setup for search in left halfplane
+	else
+	{
+		if( i_directional_code_map_ptr->negative_begin == -1 )
+		{
+			code = i_directional_code_map_ptr->positive_end;
+		}
+		begin = i_directional_code_map_ptr->negative_begin;
+		end = i_directional_code_map_ptr->negative_end;
+	}
+	
+	if( code == -1 )
+	{
+		//start at the directional code that begins the quadrant, and advance thru the directional
+		//codes until you find one that has slope greater than the slope of the present vector,
+		//or until you reach the end of the quadrant
+		for ( j = begin; j != (( end + 1 ) %
+							   ( i_directional_code_map_ptr->mappable_directional_codes ) );
+			 j = (( j + 1 ) %
+				  ( i_directional_code_map_ptr->mappable_directional_codes ) ) )
+		{
+			if ( (long long int)i_dy * i_directional_code_map_ptr->x[j] <
+				(long long int)i_dx * i_directional_code_map_ptr->y[j] )
+			{
+				code =
+				( ( j + i_directional_code_map_ptr->mappable_directional_codes - 1 ) %
+				 ( i_directional_code_map_ptr->mappable_directional_codes ) );
+				break;
+			}
+		}
+	}
+	
+	//if for loop went until the end of the quadrant,
+	//point must be in the last area of the quadrant
+	if ( code == -1 )
+	{
+		code = end;
+	}
+	//direction is now in code
+	
+	return( code );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Code_Table_Fill()
+ *	Description:
+ *		fills in the code table of a directional code map.  each entry covers the
+ *		segments of one octant whose slope, as the shorter of |dx| and |dy| over the
+ *		longer, falls in one of AUCR_CODE_TABLE_SLOPES steps, or in the last entry,
+ *		is exactly one.  where no code boundary line crosses the step, every such
+ *		segment gets the same code from AUCR_Directional_Code_Search(), so that code
+ *		is stored; the other entries are -1 and left to the search.
+ *	Parameters:
+ *		io_directional_code_map_ptr <-> directional code map with its begins and ends
+ *							set and room for its code table
+ *	Preconditions:
+ *		io_directional_code_map_ptr is valid and its code_table is non NULL
+ *	Postconditions:
+ *		every entry of code_table is a directional code or -1
+ *	Returns:
+ *		none
+ */
+static void AUCR_Code_Table_Fill( AUCR_Directional_Code_Map_Ptr io_directional_code_map_ptr )
+{
+	//local variables
+	int i, j, step, last;
+	int xsign, ysign;
+	int dx0, dy0, dx1, dy1, dx, dy;
+	int straddles;
+	long long int cross0, cross1;
+	
+	for( i = 0; i < 8; i++ )
+	{
+		xsign = ( i & 4 ) ? 1 : -1;
+		ysign = ( i & 2 ) ? 1 : -1;
+	
+		for( step = 0; step <= AUCR_CODE_TABLE_SLOPES; step++ )
+		{
+			//find the segments at both edges of the step, and one inside it,
+			//with the last step holding only the diagonal; steep octants
+			//have the slope of dx over dy
+			last = ( step == AUCR_CODE_TABLE_SLOPES );
+			dx0 = ( i & 1 ) ? ( xsign * step ) : ( xsign * AUCR_CODE_TABLE_SLOPES );
+			dy0 = ( i & 1 ) ? ( ysign * AUCR_CODE_TABLE_SLOPES ) : ( ysign * step );
+			dx1 = ( i & 1 ) ? ( xsign * ( last ? step : ( step + 1 ) ) ) : dx0;
+			dy1 = ( i & 1 ) ? dy0 : ( ysign * ( last ? step : ( step + 1 ) ) );
+			dx = ( i & 1 ) ? ( xsign * ( last ? ( 2 * step ) : ( 2 * step + 1 ) ) ) :
+			( xsign * 2 * AUCR_CODE_TABLE_SLOPES );
+			dy = ( i & 1 ) ? ( ysign * 2 * AUCR_CODE_TABLE_SLOPES ) :
+			( ysign * ( last ? ( 2 * step ) : ( 2 * step + 1 ) ) );
+	
+			//the search only compares against lines thru the origin along each
+			//code's vector, so it is settled if both edges are strictly on the
+			//same side of every one of them.  the map's vectors may be any ints,
+			//as loaded from a file, so the cross products are found in 64 bits
+			straddles = 0;
+			for( j = 0; j < io_directional_code_map_ptr->mappable_directional_codes; j++ )
+			{
+				cross0 = ( (long long int)dy0 * io_directional_code_map_ptr->x[j] ) -
+				( (long long int)dx0 * io_directional_code_map_ptr->y[j] );
+				cross1 = ( (long long int)dy1 * io_directional_code_map_ptr->x[j] ) -
+				( (long long int)dx1 * io_directional_code_map_ptr->y[j] );
+				if( !( ( cross0 > 0 && cross1 > 0 ) || ( cross0 < 0 && cross1 < 0 ) ) )
+				{
+					straddles = 1;
+					break;
+				}
+			}
+	
+			io_directional_code_map_ptr->code_table[i * ( AUCR_CODE_TABLE_SLOPES + 1 ) + step] =
+			(short)( straddles ? -1 : AUCR_Directional_Code_Search( io_directional_code_map_ptr, dx, dy ) );
+		}
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Directional_Code()
+ *	Description:
+ *		finds the directional code of a segment, looking it up by octant and
+ *		quantized slope and searching the map where the table cannot tell
+ *	Parameters:
+ *		i_directional_code_map_ptr -> finalized directional code map to quantize with
+ *		i_dx -> change in x along the segment
+ *		i_dy -> change in y along the segment
+ *	Preconditions:
+ *		i_directional_code_map_ptr is valid
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the directional code of the segment
+ */
+static int AUCR_Directional_Code(
+								 const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+								 int i_dx,
+								 int i_dy )
+{
+	//local variables
+	int code, adx, ady, octant;
+	
+	//look the direction up by octant and quantized slope
+	code = -1;
+	adx = ( i_dx < 0 ) ? -i_dx : i_dx;
+	ady = ( i_dy < 0 ) ? -i_dy : i_dy;
+	if( i_directional_code_map_ptr->code_table != NULL && ( adx | ady ) != 0 )
+	{
+		octant = ( ( i_dx > 0 ) ? 4 : 0 ) + ( ( i_dy > 0 ) ? 2 : 0 ) + ( ( ady > adx ) ? 1 : 0 );
+		code = ( ady > adx ) ?
+		i_directional_code_map_ptr->code_table[octant * ( AUCR_CODE_TABLE_SLOPES + 1 ) +
+											   ( adx * AUCR_CODE_TABLE_SLOPES ) / ady] :
+		i_directional_code_map_ptr->code_table[octant * ( AUCR_CODE_TABLE_SLOPES + 1 ) +
+											   ( ady * AUCR_CODE_TABLE_SLOPES ) / adx];
+	}
+	
+	//search the directional codes where the table cannot tell
+	if( code == -1 )
+	{
+		code = AUCR_Directional_Code_Search( i_directional_code_map_ptr, i_dx, i_dy );
+	}
+	
+	return( code );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Mark_Activity_Regions()
+ *	Description:
+ *		marks with -1 the rows of direction counts that an activity region starts
+ *		at or ends before, so that counting the directions keeps the counts so far
+ *		in them
+ *	Parameters:
+ *		i_mappable_directional_codes -> number of counts in each row
+ *		i_num_activity_regions -> number of activity regions
+ *		i_activity_regions -> array of i_num_activity_regions activity regions
+ *		io_hits <-> rows of direction counts to mark
+ *	Preconditions:
+ *		all pointers are valid and io_hits has a row for every start and after every end
+ *	Postconditions:
+ *		the first count of each row a region needs is -1
+ *	Returns:
+ *		none
+ */
+static void AUCR_Mark_Activity_Regions(
+									   int i_mappable_directional_codes,
+									   int i_num_activity_regions,
+									   const AUCR_Activity_Region * i_activity_regions,
+									   int * io_hits )
+{
+	//local variables
+	int i;
+	
+	for( i = 0; i < i_num_activity_regions; i++ )
+	{
+		io_hits[i_activity_regions[i].start * i_mappable_directional_codes] = -1;
+		io_hits[( i_activity_regions[i].stop + 1 ) * i_mappable_directional_codes] = -1;
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Activity_Measures()
+ *	Description:
+ *		finds the activity measure of each region from the direction counts kept
+ *		at its start and after its end
+ *	Parameters:
+ *		i_mappable_directional_codes -> number of counts in each row
+ *		i_num_activity_regions -> number of activity regions
+ *		i_activity_regions -> array of i_num_activity_regions activity regions
+ *		i_hits -> rows of direction counts, kept at every row the regions need
+ *		o_activity_measures <- array of i_num_activity_regions measures to fill in
+ *	Preconditions:
+ *		all pointers are valid and all arrays are of the sizes given above
+ *	Postconditions:
+ *		o_activity_measures is filled in
+ *	Returns:
+ *		none
+ */
+static void AUCR_Activity_Measures(
+								   int i_mappable_directional_codes,
+								   int i_num_activity_regions,
+								   const AUCR_Activity_Region * i_activity_regions,
+								   const int * i_hits,
+								   int * o_activity_measures )
+{
+	//local variables
+	int i, j, max;
+	const int * startcounts;
+	const int * stopcounts;
+	
+	for( i = 0; i < i_num_activity_regions; i++ )
+	{
+		startcounts = i_hits + ( i_activity_regions[i].start * i_mappable_directional_codes );
+		stopcounts = i_hits + ( ( i_activity_regions[i].stop + 1 ) * i_mappable_directional_codes );
+		max = 0;
+		for( j = 0; j < i_mappable_directional_codes; j++ )
+		{
+			if( stopcounts[j] - startcounts[j] > max )
+			{
+				max = stopcounts[j] - startcounts[j];
+			}
+		}
+		o_activity_measures[i] =
+		AUCR_Rounding_Divide( ( AUCR_SCALE *
+							   ( 1 + i_activity_regions[i].stop - i_activity_regions[i].start ) ),
+							 ( max ) );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Extract_Features()
+ *	Description:
+ *		finds the directional codes and activity measures of the segments between
+ *		consecutive interpolated coordinates.  this is the work shared by every
+ *		conversion from interpolated characters to characters, whether they are
+ *		against an alphabet or a compiled alphabet.  the directions are counted once
+ *		along the codes, keeping the counts so far at each start and after each end
+ *		of an activity region, so that each region's counts are the difference of
+ *		two rows however long the regions are and however much they overlap.  the
+ *		rows needed are marked with -1 in their first count before counting.
+ *	Parameters:
+ *		i_coordinates -> (i_num_directional_codes + 1) interpolated coordinates
+ *		i_num_directional_codes -> number of segments to find directional codes for
+ *		i_directional_code_map_ptr -> finalized directional code map to quantize with
+ *		i_num_activity_regions -> number of activity regions to find activity measures for
+ *		i_activity_regions -> array of i_num_activity_regions activity regions
+ *		io_hits <-> scratch array of (i_num_directional_codes + 2) * mappable_directional_codes
+ *					ints, with no row left marked by anything but this function
+ *		o_directional_codes <- array of i_num_directional_codes codes to fill in
+ *		o_activity_measures <- array of i_num_activity_regions measures to fill in
+ *	Preconditions:
+ *		all pointers are valid and all arrays are of the sizes given above
+ *	Postconditions:
+ *		o_directional_codes and o_activity_measures are filled in
+ *	Returns:
+ *		none
+ */
+static void AUCR_Extract_Features(
+								  const AUCR_Coordinate * i_coordinates,
+								  int i_num_directional_codes,
+								  const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+								  int i_num_activity_regions,
+								  const AUCR_Activity_Region * i_activity_regions,
+								  int * io_hits,
+								  int * o_directional_codes,
+								  int * o_activity_measures )
+{
+	//local variables
+	int i, j, mappable;
+	int * running;
+	
+	//find all directional codes
+	for( i = 0; i < i_num_directional_codes; i++ )
+	{
+		o_directional_codes[i] =
+		AUCR_Directional_Code( i_directional_code_map_ptr,
+							  i_coordinates[i + 1].x - i_coordinates[i].x,
+							  i_coordinates[i + 1].y - i_coordinates[i].y );
+	}
+	
+	//mark the rows of counts that start or end an activity region
+	mappable = i_directional_code_map_ptr->mappable_directional_codes;
+	running = io_hits + ( ( i_num_directional_codes + 1 ) * mappable );
+	AUCR_Mark_Activity_Regions( mappable, i_num_activity_regions, i_activity_regions, io_hits );
+	
+	//count all directions once, keeping the counts so far at each marked row
+	for( j = 0; j < mappable; j++ )
+	{
+		running[j] = 0;
+	}
+	for( i = 0; i <= i_num_directional_codes; i++ )
+	{
+		if( io_hits[i * mappable] == -1 )
+		{
+			memcpy( io_hits + ( i * mappable ), running, mappable * sizeof( int ) );
+		}
+		if( i < i_num_directional_codes )
+		{
+			running[o_directional_codes[i]]++;
+		}
+	}
+	
+	//find activity for all regions from the counts at their ends
+	AUCR_Activity_Measures( mappable, i_num_activity_regions, i_activity_regions,
+						   io_hits, o_activity_measures );
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Segment_Length()
+ *	Description:
+ *		finds the length of a segment between raw coordinates in AUCR_SCALE units,
+ *		exactly as AUCR_Integer_Square_Root() of its squared length would, but with
+ *		the differences, their squares and the root in 64 bits.  raw coordinates far
+ *		apart, as from a high resolution tablet, do not overflow and no caller has to
+ *		shrink its ink first.
+ *	Parameters:
+ *		i_from_x -> x of the coordinate the segment starts at
+ *		i_from_y -> y of the coordinate the segment starts at
+ *		i_to_x -> x of the coordinate the segment ends at
+ *		i_to_y -> y of the coordinate the segment ends at
+ *	Preconditions:
+ *		the segment is shorter than 4,000,000 units
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the length of the segment times AUCR_SCALE, rounded to the nearest integer
+ */
+static unsigned int AUCR_Segment_Length( int i_from_x, int i_from_y, int i_to_x, int i_to_y )
+{
+	//declare variables
+	long long int dx, dy;
+	unsigned long long int square, root, remainder, trial;
+	int shift;
+	
+	dx = (long long int)i_to_x - i_from_x;
+	dy = (long long int)i_to_y - i_from_y;
+	square = (unsigned long long int)( ( dx * dx ) + ( dy * dy ) ) * AUCR_SCALE * AUCR_SCALE;
+	
+	//bring down the bits of the square two at a time, from the highest,
+	//and decide one bit of the root from each pair
+	root = 0;
+	remainder = 0;
+	for( shift = 62; shift >= 0; shift -= 2 )
+	{
+		remainder = ( remainder << 2 ) | ( ( square >> shift ) & 3 );
+		trial = ( root << 2 ) | 1;
+		root <<= 1;
+		if( remainder >= trial )
+		{
+			remainder -= trial;
+			root |= 1;
+		}
+	}
+	
+	//round up when the square is past ( root + 1/2 )^2 = root^2 + root + 1/4
+	if( remainder > root )
+	{
+		root++;
+	}
+	
+	return( (unsigned int)root );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Within_Tolerance()
+ *	Description:
+ *		checks whether a raw coordinate is within a tolerance of a segment, in 64
+ *		bits and without a divide.  the distance is to the nearest point of the
+ *		segment, so a coordinate past either end is measured to that end.
+ *	Parameters:
+ *		i_start_ptr -> coordinate the segment starts at
+ *		i_end_x -> x of the coordinate the segment ends at
+ *		i_end_y -> y of the coordinate the segment ends at
+ *		i_length -> length of the segment, as AUCR_Segment_Length() finds it
+ *		i_point_ptr -> coordinate to measure
+ *		i_tolerance -> most distance, in raw units, the coordinate may be from the segment
+ *	Preconditions:
+ *		all pointers are valid, the segment is shorter than 4,000,000 units and the
+ *		tolerance is positive
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		non-zero if the coordinate is within the tolerance, zero otherwise
+ */
+static int AUCR_Within_Tolerance(
+								 const AUCR_Coordinate * i_start_ptr,
+								 int i_end_x,
+								 int i_end_y,
+								 unsigned int i_length,
+								 const AUCR_Coordinate * i_point_ptr,
+								 int i_tolerance )
+{
+	//local variables
+	long long int dx, dy, px, py, dot, length, cross, tolerance;
+	
+	dx = (long long int)i_end_x - i_start_ptr->x;
+	dy = (long long int)i_end_y - i_start_ptr->y;
+	px = (long long int)i_point_ptr->x - i_start_ptr->x;
+	py = (long long int)i_point_ptr->y - i_start_ptr->y;
+	tolerance = i_tolerance;
+	dot = ( px * dx ) + ( py * dy );
+	length = ( dx * dx ) + ( dy * dy );
+	
+	//before the start, measure to the start
+	if( dot <= 0 || length == 0 )
+	{
+		return( ( px * px ) + ( py * py ) <= tolerance * tolerance );
+	}
+	
+	//past the end, measure to the end
+	if( dot >= length )
+	{
+		px -= dx;
+		py -= dy;
+		return( ( px * px ) + ( py * py ) <= tolerance * tolerance );
+	}
+	
+	//alongside, the cross product is the distance times the length, and the
+	//length is compared in AUCR_SCALE units
+	cross = ( dx * py ) - ( dy * px );
+	if( cross < 0 )
+	{
+		cross = -cross;
+	}
+	return( cross * AUCR_SCALE <= tolerance * i_length );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Arc_Lengths()
+ *	Description:
+ *		finds the arc length from the first raw coordinate to each raw coordinate
+ *	Parameters:
+ *		i_num_coordinates -> number of coordinates in i_coordinates
+ *		i_coordinates -> array of raw pen coordinates
+ *		o_distances <- array of i_num_coordinates distances to fill in
+ *	Preconditions:
+ *		i_num_coordinates is positive, all pointers are valid and all arrays are of
+ *		the sizes given above, the coordinates are less than 4,000,000 units long
+ *		altogether so that their length in AUCR_SCALE units fits the distances
+ *	Postconditions:
+ *		o_distances is filled in
+ *	Returns:
+ *		none
+ */
+static void AUCR_Arc_Lengths(
+							 int i_num_coordinates,
+							 const AUCR_Coordinate * i_coordinates,
+							 unsigned int * o_distances )
+{
+	//loop index
+	int i;
+	
+	o_distances[0] = 0;
+	
+	//loop to calculate distances
+	for(i = 1; i < i_num_coordinates; i++ )
+	{
+		o_distances[i] = o_distances[i - 1] + AUCR_Segment_Length( i_coordinates[i - 1].x, i_coordinates[i - 1].y,
+																   i_coordinates[i].x, i_coordinates[i].y );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Resample()
+ *	Description:
+ *		resamples raw coordinates into the (num_directional_codes + 1) coordinates
+ *		of an interpolated character, evenly spaced along their arc length.  this is
+ *		the work shared by conversions from a whole array of raw coordinates and from
+ *		a stroke whose arc length was kept as it was drawn.
+ *	Parameters:
+ *		i_num_coordinates -> number of coordinates in i_coordinates and i_distances
+ *		i_coordinates -> array of raw pen coordinates
+ *		i_distances -> arc length from the first coordinate to each coordinate
+ *		io_interpolated_character_ptr <-> interpolated character to populate
+ *	Preconditions:
+ *		i_num_coordinates is positive, all pointers are valid and all arrays are of
+ *		the sizes given above
+ *	Postconditions:
+ *		io_interpolated_character_ptr is populated with the interpolated version of the
+ *		raw coordinates.  short strokes are scaled up as they are read.
+ *	Returns:
+ *		none
+ */
+static void AUCR_Resample(
+						  int i_num_coordinates,
+						  const AUCR_Coordinate * i_coordinates,
+						  const unsigned int * i_distances,
+						  AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr )
+{
+	//declare variables
+	//holds scale factor if needed, and as unsigned to scale distances with
+	int tempscalar;
+	unsigned int scale;
+	//holds length all segments will be, unsigned as the distances are
+	unsigned int seglength;
+	//index of point currently being looked at
+	int currentcoord = 1;
+	//parameter in parametric equations for doing interpolations
+	int t;
+	//length in AUCR_SCALE units of the last raw segment that more than one
+	//point landed in, and the index of its end, or 0 before the first
+	AUCR_Reciprocal segmentlength = { 0, 0, 0 };
+	int segmentcoord = 0;
+	//loop index
+	int i;
+	
+	//case 1: input has no distance
+	if( i_distances[i_num_coordinates - 1] < 1 )
+	{ 
+		//fill in entire coordinate array with zeros
+		for( i = 0; i <= io_interpolated_character_ptr->num_directional_codes; i++ )
+		{
+			io_interpolated_character_ptr->coordinates[i].x = 0;
+			io_interpolated_character_ptr->coordinates[i].y = 0;
+		}
+	}
+	
+	//case 2: input has distance
+	else
+	{
+		//make sure input has long enough distance
+		//
+		//the ( io_interpolated_character_ptr->num_directional_codes * AUCR_SCALE * 2 )
+		//term is the scaling cut off factor and should have a noticeable impact on 
+		//the efficiency and accuracy of the interpolation algorithm.
+		//
+		//for smaller input devices, it may be better to go ahead and just scale 
+		//everything without even checking how much total information we read in.
+		//
+		//the larger the term is (i.e. increasing the 2 to a 5) should give us a 
+		//better interpolation and make the resulting segmented curve smoother, 
+		//but on the other hand making it too large makes us run the risk of  
+		//overflow in longer cases and will also force us to rescale more often 
+		//which may not have adequate run time performance
+		//
+		tempscalar = 1;
+		if( i_distances[i_num_coordinates - 1] < 
+		   (unsigned int)( io_interpolated_character_ptr->num_directional_codes * AUCR_SCALE * 10 ) )
+		{
+			//too short, so we will scale.  the distances and raw
+			//coordinates are scaled as they are read so they are left unchanged
+			//scale factor
+			tempscalar = AUCR_Rounding_Divide( 
+											  io_interpolated_character_ptr->num_directional_codes * AUCR_SCALE * 20,
+											  i_distances[i_num_coordinates - 1] );
+		}
+		scale = (unsigned int)tempscalar;
+		
+		//first interpolated point is the same as first raw point
+		io_interpolated_character_ptr->coordinates[0].x = tempscalar * i_coordinates[0].x;
+		io_interpolated_character_ptr->coordinates[0].y = tempscalar * i_coordinates[0].y;
+		
+		//find segment length, rounding as AUCR_Rounding_Divide() does but
+		//unsigned, since long strokes of wide ink are longer than an int
+		seglength = ( scale * i_distances[i_num_coordinates - 1] ) / io_interpolated_character_ptr->num_directional_codes;
+		if( 2 * ( ( scale * i_distances[i_num_coordinates - 1] ) % io_interpolated_character_ptr->num_directional_codes ) >=
+		   (unsigned int)io_interpolated_character_ptr->num_directional_codes )
+		{
+			seglength++;
+		}
+		
+		//interpolate middle points
+		for( i = 1; i < io_interpolated_character_ptr->num_directional_codes; i++ )
+		{
+			//while the total distance from the start to the current coordinate
+			//is less than the current multiple of the segment length
+			while( ( scale * i_distances[currentcoord] ) <(unsigned int)( i * seglength ) &&
+				  currentcoord < i_num_coordinates - 1 )
+			{
+				//move to the next coordinate
+				currentcoord++;
+			}
+			//calculate parameter t that will give us the interpolated point
+			//when used in parametric equations for the current segment.  a
+			//segment that more points land in divides by the reciprocal of its
+			//length, made once and shared by them all
+			if( currentcoord == segmentcoord ||
+			   ( scale * i_distances[currentcoord] ) >= (unsigned int)( ( i + 1 ) * seglength ) )
+			{
+				if( currentcoord != segmentcoord )
+				{
+					AUCR_Reciprocal_Init( AUCR_Scale_Rounding_Divide( (int)( scale * ( i_distances[currentcoord] -
+																			  i_distances[currentcoord - 1] ) ) ),
+										 &segmentlength );
+					segmentcoord = currentcoord;
+				}
+				t = AUCR_Reciprocal_Rounding_Divide( (int)( (unsigned int) ( ( i * seglength ) - 
+																		   ( scale * i_distances[currentcoord - 1] ) ) ),
+													&segmentlength );
+			}
+			else
+			{
+				t = AUCR_Rounding_Divide( (unsigned int) ( ( i * seglength ) - 
+														  ( scale * i_distances[currentcoord - 1] ) ), AUCR_Scale_Rounding_Divide( 
+																												 (int)( scale * ( i_distances[currentcoord] -
+																													   i_distances[currentcoord - 1] ) ) ) );
+			}
+			//parametric equation for x
+			io_interpolated_character_ptr->coordinates[i].x = 
+			( tempscalar * i_coordinates[currentcoord - 1].x ) + AUCR_Scale_Rounding_Divide( 
+																	 ( (long long int)tempscalar * ( i_coordinates[currentcoord].x -
+																		i_coordinates[currentcoord - 1].x ) * t ) );
+			//parametric equation for y
+			io_interpolated_character_ptr->coordinates[i].y = 
+			( tempscalar * i_coordinates[currentcoord - 1].y ) + AUCR_Scale_Rounding_Divide( 
+																	 ( (long long int)tempscalar * ( i_coordinates[currentcoord].y -
+																		i_coordinates[currentcoord - 1].y ) * t ) );
+		}
+		
+		//last interpolated point is the same as last raw point
+		io_interpolated_character_ptr->coordinates[i].x = 
+		tempscalar * i_coordinates[i_num_coordinates - 1].x;
+		io_interpolated_character_ptr->coordinates[i].y =
+		tempscalar * i_coordinates[i_num_coordinates - 1].y;
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Resample_Features()
+ *	Description:
+ *		finds the directional codes and activity measures of raw coordinates in one
+ *		pass along them, giving exactly what AUCR_Resample() followed by
+ *		AUCR_Extract_Features() gives.  each interpolated coordinate is quantized
+ *		against the one before it as soon as it is found and its direction counted
+ *		straight away, so only the last interpolated coordinate is ever kept.
+ *	Parameters:
+ *		i_num_coordinates -> number of coordinates in i_coordinates and i_distances
+ *		i_coordinates -> array of raw pen coordinates
+ *		i_distances -> arc length from the first coordinate to each coordinate
+ *		i_num_directional_codes -> number of segments to find directional codes for
+ *		i_directional_code_map_ptr -> finalized directional code map to quantize with
+ *		i_num_activity_regions -> number of activity regions to find activity measures for
+ *		i_activity_regions -> array of i_num_activity_regions activity regions
+ *		io_hits <-> scratch array of (i_num_directional_codes + 2) * mappable_directional_codes
+ *					ints, with no row left marked by anything but this function
+ *		o_directional_codes <- array of i_num_directional_codes codes to fill in
+ *		o_activity_measures <- array of i_num_activity_regions measures to fill in
+ *	Preconditions:
+ *		i_num_coordinates is positive, all pointers are valid and all arrays are of
+ *		the sizes given above
+ *	Postconditions:
+ *		o_directional_codes and o_activity_measures are filled in
+ *	Returns:
+ *		none
+ */
+static void AUCR_Resample_Features(
+								   int i_num_coordinates,
+								   const AUCR_Coordinate * i_coordinates,
+								   const unsigned int * i_distances,
+								   int i_num_directional_codes,
+								   const AUCR_Directional_Code_Map * i_directional_code_map_ptr,
+								   int i_num_activity_regions,
+								   const AUCR_Activity_Region * i_activity_regions,
+								   int * io_hits,
+								   int * o_directional_codes,
+								   int * o_activity_measures )
+{
+	//declare variables
+	//holds scale factor if needed, and as unsigned to scale distances with
+	int tempscalar;
+	unsigned int scale;
+	//holds length all segments will be, unsigned as the distances are
+	unsigned int seglength;
+	//index of point currently being looked at
+	int currentcoord = 1;
+	//parameter in parametric equations for doing interpolations
+	int t;
+	//length in AUCR_SCALE units of the last raw segment that more than one
+	//point landed in, and the index of its end, or 0 before the first
+	AUCR_Reciprocal segmentlength = { 0, 0, 0 };
+	int segmentcoord = 0;
+	//the last interpolated point and the one being found
+	int lastx, lasty, x, y;
+	//directional code of the segment between them, and the running counts
+	int code, mappable;
+	int * running;
+	//loop index
+	int i;
+	
+	//mark the rows of counts that start or end an activity region
+	mappable = i_directional_code_map_ptr->mappable_directional_codes;
+	running = io_hits + ( ( i_num_directional_codes + 1 ) * mappable );
+	AUCR_Mark_Activity_Regions( mappable, i_num_activity_regions, i_activity_regions, io_hits );
+	for( i = 0; i < mappable; i++ )
+	{
+		running[i] = 0;
+	}
+	
+	//case 1: input has no distance, so every interpolated point is zero and
+	//every segment has the direction of no change
+	if( i_distances[i_num_coordinates - 1] < 1 )
+	{
+		code = AUCR_Directional_Code( i_directional_code_map_ptr, 0, 0 );
+		for( i = 0; i < i_num_directional_codes; i++ )
+		{
+			o_directional_codes[i] = code;
+			if( io_hits[i * mappable] == -1 )
+			{
+				memcpy( io_hits + ( i * mappable ), running, mappable * sizeof( int ) );
+			}
+			running[code]++;
+		}
+	}
+	
+	//case 2: input has distance
+	else
+	{
+		//make sure input has long enough distance, scaling as AUCR_Resample() does
+		tempscalar = 1;
+		if( i_distances[i_num_coordinates - 1] <
+		   (unsigned int)( i_num_directional_codes * AUCR_SCALE * 10 ) )
+		{
+			tempscalar = AUCR_Rounding_Divide(
+											  i_num_directional_codes * AUCR_SCALE * 20,
+											  i_distances[i_num_coordinates - 1] );
+		}
+		scale = (unsigned int)tempscalar;
+		
+		//first interpolated point is the same as first raw point
+		lastx = tempscalar * i_coordinates[0].x;
+		lasty = tempscalar * i_coordinates[0].y;
+		
+		//find segment length, rounding as AUCR_Rounding_Divide() does but
+		//unsigned, since long strokes of wide ink are longer than an int
+		seglength = ( scale * i_distances[i_num_coordinates - 1] ) / i_num_directional_codes;
+		if( 2 * ( ( scale * i_distances[i_num_coordinates - 1] ) % i_num_directional_codes ) >=
+		   (unsigned int)i_num_directional_codes )
+		{
+			seglength++;
+		}
+		
+		//find each interpolated point, and the directional code of the segment
+		//ending at it
+		for( i = 1; i <= i_num_directional_codes; i++ )
+		{
+			if( i < i_num_directional_codes )
+			{
+				//interpolate middle points exactly as AUCR_Resample() does
+				while( ( scale * i_distances[currentcoord] ) <(unsigned int)( i * seglength ) &&
+					  currentcoord < i_num_coordinates - 1 )
+				{
+					currentcoord++;
+				}
+				if( currentcoord == segmentcoord ||
+				   ( scale * i_distances[currentcoord] ) >= (unsigned int)( ( i + 1 ) * seglength ) )
+				{
+					if( currentcoord != segmentcoord )
+					{
+						AUCR_Reciprocal_Init( AUCR_Scale_Rounding_Divide( (int)( scale * ( i_distances[currentcoord] -
+																				  i_distances[currentcoord - 1] ) ) ),
+											 &segmentlength );
+						segmentcoord = currentcoord;
+					}
+					t = AUCR_Reciprocal_Rounding_Divide( (int)( (unsigned int) ( ( i * seglength ) -
+																			   ( scale * i_distances[currentcoord - 1] ) ) ),
+														&segmentlength );
+				}
+				else
+				{
+					t = AUCR_Rounding_Divide( (unsigned int) ( ( i * seglength ) -
+															  ( scale * i_distances[currentcoord - 1] ) ),
+											 AUCR_Scale_Rounding_Divide( (int)( scale * ( i_distances[currentcoord] -
+																						 i_distances[currentcoord - 1] ) ) ) );
+				}
+				x = ( tempscalar * i_coordinates[currentcoord - 1].x ) + AUCR_Scale_Rounding_Divide(
+																	   ( (long long int)tempscalar * ( i_coordinates[currentcoord].x -
+																					   i_coordinates[currentcoord - 1].x ) * t ) );
+				y = ( tempscalar * i_coordinates[currentcoord - 1].y ) + AUCR_Scale_Rounding_Divide(
+																	   ( (long long int)tempscalar * ( i_coordinates[currentcoord].y -
+																					   i_coordinates[currentcoord - 1].y ) * t ) );
+			}
+			else
+			{
+				//last interpolated point is the same as last raw point
+				x = tempscalar * i_coordinates[i_num_coordinates - 1].x;
+				y = tempscalar * i_coordinates[i_num_coordinates - 1].y;
+			}
+			
+			//quantize the segment and count its direction, keeping the counts
+			//so far if the segment starts a marked row
+			code = AUCR_Directional_Code( i_directional_code_map_ptr, x - lastx, y - lasty );
+			o_directional_codes[i - 1] = code;
+			if( io_hits[( i - 1 ) * mappable] == -1 )
+			{
+				memcpy( io_hits + ( ( i - 1 ) * mappable ), running, mappable * sizeof( int ) );
+			}
+			running[code]++;
+			lastx = x;
+			lasty = y;
+		}
+	}
+	
+	//keep the counts after the last segment if they are marked
+	if( io_hits[i_num_directional_codes * mappable] == -1 )
+	{
+		memcpy( io_hits + ( i_num_directional_codes * mappable ), running, mappable * sizeof( int ) );
+	}
+	
+	//find activity for all regions from the counts at their ends
+	AUCR_Activity_Measures( mappable, i_num_activity_regions, i_activity_regions,
+						   io_hits, o_activity_measures );
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Prototype_Difference()
+ *	Description:
+ *		finds the difference between a character and one character of the alphabet,
+ *		giving up as soon as it is sure the difference is more than a bound
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet holding the character to check against
+ *		i_character_ptr -> character being recognized
+ *		i_prototype_ptr -> character of the alphabet to check against
+ *		i_bound -> difference past which to give up, or ULONG_MAX to find it all
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet and both characters agree with it in size
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the difference, or a partial difference more than i_bound if it gave up
+ */
+static unsigned long int AUCR_Prototype_Difference(
+												   const AUCR_Alphabet * i_alphabet_ptr,
+												   const AUCR_Character * i_character_ptr,
+												   const AUCR_Character * i_prototype_ptr,
+												   unsigned long int i_bound )
+{
+	//local variables
+	int j;
+	unsigned int tempmin, tempmax;
+	unsigned long int difference;
+	
+	//zero out difference for newest character
+	difference = 0;
+	
+	//check all activity measure differences
+	for( j = 0; j < i_alphabet_ptr->num_activity_regions; j++ )
+	{
+		difference += AUCR_Activity_Difference( i_character_ptr->activity_measures[j],
+											   i_prototype_ptr->activity_measures[j],
+											   i_alphabet_ptr->bias[j] );
+	}
+	
+	//skip remainder of this checking this character if
+	//we are already sure that this character is not the
+	//closest
+	if( difference > i_bound )
+	{
+		return( difference );
+	}
+	
+	//check all directional code differences
+	for( j = 0; j < i_alphabet_ptr->num_directional_codes; j++ )
+	{
+		if( i_character_ptr->directional_codes[j] <
+		   i_prototype_ptr->directional_codes[j] )
+		{
+			tempmax = i_prototype_ptr->directional_codes[j];
+			tempmin = i_character_ptr->directional_codes[j];
+		}
+		else
+		{
+			tempmin = i_prototype_ptr->directional_codes[j];
+			tempmax = i_character_ptr->directional_codes[j];
+		}
+		if( ( tempmax - tempmin ) <
+		   ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
+			+ tempmin - tempmax ) )
+		{
+			difference += ( ( tempmax - tempmin ) 
+						   * ( tempmax - tempmin ) * AUCR_SCALE );
+		}
+		else
+		{
+			difference +=
+			( ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
+			   + tempmin - tempmax )
+			 * ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
+				+ tempmin - tempmax ) * AUCR_SCALE );
+		}
+		
+		//every AUCR_BLOCK_CODES codes, give up on this character
+		//if it is already farther than the closest character
+		if( ( ( j + 1 ) % AUCR_BLOCK_CODES == 0 ) && ( difference > i_bound ) )
+		{
+			return( difference );
+		}
+	}
+	
+	return( difference );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Closest()
+ *	Description:
+ *		finds the character of the alphabet that is closest to a character,
+ *		skipping a character as soon as it is farther than the closest so far
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet to scan
+ *		i_character_ptr -> character being recognized
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet of at least one character and
+ *		i_character_ptr agrees with it in size
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the index of the closest character in the alphabet
+ */
+static int AUCR_Alphabet_Closest(
+								 const AUCR_Alphabet * i_alphabet_ptr,
+								 const AUCR_Character * i_character_ptr )
+{
+	//local variables
+	int i;
+	unsigned int minindex = 0;
+	unsigned long int difference, mindifference = 0;
+	
+	//check new character against each character in the alphabet, giving up on
+	//each as soon as it is farther than the closest so far
+	for( i = 0; i < i_alphabet_ptr->num_characters; i++ )
+	{
+		difference = AUCR_Prototype_Difference( i_alphabet_ptr, i_character_ptr,
+											   i_alphabet_ptr->characters_ptr_ptr[i],
+											   ( i == 0 ) ? ULONG_MAX : mindifference );
+		
+		//check to see if this character is closer than previous
+		//closest character
+		if( ( difference < mindifference ) || ( i == 0 ) )
+		{
+			mindifference = difference;
+			minindex = i;
+		}
+		
+	}
+	return( minindex );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Closest_Of_Classes()
+ *	Description:
+ *		finds the character closest to a character among only the classes of a
+ *		filter, following each class from the alphabet's table of classes, so the
+ *		characters of other classes are never read.  the character of those classes
+ *		that comes first in the alphabet is checked first and without a bound, as
+ *		AUCR_Alphabet_Closest() checks its first character, and ties go to the
+ *		character that comes first in the alphabet, so the result is what
+ *		AUCR_Alphabet_Closest() would find in an alphabet of only those classes.
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet to look in
+ *		i_character_ptr -> character being recognized
+ *		i_filter_ptr -> filter of the unicode values that may be found
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet, i_character_ptr agrees with it in size,
+ *		and i_filter_ptr is a valid filter
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the closest character of the filter's classes, or NULL if they have none
+ */
+static AUCR_Character_Ptr AUCR_Alphabet_Closest_Of_Classes(
+														   const AUCR_Alphabet * i_alphabet_ptr,
+														   const AUCR_Character * i_character_ptr,
+														   const AUCR_Class_Filter * i_filter_ptr )
+{
+	//local variables
+	int i;
+	AUCR_Class_Ptr tempclass;
+	AUCR_Character_Ptr tempchar, firstchar = NULL;
+	AUCR_Character_Ptr minchar;
+	unsigned long int difference, mindifference;
+	
+	//find the character of the filter's classes that comes first in the alphabet
+	for( i = 0; i < i_filter_ptr->num_unicodes; i++ )
+	{
+		tempclass = AUCR_Alphabet_Find_Class( i_alphabet_ptr, i_filter_ptr->unicodes[i] );
+		if( tempclass == NULL )
+		{
+			continue;
+		}
+		for( tempchar = tempclass->first_prototype; tempchar != NULL;
+			tempchar = ( (AUCR_Slot *)tempchar )->next_prototype )
+		{
+			if( firstchar == NULL ||
+			   ( (AUCR_Slot *)tempchar )->index < ( (AUCR_Slot *)firstchar )->index )
+			{
+				firstchar = tempchar;
+			}
+		}
+	}
+	if( firstchar == NULL )
+	{
+		return( NULL );
+	}
+	
+	//the first character is the closest until a closer one is found
+	minchar = firstchar;
+	mindifference = AUCR_Prototype_Difference( i_alphabet_ptr, i_character_ptr, firstchar, ULONG_MAX );
+	
+	//check new character against every other character of the filter's classes
+	for( i = 0; i < i_filter_ptr->num_unicodes; i++ )
+	{
+		tempclass = AUCR_Alphabet_Find_Class( i_alphabet_ptr, i_filter_ptr->unicodes[i] );
+		if( tempclass == NULL )
+		{
+			continue;
+		}
+		for( tempchar = tempclass->first_prototype; tempchar != NULL;
+			tempchar = ( (AUCR_Slot *)tempchar )->next_prototype )
+		{
+			if( tempchar == firstchar )
+			{
+				continue;
+			}
+			difference = AUCR_Prototype_Difference( i_alphabet_ptr, i_character_ptr, tempchar,
+												   mindifference );
+			
+			//keep the closest, or the first in the alphabet of the closest
+			if( difference < mindifference ||
+			   ( difference == mindifference &&
+				( (AUCR_Slot *)tempchar )->index < ( (AUCR_Slot *)minchar )->index ) )
+			{
+				mindifference = difference;
+				minchar = tempchar;
+			}
+		}
+	}
+	
+	return( minchar );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Recognize_Path()
+ *	Description:
+ *		finds the character in the alphabet that is closest to raw coordinates,
+ *		going from the raw coordinates straight to the features of the workspace's
+ *		character with AUCR_Resample_Features(), without an interpolated character
+ *	Parameters:
+ *		i_num_coordinates -> number of raw coordinates supplied
+ *		i_coordinates -> array of raw coordinates of length i_num_coordinates
+ *		i_distances -> arc length from the first coordinate to each coordinate, or
+ *						NULL to find it in the workspace
+ *		i_alphabet_ptr -> pointer to alphabet to search against
+ *		o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *		io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *								allocate it for this call only
+ *	Preconditions:
+ *		i_num_coordinates is positive, i_coordinates and i_distances hold that many
+ *		entries, i_alphabet_ptr is a valid alphabet of at least one character
+ *	Postconditions:
+ *		the closest character in the alphabet has been found, and its unicode value
+ *		is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_NO_MEMORY if the workspace memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if the workspace was made for another geometry
+ */
+static AUCR_Error AUCR_Alphabet_Recognize_Path(
+											   int i_num_coordinates,
+											   const AUCR_Coordinate * i_coordinates,
+											   const unsigned int * i_distances,
+											   const AUCR_Alphabet * i_alphabet_ptr,
+											   const AUCR_Class_Filter * i_filter_ptr,
+											   wchar_t * o_unicode_ptr,
+											   AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Workspace_Ptr tempworkspace = NULL;
+	AUCR_Error temperror;
+	AUCR_Character_Ptr tempchar;
+	
+	//use the workspace given, or create one for this call
+	if( io_workspace_ptr != NULL )
+	{
+		if( !AUCR_Workspace_Fits( io_workspace_ptr, i_alphabet_ptr->num_directional_codes,
+								 i_alphabet_ptr->num_activity_regions,
+								 i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ) )
+		{
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		tempworkspace = io_workspace_ptr;
+	}
+	else
+	{
+		temperror = AUCR_WORKSPACE_Init( i_alphabet_ptr, &tempworkspace );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	
+	//find the arc lengths in the workspace unless they were given
+	if( i_distances == NULL )
+	{
+		if( AUCR_WORKSPACE_Reserve( i_num_coordinates, tempworkspace ) != AUCR_ERR_SUCCESS )
+		{
+			if( io_workspace_ptr == NULL )
+			{
+				AUCR_WORKSPACE_Release( &tempworkspace );
+			}
+			return( AUCR_ERR_NO_MEMORY );
+		}
+		AUCR_Arc_Lengths( i_num_coordinates, i_coordinates, tempworkspace->distances );
+		i_distances = tempworkspace->distances;
+	}
+	
+	//go from the raw coordinates straight to the features of the character
+	AUCR_Resample_Features( i_num_coordinates, i_coordinates, i_distances,
+						   i_alphabet_ptr->num_directional_codes, i_alphabet_ptr->directional_code_map_ptr,
+						   i_alphabet_ptr->num_activity_regions, i_alphabet_ptr->activity_regions,
+						   tempworkspace->hits, tempworkspace->character.directional_codes,
+						   tempworkspace->character.activity_measures );
+	
+	//retrieve unicode value of closest character and place in o_unicode_ptr,
+	//looking only in the filter's classes if there is a filter
+	if( i_filter_ptr == NULL )
+	{
+		( *o_unicode_ptr ) = i_alphabet_ptr->characters_ptr_ptr[
+			AUCR_Alphabet_Closest( i_alphabet_ptr, &( tempworkspace->character ) )]->unicode;
+	}
+	else
+	{
+		tempchar = AUCR_Alphabet_Closest_Of_Classes( i_alphabet_ptr, &( tempworkspace->character ),
+													i_filter_ptr );
+		( *o_unicode_ptr ) = ( tempchar != NULL ) ? tempchar->unicode : 0x0000;
+	}
+	
+	//free workspace memory unless it was given
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_WORKSPACE_Release( &tempworkspace );
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Scan()
+ *	Description:
+ *		finds the characters of the alphabet that are closest to a character,
+ *		keeping them in a bounded max-heap of candidates.  a character is given up
+ *		on as soon as it is farther than the farthest candidate of a full heap, so a
+ *		heap that already holds close candidates makes the scan cheap.
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet to scan
+ *		i_character_ptr -> character being recognized
+ *		i_max_candidates -> number of candidates the heap may hold
+ *		io_candidates <-> array of i_max_candidates candidates kept as a max-heap
+ *		io_num_candidates_ptr <-> number of candidates in the heap
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet, i_character_ptr agrees with it in size,
+ *		i_max_candidates is positive and the heap holds only characters of the alphabet
+ *		with their differences from i_character_ptr
+ *	Postconditions:
+ *		io_candidates holds the closest of its old candidates and the characters
+ *	Returns:
+ *		none
+ */
+static void AUCR_Alphabet_Scan(
+							   const AUCR_Alphabet * i_alphabet_ptr,
+							   const AUCR_Character * i_character_ptr,
+							   int i_max_candidates,
+							   AUCR_Candidate * io_candidates,
+							   int * io_num_candidates_ptr )
+{
+	//local variables
+	AUCR_Character_Ptr protochar;
+	int i, j;
+	unsigned int tempmin, tempmax;
+	unsigned long int difference;
+	
+	//check new character against each character in the alphabet
+	for( i = 0; i < i_alphabet_ptr->num_characters; i++ )
+	{
+		protochar = i_alphabet_ptr->characters_ptr_ptr[i];
+		
+		//zero out difference for newest character
+		difference = 0;
+		
+		//check all activity measure differences
+		for( j = 0; j < i_alphabet_ptr->num_activity_regions; j++ )
+		{
+			difference += AUCR_Activity_Difference( i_character_ptr->activity_measures[j],
+												   protochar->activity_measures[j], i_alphabet_ptr->bias[j] );
+		}
+		
+		//skip remainder of this checking this character if
+		//we are already sure that this character is not one
+		//of the closest
+		if( ( ( *io_num_candidates_ptr ) == i_max_candidates ) &&
+		   ( difference > io_candidates[0].difference ) )
+		{
+			continue;
+		}
+		
+		//check all directional code differences
+		for( j = 0; j < i_alphabet_ptr->num_directional_codes; j++ )
+		{
+			if( i_character_ptr->directional_codes[j] < protochar->directional_codes[j] )
+			{
+				tempmax = protochar->directional_codes[j];
+				tempmin = i_character_ptr->directional_codes[j];
+			}
+			else
+			{
+				tempmin = protochar->directional_codes[j];
+				tempmax = i_character_ptr->directional_codes[j];
+			}
+			if( ( tempmax - tempmin ) <
+			   ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
+				+ tempmin - tempmax ) )
+			{
+				difference += ( ( tempmax - tempmin ) 
+							   * ( tempmax - tempmin ) * AUCR_SCALE );
+			}
+			else
+			{
+				difference +=
+				( ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
+				   + tempmin - tempmax )
+				 * ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
+					+ tempmin - tempmax ) * AUCR_SCALE );
+			}
+			
+			//every AUCR_BLOCK_CODES codes, give up on this character
+			//if it is already farther than the farthest candidate
+			if( ( ( j + 1 ) % AUCR_BLOCK_CODES == 0 ) &&
+			   ( ( *io_num_candidates_ptr ) == i_max_candidates ) &&
+			   ( difference > io_candidates[0].difference ) )
+			{
+				break;
+			}
+		}
+		if( j < i_alphabet_ptr->num_directional_codes )
+		{
+			continue;
+		}
+		
+		//keep this character if it is one of the closest so far
+		AUCR_Candidates_Offer( io_candidates, io_num_candidates_ptr, i_max_candidates,
+							  protochar->unicode, i, difference );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Difference()
+ *	Description:
+ *		finds the whole difference between a character and one character of the
+ *		alphabet, as AUCR_Alphabet_Scan() finds it for a character it does not give
+ *		up on.
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet holding the character to check against
+ *		i_character_ptr -> character being recognized
+ *		i_index -> index in the alphabet of the character to check against
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet, i_character_ptr agrees with it in size,
+ *		and i_index is within it
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the difference between the two characters
+ */
+static unsigned long int AUCR_Alphabet_Difference(
+												  const AUCR_Alphabet * i_alphabet_ptr,
+												  const AUCR_Character * i_character_ptr,
+												  int i_index )
+{
+	//local variables
+	AUCR_Character_Ptr protochar;
+	int j, mappable;
+	unsigned int tempmin, tempmax;
+	unsigned long int difference;
+	
+	protochar = i_alphabet_ptr->characters_ptr_ptr[i_index];
+	mappable = i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes;
+	
+	//add up all activity measure differences
+	difference = 0;
+	for( j = 0; j < i_alphabet_ptr->num_activity_regions; j++ )
+	{
+		difference += AUCR_Activity_Difference( i_character_ptr->activity_measures[j],
+											   protochar->activity_measures[j], i_alphabet_ptr->bias[j] );
+	}
+	
+	//add up all directional code differences, the shorter way around
+	for( j = 0; j < i_alphabet_ptr->num_directional_codes; j++ )
+	{
+		tempmin = ( i_character_ptr->directional_codes[j] < protochar->directional_codes[j] ) ?
+		i_character_ptr->directional_codes[j] : protochar->directional_codes[j];
+		tempmax = ( i_character_ptr->directional_codes[j] < protochar->directional_codes[j] ) ?
+		protochar->directional_codes[j] : i_character_ptr->directional_codes[j];
+		if( ( tempmax - tempmin ) < ( mappable + tempmin - tempmax ) )
+		{
+			difference += ( ( tempmax - tempmin ) * ( tempmax - tempmin ) * AUCR_SCALE );
+		}
+		else
+		{
+			difference += ( ( mappable + tempmin - tempmax ) * ( mappable + tempmin - tempmax ) * AUCR_SCALE );
+		}
+	}
+	
+	return( difference );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Microseconds()
+ *	Description:
+ *		reads a monotonic wall clock, so that the latency counts the time the
+ *		user waits, however it is shared with other threads.  where there is no
+ *		monotonic clock, clock()'s processor time is read instead.
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the clock's time in microseconds, wrapping around, so only the difference
+ *		of two readings means anything
+ */
+static unsigned long int AUCR_Microseconds( void )
+{
+#if defined( CLOCK_MONOTONIC )
+	//local variables
+	struct timespec now;
+	
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	
+	return( ( (unsigned long int)now.tv_sec * 1000000UL ) + ( (unsigned long int)now.tv_nsec / 1000UL ) );
+#else
+	return( (unsigned long int)( ( (unsigned long long int)clock() * 1000000ULL ) / CLOCKS_PER_SEC ) );
+#endif
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Progressive_Character()
+ *	Description:
+ *		converts a stroke into the character of a progressive recognizer's workspace
+ *	Parameters:
+ *		i_stroke_ptr -> stroke to convert
+ *		io_progressive_ptr <-> progressive recognizer whose workspace to convert into
+ *	Preconditions:
+ *		i_stroke_ptr is a valid stroke of at least one coordinate and
+ *		io_progressive_ptr is a valid progressive recognizer
+ *	Postconditions:
+ *		the character of the workspace is the character of the stroke
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+static AUCR_Error AUCR_Progressive_Character(
+											 const AUCR_Stroke * i_stroke_ptr,
+											 AUCR_Progressive_Ptr io_progressive_ptr )
+{
+	//local variables
+	AUCR_Workspace_Ptr tempworkspace;
+	AUCR_Error temperror;
+	
+	tempworkspace = io_progressive_ptr->workspace_ptr;
+	
+	temperror = AUCR_INTERPOLATED_CHARACTER_From_Stroke( i_stroke_ptr,
+														&( tempworkspace->interpolated_character ) );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	
+	return( AUCR_CHARACTER_From_Interpolated( &( tempworkspace->interpolated_character ),
+											 io_progressive_ptr->alphabet_ptr,
+											 &( tempworkspace->character ), tempworkspace ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_CHARACTER_From_Interpolated()
+ *	Description:
+ *		takes in an interpolated character and an alphabet and forms the character
+ *		representation of the interpolated character based on the alphabet.
+ *	Parameters:
+ *		i_interpolated_character_ptr -> a pointer to an interpolated character
+ *		i_alphabet_ptr -> a pointer to an alphabet
+ *		io_character_ptr <-> a pointer to a character that we will fill in
+ *		io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *								allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is non NULL and is a pointer to a valid
+ *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
+ *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
+ *		character, num_directional_codes between the alphabet and the interpolated
+ *		are in agreement
+ *	Postconditions:
+ *		io_character_ptr is populated with the character version of the
+ *		interpolated character
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_CHARACTER_From_Interpolated(
+											const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+											const AUCR_Alphabet * i_alphabet_ptr,
+											AUCR_Character_Ptr io_character_ptr,
+											AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	int * hits;
+	
+	//check for valid input
+	if( i_interpolated_character_ptr == NULL ||
+	   i_alphabet_ptr == NULL || io_character_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	else if( i_interpolated_character_ptr->num_directional_codes
+			!= i_alphabet_ptr->num_directional_codes ||
+			i_interpolated_character_ptr->num_directional_codes
+			!= io_character_ptr->num_directional_codes ||
+			io_character_ptr->num_directional_codes
+			!= i_alphabet_ptr->num_directional_codes )
+	{
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+	}
+	
+	//take hits from the workspace, or allocate them for this call
+	if( io_workspace_ptr != NULL )
+	{
+		if( !AUCR_Workspace_Fits( io_workspace_ptr, i_alphabet_ptr->num_directional_codes,
+								 i_alphabet_ptr->num_activity_regions,
+								 i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ) )
+		{
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		hits = io_workspace_ptr->hits;
+	}
+	else
+	{
+		hits = (int *)calloc( ( i_alphabet_ptr->num_directional_codes + 2 ) *
+							 i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes,
+							 sizeof( int ) );
+		if( hits == NULL )
+		{
+			return( AUCR_ERR_NO_MEMORY );
+		}
+	}
+	
+	AUCR_Extract_Features( i_interpolated_character_ptr->coordinates,
+						  i_alphabet_ptr->num_directional_codes, i_alphabet_ptr->directional_code_map_ptr,
+						  i_alphabet_ptr->num_activity_regions, i_alphabet_ptr->activity_regions,
+						  hits, io_character_ptr->directional_codes, io_character_ptr->activity_measures );
+	
+	if( io_workspace_ptr == NULL )
+	{
+		free( hits );
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INTERPOLATED_CHARACTER_Init()
+ *	Description:
+ *		Initializes a new AUCR_Interpolated_Character instance by allocating appropriate
+ *		memories and setting member values.
+ *	Parameters:
+ *		i_unicode -> the unicode value to be represented by the structure.
+ *		i_num_directional_codes -> (i_num_directional_codes + 1) elements of the
+ *							coordinates vector must have memory allocated.
+ *		o_interpolated_character_ptr_ptr <- address of the AUCR_Interpolated_Character_Ptr
+ *							to be populated with the new AUCR_Interpolated_Character.
+ *	Preconditions:
+ *		i_num_directional_codes must be positive and non-zero.  i_unicode should not be
+ *		0x0000 which is reserved as an error character.  The AUCR_Interpolated_Character_Ptr
+ *		at o_interpolated_character_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_character_ptr_Ptr is the address of a newly allocated and initialized
+ *		AUCR_Interpolated_Character_Ptr.  Its coordinates is a new array of
+ *		(num_directional_codes + 1) "AUCR_Coordinate"s.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_INTERPOLATED_CHARACTER_Init(
+											wchar_t i_unicode,
+											int i_num_directional_codes,
+											AUCR_Interpolated_Character_Ptr * o_interpolated_character_ptr_ptr )
+{
+	//check for valid input
+	if( ( i_unicode == 0x0000 ) || ( i_num_directional_codes < 1 ) ||
+	   ( o_interpolated_character_ptr_ptr == NULL ) ||
+	   ( ( * o_interpolated_character_ptr_ptr ) != NULL ) )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//malloc memory for character struct
+	( * o_interpolated_character_ptr_ptr ) = 
+	( AUCR_Interpolated_Character_Ptr )malloc( sizeof( AUCR_Interpolated_Character ) );
+	if( ( * o_interpolated_character_ptr_ptr ) == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//malloc memory for coordinates
+	( * o_interpolated_character_ptr_ptr )->coordinates = 
+	( AUCR_Coordinate_Ptr )malloc( (i_num_directional_codes + 1 ) 
+								  * sizeof( AUCR_Coordinate ) );
+	if( ( * o_interpolated_character_ptr_ptr )->coordinates == NULL )
+	{
+		free( * o_interpolated_character_ptr_ptr );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//memory allocations successful
+	//now fill in fields
+	( * o_interpolated_character_ptr_ptr )->unicode = i_unicode;
+	( * o_interpolated_character_ptr_ptr )->num_directional_codes = 
+	i_num_directional_codes;
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INTERPOLATED_CHARACTER_Release()
+ *	Description:
+ *		Frees all dynamically allocated memories for the AUCR_Interpolated_Character and NULLs
+ *		the AUCR_Interpolated_Character_Ptr.
+ *	Parameters:
+ *		io__interpolatedcharacter_ptr <-> address of the AUCR_Interpolated_Character memory to be freed.
  *	Preconditions:
  *		io__interpolatedcharacter_ptr is a valid address of an AUCR_Interpolated_Character.
  *	Postconditions:
- *		The character's coordinate array is freed followed by the memory for the
- *		character as well.  io_interpolated_character_ptr is NULL.
+ *		The character's coordinate array is freed followed by the memory for the
+ *		character as well.  io_interpolated_character_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_INTERPOLATED_CHARACTER_Release(
+										 AUCR_Interpolated_Character_Ptr * io_interpolated_character_ptr_ptr )
+{
+	//check for valid input
+	if( ( io_interpolated_character_ptr_ptr == NULL ) ||
+	   ( ( * io_interpolated_character_ptr_ptr ) == NULL ) )
+	{
+		return;
+	}
+	
+	//free coordinate array
+	free( ( * io_interpolated_character_ptr_ptr )->coordinates );
+	
+	//free character structure
+	free( ( * io_interpolated_character_ptr_ptr ) );
+	
+	//set pointer to null
+	( * io_interpolated_character_ptr_ptr ) = NULL;
+	
+	return;
+	
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INTERPOLATED_CHARACTER_From_Raw()
+ *	Description:
+ *		Converts an array of AUCR_Coordinates (captured by a GUI) to an AUCR_Interpolated_Character.
+ *	Parameters:
+ *		i_num_coordinates -> i_number of coordinates in the i_coordinates array.
+ *		i_coordinates -> array of raw pen coordinates
+ *		io_interpolated_character_ptr <-> address of the AUCR_Interpolated_Character
+ *								to be populated from the raw data
+ *		io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *								allocate it for this call only
+ *	Preconditions:
+ *		io_interpolated_character_ptr is a valid address of an initialized AUCR_Interpolated_Character.
+ *	Postconditions:
+ *		io_interpolated_character_ptr is populated with the interpolated version if the raw
+ *		coordinates.  i_coordinates is unchanged, short strokes are scaled up as they are read.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Raw(
+												int i_num_coordinates,
+												const AUCR_Coordinate * i_coordinates,
+												AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr,
+												AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//declare variables
+	//array of distances for each point
+	unsigned int * distances;
+	
+	//check for valid input
+	if( io_interpolated_character_ptr == NULL ||
+	   i_num_coordinates < 1 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//get memory for distance array, from the workspace if there is one
+	if( io_workspace_ptr != NULL )
+	{
+		if( AUCR_WORKSPACE_Reserve( i_num_coordinates, io_workspace_ptr ) != AUCR_ERR_SUCCESS )
+		{
+			return( AUCR_ERR_NO_MEMORY );
+		}
+		distances = io_workspace_ptr->distances;
+	}
+	else
+	{
+		distances = (unsigned int *)malloc( i_num_coordinates * sizeof( unsigned int ) );
+		if( distances == NULL )
+		{
+			return( AUCR_ERR_NO_MEMORY );
+		}
+	}
+	
+	//find the arc length to each coordinate
+	AUCR_Arc_Lengths( i_num_coordinates, i_coordinates, distances );
+	
+	//resample the coordinates along the distances
+	AUCR_Resample( i_num_coordinates, i_coordinates, distances, io_interpolated_character_ptr );
+	
+	//free distance memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		free( distances );
+	}
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Init()
+ *	Description:
+ *		Initializes a new, empty AUCR_Stroke with room for AUCR_STROKE_COORDINATES
+ *		coordinates.
+ *	Parameters:
+ *		o_stroke_ptr_ptr <- address of the AUCR_Stroke_Ptr to be populated with the
+ *							new AUCR_Stroke.
+ *	Preconditions:
+ *		The AUCR_Stroke_Ptr at o_stroke_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_stroke_ptr_ptr is the address of a newly allocated AUCR_Stroke with no
+ *		coordinates and a tolerance of 0, so that it keeps every coordinate.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_STROKE_Init(
+							AUCR_Stroke_Ptr * o_stroke_ptr_ptr )
+{
+	//check for valid input
+	if( ( o_stroke_ptr_ptr == NULL ) || ( ( * o_stroke_ptr_ptr ) != NULL ) )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//malloc memory for stroke struct
+	( * o_stroke_ptr_ptr ) = ( AUCR_Stroke_Ptr )malloc( sizeof( AUCR_Stroke ) );
+	if( ( * o_stroke_ptr_ptr ) == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//malloc memory for coordinates and distances
+	( * o_stroke_ptr_ptr )->coordinates =
+	( AUCR_Coordinate_Ptr )malloc( AUCR_STROKE_COORDINATES * sizeof( AUCR_Coordinate ) );
+	( * o_stroke_ptr_ptr )->distances =
+	(unsigned int *)malloc( AUCR_STROKE_COORDINATES * sizeof( unsigned int ) );
+	if( ( * o_stroke_ptr_ptr )->coordinates == NULL || ( * o_stroke_ptr_ptr )->distances == NULL )
+	{
+		AUCR_STROKE_Release( o_stroke_ptr_ptr );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//memory allocations successful
+	//now fill in fields
+	( * o_stroke_ptr_ptr )->num_coordinates = 0;
+	( * o_stroke_ptr_ptr )->max_coordinates = AUCR_STROKE_COORDINATES;
+	( * o_stroke_ptr_ptr )->tolerance = 0;
+	( * o_stroke_ptr_ptr )->num_dropped = 0;
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Release()
+ *	Description:
+ *		Frees all memories of the AUCR_Stroke and the structure itself, and NULLs
+ *		the AUCR_Stroke_Ptr.
+ *	Parameters:
+ *		io_stroke_ptr_ptr <-> address of the AUCR_Stroke to be freed.
+ *	Preconditions:
+ *		The AUCR_Stroke_Ptr at io_stroke_ptr_ptr is NULL or the address of an
+ *		AUCR_Stroke created by AUCR_STROKE_Init().
+ *	Postconditions:
+ *		all memory of the stroke is freed and the AUCR_Stroke_Ptr at
+ *		io_stroke_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_STROKE_Release(
+						 AUCR_Stroke_Ptr * io_stroke_ptr_ptr )
+{
+	if( io_stroke_ptr_ptr == NULL || ( *io_stroke_ptr_ptr ) == NULL )
+	{
+		return;
+	}
+	
+	free( ( *io_stroke_ptr_ptr )->coordinates );
+	free( ( *io_stroke_ptr_ptr )->distances );
+	free( *io_stroke_ptr_ptr );
+	( *io_stroke_ptr_ptr ) = NULL;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Clear()
+ *	Description:
+ *		empties a stroke so that a new one can be drawn into it, keeping its memory
+ *		and its tolerance.
+ *	Parameters:
+ *		io_stroke_ptr <-> pointer to the stroke to empty
+ *	Preconditions:
+ *		io_stroke_ptr is a valid stroke
+ *	Postconditions:
+ *		the stroke has no coordinates
+ *	Returns:
+ *		none
+ */
+void AUCR_STROKE_Clear(
+					   AUCR_Stroke_Ptr io_stroke_ptr )
+{
+	if( io_stroke_ptr == NULL )
+	{
+		return;
+	}
+	
+	io_stroke_ptr->num_coordinates = 0;
+	io_stroke_ptr->num_dropped = 0;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Add_Coordinate()
+ *	Description:
+ *		adds the next raw pen coordinate to a stroke as it is drawn, and adds the
+ *		length of the segment to it to the stroke's arc length, so that nothing but
+ *		the resampling is left to do once the stroke is finished.  a coordinate
+ *		that repeats the last one adds no length and could not change the
+ *		interpolated character, so it is dropped.  the stroke at least doubles its
+ *		room whenever it must grow.
+ *
+ *		a stroke with a tolerance also decimates the coordinates as they come: the
+ *		last coordinate is dropped, and the new one ends the last segment in its
+ *		place, whenever it and every coordinate already dropped for that segment are
+ *		within the tolerance of the longer segment.  no coordinate drawn is then
+ *		farther than the tolerance from the stroke kept, and one segment stands for
+ *		at most AUCR_STROKE_RUN coordinates, so a slow stroke from a fast digitizer
+ *		keeps only the coordinates that change its shape.
+ *
+ *		the tolerance bounds only how far the raw coordinates kept are from those
+ *		drawn.  it does not bound the resampled character: the stroke kept is
+ *		shorter than the one drawn, so the interpolated coordinates may move by
+ *		more than the tolerance, and the directional codes, activity measures and
+ *		unicode recognized may differ from those the stroke would give with every
+ *		coordinate kept.  a tolerance is therefore opt-in, and a new stroke has a
+ *		tolerance of 0.
+ *	Parameters:
+ *		i_x -> x of the raw coordinate
+ *		i_y -> y of the raw coordinate
+ *		io_stroke_ptr <-> pointer to the stroke to add to
+ *	Preconditions:
+ *		io_stroke_ptr is a valid stroke
+ *	Postconditions:
+ *		the coordinate ends the stroke, either added after the last coordinate or in
+ *		its place, and the stroke is unchanged if it could not be grown
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the array memories could not be grown
+ */
+AUCR_Error AUCR_STROKE_Add_Coordinate(
+									  int i_x,
+									  int i_y,
+									  AUCR_Stroke_Ptr io_stroke_ptr )
+{
+	//local variables
+	AUCR_Coordinate_Ptr tempcoordinates;
+	unsigned int * tempdistances;
+	const AUCR_Coordinate * start;
+	unsigned int length;
+	int tempnum, dropping, i;
+	int n;
+	
+	//check for valid input
+	if( io_stroke_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	n = io_stroke_ptr->num_coordinates;
+	
+	//drop a repeat of the last coordinate
+	if( n > 0 && io_stroke_ptr->coordinates[n - 1].x == i_x &&
+	   io_stroke_ptr->coordinates[n - 1].y == i_y )
+	{
+		return( AUCR_ERR_SUCCESS );
+	}
+	
+	//with a tolerance, let the last segment stand for the last coordinate too
+	//if it and every coordinate already dropped for the segment are close enough
+	if( io_stroke_ptr->tolerance > 0 && n > 1 && io_stroke_ptr->num_dropped < AUCR_STROKE_RUN &&
+	   ( io_stroke_ptr->coordinates[n - 2].x != i_x || io_stroke_ptr->coordinates[n - 2].y != i_y ) )
+	{
+		start = &( io_stroke_ptr->coordinates[n - 2] );
+		length = AUCR_Segment_Length( start->x, start->y, i_x, i_y );
+		dropping = AUCR_Within_Tolerance( start, i_x, i_y, length, &( io_stroke_ptr->coordinates[n - 1] ),
+										 io_stroke_ptr->tolerance );
+		for( i = 0; dropping && i < io_stroke_ptr->num_dropped; i++ )
+		{
+			dropping = AUCR_Within_Tolerance( start, i_x, i_y, length, &( io_stroke_ptr->dropped[i] ),
+											 io_stroke_ptr->tolerance );
+		}
+		if( dropping )
+		{
+			io_stroke_ptr->dropped[io_stroke_ptr->num_dropped] = io_stroke_ptr->coordinates[n - 1];
+			io_stroke_ptr->num_dropped++;
+			io_stroke_ptr->coordinates[n - 1].x = i_x;
+			io_stroke_ptr->coordinates[n - 1].y = i_y;
+			io_stroke_ptr->distances[n - 1] = io_stroke_ptr->distances[n - 2] + length;
+			return( AUCR_ERR_SUCCESS );
+		}
+	}
+	
+	//double the room when it is full, so that growing strokes grow it rarely
+	if( n == io_stroke_ptr->max_coordinates )
+	{
+		tempnum = 2 * io_stroke_ptr->max_coordinates;
+		
+		tempcoordinates = ( AUCR_Coordinate_Ptr )realloc( io_stroke_ptr->coordinates,
+														 tempnum * sizeof( AUCR_Coordinate ) );
+		if( tempcoordinates == NULL )
+		{
+			return( AUCR_ERR_NO_MEMORY );
+		}
+		io_stroke_ptr->coordinates = tempcoordinates;
+		
+		tempdistances = (unsigned int *)realloc( io_stroke_ptr->distances,
+												tempnum * sizeof( unsigned int ) );
+		if( tempdistances == NULL )
+		{
+			return( AUCR_ERR_NO_MEMORY );
+		}
+		io_stroke_ptr->distances = tempdistances;
+		io_stroke_ptr->max_coordinates = tempnum;
+	}
+	
+	//add the coordinate and the length of the segment to it
+	io_stroke_ptr->coordinates[n].x = i_x;
+	io_stroke_ptr->coordinates[n].y = i_y;
+	if( n == 0 )
+	{
+		io_stroke_ptr->distances[n] = 0;
+	}
+	else
+	{
+		io_stroke_ptr->distances[n] = io_stroke_ptr->distances[n - 1] +
+		AUCR_Segment_Length( io_stroke_ptr->coordinates[n - 1].x, io_stroke_ptr->coordinates[n - 1].y,
+							i_x, i_y );
+	}
+	io_stroke_ptr->num_coordinates = n + 1;
+	io_stroke_ptr->num_dropped = 0;
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INTERPOLATED_CHARACTER_From_Stroke()
+ *	Description:
+ *		Converts a stroke built up by AUCR_STROKE_Add_Coordinate() to an
+ *		AUCR_Interpolated_Character.  the arc length was kept as the stroke was
+ *		drawn, so only the resampling is done here, and the interpolated character
+ *		is the one AUCR_INTERPOLATED_CHARACTER_From_Raw() makes from the same
+ *		raw coordinates.
+ *	Parameters:
+ *		i_stroke_ptr -> pointer to the stroke to convert
+ *		io_interpolated_character_ptr <-> address of the AUCR_Interpolated_Character
+ *								to be populated from the stroke
+ *	Preconditions:
+ *		i_stroke_ptr is a valid stroke of at least one coordinate.
+ *		io_interpolated_character_ptr is a valid address of an initialized AUCR_Interpolated_Character.
+ *	Postconditions:
+ *		io_interpolated_character_ptr is populated with the interpolated version of the
+ *		stroke.  the stroke is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Stroke(
+												   const AUCR_Stroke * i_stroke_ptr,
+												   AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr )
+{
+	//check for valid input
+	if( i_stroke_ptr == NULL || io_interpolated_character_ptr == NULL ||
+	   i_stroke_ptr->num_coordinates < 1 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//resample the coordinates along the distances kept as they were added
+	AUCR_Resample( i_stroke_ptr->num_coordinates, i_stroke_ptr->coordinates,
+				  i_stroke_ptr->distances, io_interpolated_character_ptr );
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INTERPOLATED_CHARACTER_From_Character()
+ *	Description:
+ *		takes in a character and the alphabet that formed the character, as
+ *		well as a rectangle (in pixels) and the border inside the rectangle
+ *		and returns an interpolated character whose coordinates fill a
+ *		rectangle of the given size while always staying a distance of
+ *		border pixels from the edge of the rectangle.
+ *		note: this function is primarily intended to be used as a mechanism
+ *		to get points that can be written to screen, such that a character
+ *		may be displayed.  it does not return an interpolated character
+ *		that is identical to the interpolated character that was used to
+ *		create the character in the alphabet.
+ *	Parameters:
+ *		i_character_ptr -> a pointer to a character
+ *		i_alphabet_ptr -> a pointer to the alphabet that was used to create the character
+ *		i_rectangle_width -> the width in pixels of the bounding rectangle for the points
+ *										in the interpolated character
+ *		i_rectangle_height -> the height in pixels of the bounding rectangle for the points
+ *										in the interpolated character
+ *		i_rectangle_border -> the closest distance in pixels that any point in the
+ *										interpolated character can come to the edge of the
+ *										bounding rectangle
+ *		io_interpolated charactercharacter_ptr <-> a pointer to an interpolated character
+ *				that will be filled in by extrapolating information from the character
+ *	Preconditions:
+ *		io_interpolated_character_ptr is non NULL and is a pointer to a valid
+ *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
+ *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
+ *		character, i_rectangle_width is positive, i_rectangle_height is positive,
+ *		i_rectangle_border is non negative, and num_directional_codes between
+ *		the alphabet, character, and the interpolated character are in agreement
+ *	Postconditions:
+ *		io_interpolated_character_ptr is populated with the interpolated version of the
+ *		character in i_character_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Character(
+													  const AUCR_Character * i_character_ptr,
+													  const AUCR_Alphabet * i_alphabet_ptr,
+													  int i_rectangle_width,
+													  int i_rectangle_height,
+													  int i_rectangle_border,
+													  AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr )
+{
+	//local variables
+	int i, xoff, yoff, scale, div, nextDirCode;
+	int  xmin = 0, ymin = 0, xmax = 0, ymax = 0;
+	
+	//check for valid input
+	if( io_interpolated_character_ptr == NULL ||
+	   i_alphabet_ptr == NULL || i_character_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	else if( io_interpolated_character_ptr->num_directional_codes
+			!= i_alphabet_ptr->num_directional_codes ||
+			io_interpolated_character_ptr->num_directional_codes
+			!= i_character_ptr->num_directional_codes ||
+			i_character_ptr->num_directional_codes
+			!= i_alphabet_ptr->num_directional_codes )
+	{
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+	}
+	
+	//start at ( 0, 0 )
+	io_interpolated_character_ptr->coordinates[0].x = 0;
+	io_interpolated_character_ptr->coordinates[0].y = 0;
+	
+	//calculate remaining points, using a scale of AUCR_SCALE
+	//and an offset of ( 0, 0 )
+	for( i = 0; i < i_alphabet_ptr->num_directional_codes; i++ )
+	{
+		if( i_character_ptr->directional_codes[i] ==
+		   ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes - 1 ) )
+		{ 
+			nextDirCode = 0;
+		}
+		else
+		{
+			nextDirCode = i_character_ptr->directional_codes[i] + 1;
+		}
+		div = AUCR_Integer_Square_Root( 
+									   ( ( i_alphabet_ptr->directional_code_map_ptr->x[i_character_ptr->directional_codes[i]] +
+										  i_alphabet_ptr->directional_code_map_ptr->x[nextDirCode] ) *
+										( i_alphabet_ptr->directional_code_map_ptr->x[i_character_ptr->directional_codes[i]] +
+										 i_alphabet_ptr->directional_code_map_ptr->x[nextDirCode] ) ) +
+									   ( ( i_alphabet_ptr->directional_code_map_ptr->y[i_character_ptr->directional_codes[i]] +
+										  i_alphabet_ptr->directional_code_map_ptr->y[nextDirCode] ) *
+										( i_alphabet_ptr->directional_code_map_ptr->y[i_character_ptr->directional_codes[i]] +
+										 i_alphabet_ptr->directional_code_map_ptr->y[nextDirCode] ) ) );   
+		io_interpolated_character_ptr->coordinates[i + 1].x = ( AUCR_Rounding_Divide(
+																					 ( i_alphabet_ptr->directional_code_map_ptr->x[i_character_ptr->directional_codes[i]]
+																					  + i_alphabet_ptr->directional_code_map_ptr->x[nextDirCode] ) * AUCR_SCALE,
+																					 div ) + io_interpolated_character_ptr->coordinates[i].x );
+		io_interpolated_character_ptr->coordinates[i + 1].y = ( AUCR_Rounding_Divide(
+																					 ( i_alphabet_ptr->directional_code_map_ptr->y[i_character_ptr->directional_codes[i]]
+																					  + i_alphabet_ptr->directional_code_map_ptr->y[nextDirCode] ) * AUCR_SCALE,
+																					 div ) + io_interpolated_character_ptr->coordinates[i].y );
+		if( io_interpolated_character_ptr->coordinates[i + 1].x > xmax )
+		{
+			xmax = io_interpolated_character_ptr->coordinates[i + 1].x;
+		}
+		if( io_interpolated_character_ptr->coordinates[i + 1].x < xmin )
+		{
+			xmin = io_interpolated_character_ptr->coordinates[i + 1].x;
+		}
+		if( io_interpolated_character_ptr->coordinates[i + 1].y > ymax )
+		{
+			ymax = io_interpolated_character_ptr->coordinates[i + 1].y;
+		}
+		if( io_interpolated_character_ptr->coordinates[i + 1].y < ymin )
+		{
+			ymin = io_interpolated_character_ptr->coordinates[i + 1].y;
+		}
+	}
+	
+	//calculate scale and offsets to map points to rectangle 
+	if( ( ( ymax - ymin ) * i_rectangle_width ) > ( ( xmax - xmin ) * i_rectangle_height ) )
+	{
+		//y is the constraining direction
+		if( ( ymax - ymin ) < 10 * ( i_rectangle_height - ( 2 * i_rectangle_border ) ) )
+		{
+			scale = AUCR_Rounding_Divide( 
+										 20 * ( i_rectangle_height - ( 2 * i_rectangle_border ) ), ( ymax - ymin ) );
+			xmax = xmax * scale;
+			ymax = ymax * scale;
+			xmin = xmin * scale;
+			ymin = ymin * scale;
+			for( i = 0; i <= i_alphabet_ptr->num_directional_codes; i++ )
+			{
+				io_interpolated_character_ptr->coordinates[i].x =
+				io_interpolated_character_ptr->coordinates[i].x * scale;
+				io_interpolated_character_ptr->coordinates[i].y =
+				io_interpolated_character_ptr->coordinates[i].y * scale;
+			}
+		}
+		
+		scale = ( i_rectangle_height - ( 2 * i_rectangle_border ) );
+		div = ( ymax - ymin );
+		
+		yoff = i_rectangle_border - AUCR_Rounding_Divide( ymin * scale, div );
+		xoff = i_rectangle_border - AUCR_Rounding_Divide( xmin * scale, div )
+		+ AUCR_Rounding_Divide( i_rectangle_width - ( 2 * 
+													 i_rectangle_border ) - AUCR_Rounding_Divide( 
+																								 ( xmax - xmin ) * scale, div ), 2 );
+	}
+	else
+	{
+		//x is the constraining direction
+		if( ( xmax - xmin ) < 10 * ( i_rectangle_width - ( 2 * i_rectangle_border ) ) )
+		{
+			scale = AUCR_Rounding_Divide( 
+										 20 * ( i_rectangle_width - ( 2 * i_rectangle_border ) ), ( xmax - xmin ) );
+			xmax = xmax * scale;
+			ymax = ymax * scale;
+			xmin = xmin * scale;
+			ymin = ymin * scale; 
+			for( i = 0; i <= i_alphabet_ptr->num_directional_codes; i++ )
+			{
+				io_interpolated_character_ptr->coordinates[i].x =
+				io_interpolated_character_ptr->coordinates[i].x * scale;
+				io_interpolated_character_ptr->coordinates[i].y =
+				io_interpolated_character_ptr->coordinates[i].y * scale;
+			}
+		}
+		
+		scale = ( i_rectangle_width - ( 2 * i_rectangle_border ) );
+		div = ( xmax - xmin );
+		
+		xoff = i_rectangle_border - AUCR_Rounding_Divide( xmin * scale, div );
+		yoff = i_rectangle_border - AUCR_Rounding_Divide( ymin * scale, div )
+		+ AUCR_Rounding_Divide( i_rectangle_height - ( 2 * 
+													  i_rectangle_border ) - AUCR_Rounding_Divide( 
+																								  ( ymax - ymin ) * scale, div ), 2 );
+	}
+	
+	//loop through all points, scaling, then offsetting them
+	for( i = 0; i <= i_alphabet_ptr->num_directional_codes; i++ )
+	{
+		io_interpolated_character_ptr->coordinates[i].x = xoff +
+		AUCR_Rounding_Divide( 
+							 io_interpolated_character_ptr->coordinates[i].x * scale, div );
+		io_interpolated_character_ptr->coordinates[i].y = yoff +
+		AUCR_Rounding_Divide( 
+							 io_interpolated_character_ptr->coordinates[i].y * scale, div );
+	}
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_DIRECTIONAL_CODE_MAP_Init()
+ *	Description:
+ *		Initializes a new AUCR_Directional_Code_Map instance by allocating appropriate
+ *		memories and setting member values.
+ *	Parameters:
+ *		i_mappable_directional_codes -> i_number of unique directional codes to allocate memory
+ *							for their mappings.
+ *		o_directional_code_map_ptr_ptr <- memory address of the AUCR_Directional_Code_Map_Ptr
+ *							to be populated with the new AUCR_Directional_Code_Map.
+ *	Preconditions:
+ *		i_mappable_directional_codes must be a positive, non-zero values.
+ *		The AUCR_Directional_Code_Map_Ptr at o_directional_code_map_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_directional_code_map_ptr_ptr is the address of a newly allocated and initialized
+ *		AUCR_Directional_Code_Map_Ptr.  Its "x" and "y" variables are newly allocated arrays
+ *		of (mappable_directional_codes) elements... each element set to zero.  Its
+ *		"code_table" is NULL until it is finalized.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_DIRECTIONAL_CODE_MAP_Init(
+										  int i_mappable_directional_codes,
+										  AUCR_Directional_Code_Map_Ptr * o_directional_code_map_ptr_ptr )
+{
+	//declare local variables
+	int i;
+	
+	//check for valid input
+	if( ( i_mappable_directional_codes < 1 ) || ( o_directional_code_map_ptr_ptr == NULL )
+	   || ( ( * o_directional_code_map_ptr_ptr ) != NULL ) )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//malloc space for Directional_Code_Map
+	( * o_directional_code_map_ptr_ptr ) = 
+	( AUCR_Directional_Code_Map_Ptr )malloc( sizeof( AUCR_Directional_Code_Map ) );
+	if( ( * o_directional_code_map_ptr_ptr ) == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//malloc space for x array
+	( * o_directional_code_map_ptr_ptr )->x = 
+	(int *)malloc( sizeof( int ) * ( i_mappable_directional_codes ) );
+	if( ( * o_directional_code_map_ptr_ptr )->x == NULL )
+	{
+		free( * o_directional_code_map_ptr_ptr );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//malloc space for y array
+	( * o_directional_code_map_ptr_ptr )->y = 
+	(int *)malloc( sizeof( int ) * ( i_mappable_directional_codes ) );
+	if( ( * o_directional_code_map_ptr_ptr )->y == NULL )
+	{
+		free( * o_directional_code_map_ptr_ptr );
+		free( ( * o_directional_code_map_ptr_ptr )->x );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//memory allocation all good
+	//fill in structure
+	( * o_directional_code_map_ptr_ptr )->mappable_directional_codes = 
+	i_mappable_directional_codes;
+	( * o_directional_code_map_ptr_ptr )->code_table = NULL;
+	//zero out array entries
+	for( i = 0; i < ( i_mappable_directional_codes ); i++ )
+	{
+		( * o_directional_code_map_ptr_ptr )->x[i] = 0;
+		( * o_directional_code_map_ptr_ptr )->y[i] = 0;
+	}
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_DIRECTIONAL_CODE_MAP_Release()
+ *	Description:
+ *		Frees all dynamically allocated memories for the AUCR_Directional_Code_Map
+ *		and NULLs the AUCR_Directional_Code_Map_Ptr.
+ *	Parameters:
+ *		io_directional_code_map_ptr_ptr <-> address of the AUCR_Directional_Code_Map memory to be freed.
+ *	Preconditions:
+ *		The AUCR_Directional_Code_Map_Ptr at io_directional_code_map_ptr_ptr
+ *		is a valid address of an AUCR_Directional_Code_Map.
+ *	Postconditions:
+ *		The AUCR_Directional_Code_Map's "x", "y" and "code_table" arrays are freed
+ *		followed by the memory for the AUCR_Directional_Code_Map as well.
+ *		The AUCR_Directional_Code_Map_Ptr at io_directional_code_map_ptr_ptr
+ *		is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_DIRECTIONAL_CODE_MAP_Release(
+									   AUCR_Directional_Code_Map_Ptr * io_directional_code_map_ptr_ptr )
+{
+	//check for valid input
+	if( ( io_directional_code_map_ptr_ptr == NULL ) ||
+	   ( ( * io_directional_code_map_ptr_ptr ) == NULL ) )
+	{
+		return;
+	}
+	
+	//free code table
+	free( ( * io_directional_code_map_ptr_ptr )->code_table );
+	
+	//free y array
+	free( ( * io_directional_code_map_ptr_ptr )->y );
+	
+	//free x array
+	free( ( * io_directional_code_map_ptr_ptr )->x );
+	
+	//free Directional_Code_Map structure
+	free( * io_directional_code_map_ptr_ptr );
+	
+	//NULL the structure pointer
+	( * io_directional_code_map_ptr_ptr ) = NULL;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_DIRECTIONAL_CODE_MAP_Finalize()
+ *	Description:
+ *		Prepares a directional code map instance for use in converting from interpolated
+ *		characters to characters in the alphabet by setting up data structures required for
+ *		arbitrary directional code lookup from arbitrary vectors.
+ *	Parameters:
+ *		io_directional_code_map_ptr <- pointer to AUCR_Directional_Code_Map that has been
+ *							filled in completely with mappable_direction_codes (x, y) pairs.
+ *	Preconditions:
+ *		io_directional_code_map_ptr is non NULL and points to a valid directional code map
+ *		that has mappable_directional_codes (x,y) pairs that each describe the vector that
+ *		the begginning of a directional region, and all directional vectors, are in
+ *		counterclockwise order, starting from the zeroeth direcional code
+ *	Postconditions:
+ *		positive_begin, positive_end, negative_begin, and negative_end have all been set
+ *		to their appropriate values, and code_table has been filled in so that most
+ *		segments find their directional code with one load instead of a search.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the code table could not be allocated
+ */
+AUCR_Error AUCR_DIRECTIONAL_CODE_MAP_Finalize(
+											  AUCR_Directional_Code_Map_Ptr io_directional_code_map_ptr )
+{
+	//declare local variables
+	int i;
+	int posBeginX = 0;
+	int posBeginY = 1;
+	int posEndX = 0;
+	int posEndY = -1;
+	int negBeginX = 0;
+	int negBeginY = -1;
+	int negEndX = 0;
+	int negEndY = 1;
+	
+	
+	//check for valid input
+	if( io_directional_code_map_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//intitialize structure variables to their not found state
+	io_directional_code_map_ptr->positive_begin = -1;
+	io_directional_code_map_ptr->positive_end = -1;
+	io_directional_code_map_ptr->negative_begin = -1;
+	io_directional_code_map_ptr->negative_end = -1;
+	
+	//find correct values for structure variables, if they exist, with the
+	//products in 64 bits as the vectors may be any ints loaded from a file
+	for( i = 0; i < io_directional_code_map_ptr->mappable_directional_codes; i++ )
+	{
+		if( io_directional_code_map_ptr->x[i] > 0 )
+		{
+			if( ( (long long int)io_directional_code_map_ptr->x[i] * posBeginY ) >= ( (long long int)io_directional_code_map_ptr->y[i] * posBeginX ) )
+			{
+				io_directional_code_map_ptr->positive_begin = i;
+				posBeginX = io_directional_code_map_ptr->x[i];
+				posBeginY = io_directional_code_map_ptr->y[i];
+			}
+			if( ( (long long int)io_directional_code_map_ptr->x[i] * posEndY ) <= ( (long long int)io_directional_code_map_ptr->y[i] * posEndX ) )
+			{
+				io_directional_code_map_ptr->positive_end = i;
+				posEndX = io_directional_code_map_ptr->x[i];
+				posEndY = io_directional_code_map_ptr->y[i];
+			}
+		}
+		else
+		{
+			if( ( (long long int)io_directional_code_map_ptr->x[i] * negBeginY ) >= ( (long long int)io_directional_code_map_ptr->y[i] * negBeginX ) )
+			{
+				io_directional_code_map_ptr->negative_begin = i;
+				negBeginX = io_directional_code_map_ptr->x[i];
+				negBeginY = io_directional_code_map_ptr->y[i];
+			}
+			if( ( (long long int)io_directional_code_map_ptr->x[i] * negEndY ) <= ( (long long int)io_directional_code_map_ptr->y[i] * negEndX ) )
+			{
+				io_directional_code_map_ptr->negative_end = i;
+				negEndX = io_directional_code_map_ptr->x[i];
+				negEndY = io_directional_code_map_ptr->y[i];
+			}
+		}
+	}
+	
+	//malloc space for the code table, unless an earlier finalize did
+	if( io_directional_code_map_ptr->code_table == NULL )
+	{
+		io_directional_code_map_ptr->code_table =
+		(short *)malloc( sizeof( short ) * 8 * ( AUCR_CODE_TABLE_SLOPES + 1 ) );
+		if( io_directional_code_map_ptr->code_table == NULL )
+		{
+			return( AUCR_ERR_NO_MEMORY );
+		}
+	}
+	
+	//fill in the code table from the begins and ends
+	AUCR_Code_Table_Fill( io_directional_code_map_ptr );
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Grow()
+ *	Description:
+ *		makes sure an alphabet has a free slot for every character up to a number,
+ *		doubling its slots until it does.  the new slots are one new block, linked
+ *		in front of the blocks before it, and the ptrs to them are put past the
+ *		characters in characters_ptr_ptr.
+ *	Parameters:
+ *		i_num_characters -> number of characters the alphabet must have room for
+ *		io_alphabet_ptr <-> alphabet to grow
+ *	Preconditions:
+ *		io_alphabet_ptr is a valid alphabet
+ *	Postconditions:
+ *		max_characters is at least i_num_characters, and every ptr in
+ *		characters_ptr_ptr past num_characters is a free slot sized for the
+ *		alphabet, or no slots have been added if memory could not be allocated
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_NO_MEMORY if the character array or block could not be allocated
+ */
+static AUCR_Error AUCR_Alphabet_Grow(
+									 int i_num_characters,
+									 AUCR_Alphabet_Ptr io_alphabet_ptr )
+{
+	//local variables
+	int newmax, i;
+	unsigned long slotsize, headersize;
+	AUCR_Character_Ptr * tempptrs;
+	unsigned char * tempblock;
+	AUCR_Slot * tempslot;
+	
+	//nothing to do if there is already room
+	if( i_num_characters <= io_alphabet_ptr->max_characters )
+	{
+		return( AUCR_ERR_SUCCESS );
+	}
+	
+	//double the slots until there are enough
+	newmax = io_alphabet_ptr->max_characters;
+	if( newmax < AUCR_ALPHABET_BLOCK )
+	{
+		newmax = AUCR_ALPHABET_BLOCK;
+	}
+	while( newmax < i_num_characters )
+	{
+		newmax *= 2;
+	}
+	
+	//grow the character array, keeping the old one if this fails
+	tempptrs = (AUCR_Character_Ptr *)realloc( io_alphabet_ptr->characters_ptr_ptr,
+											 newmax * sizeof( AUCR_Character_Ptr ) );
+	if( tempptrs == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	io_alphabet_ptr->characters_ptr_ptr = tempptrs;
+	
+	//allocate one block for all of the new slots, each a character followed by
+	//its directional codes and activity measures
+	slotsize = AUCR_Round_Up( sizeof( AUCR_Slot ) +
+							 ( io_alphabet_ptr->num_directional_codes +
+							  io_alphabet_ptr->num_activity_regions ) * sizeof( int ),
+							 sizeof( AUCR_Character_Ptr ) );
+	headersize = AUCR_Round_Up( sizeof( void * ), sizeof( AUCR_Character_Ptr ) );
+	tempblock = (unsigned char *)malloc( headersize +
+										( newmax - io_alphabet_ptr->max_characters ) * slotsize );
+	if( tempblock == NULL )
+	{
+		//the larger character array is kept, it just has no more slots
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//link the block in front of the blocks before it
+	*( (void **)tempblock ) = io_alphabet_ptr->blocks;
+	io_alphabet_ptr->blocks = tempblock;
+	
+	//set up each slot and put its ptr past the characters
+	for( i = io_alphabet_ptr->max_characters; i < newmax; i++ )
+	{
+		tempslot = (AUCR_Slot *)( tempblock + headersize +
+								 ( i - io_alphabet_ptr->max_characters ) * slotsize );
+		tempslot->character.unicode = 0x0000;
+		tempslot->character.num_directional_codes = io_alphabet_ptr->num_directional_codes;
+		tempslot->character.num_activity_regions = io_alphabet_ptr->num_activity_regions;
+		tempslot->character.directional_codes = (int *)( tempslot + 1 );
+		tempslot->character.activity_measures =
+		tempslot->character.directional_codes + io_alphabet_ptr->num_directional_codes;
+		tempslot->next_prototype = NULL;
+		tempslot->index = i;
+		tempslot->published = NULL;
+		io_alphabet_ptr->characters_ptr_ptr[i] = &( tempslot->character );
+	}
+	io_alphabet_ptr->max_characters = newmax;
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Class_Probe()
+ *	Description:
+ *		probes a table of classes from the hash of a unicode value until it finds
+ *		the entry of that unicode value or an empty entry
+ *	Parameters:
+ *		i_classes -> table of classes to probe
+ *		i_max_classes -> number of entries in i_classes, a power of two
+ *		i_unicode -> unicode value to look for
+ *	Preconditions:
+ *		i_unicode is not 0x0000, and i_classes has at least one empty entry
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the index of the entry of i_unicode, or of the empty entry it would go in
+ */
+static int AUCR_Class_Probe(
+							const AUCR_Class * i_classes,
+							int i_max_classes,
+							wchar_t i_unicode )
+{
+	//local variables
+	unsigned int mask, i;
+	
+	//start from a multiplicative hash, which spreads runs of unicode values
+	mask = (unsigned int)( i_max_classes - 1 );
+	i = ( (unsigned int)i_unicode * 2654435761u ) & mask;
+	
+	//step over the entries of other unicode values
+	while( i_classes[i].unicode != 0x0000 && i_classes[i].unicode != i_unicode )
+	{
+		i = ( i + 1 ) & mask;
+	}
+	
+	return( (int)i );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Find_Class()
+ *	Description:
+ *		finds the class of a unicode value in an alphabet's table of classes
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet to look in
+ *		i_unicode -> unicode value to look for
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the class of i_unicode, or NULL if it is not in the table
+ */
+static AUCR_Class_Ptr AUCR_Alphabet_Find_Class(
+											   const AUCR_Alphabet * i_alphabet_ptr,
+											   wchar_t i_unicode )
+{
+	//local variables
+	int i;
+	
+	//an empty table has no classes, and 0x0000 marks empty entries
+	if( i_alphabet_ptr->max_classes == 0 || i_unicode == 0x0000 )
+	{
+		return( NULL );
+	}
+	
+	i = AUCR_Class_Probe( i_alphabet_ptr->classes, i_alphabet_ptr->max_classes, i_unicode );
+	if( i_alphabet_ptr->classes[i].unicode != i_unicode )
+	{
+		return( NULL );
+	}
+	
+	return( &( i_alphabet_ptr->classes[i] ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Add_Class()
+ *	Description:
+ *		finds the class of a unicode value in an alphabet's table of classes, adding
+ *		an empty class for it if it is not there.  a table that would be more than
+ *		half full is grown first, dropping the classes left with no characters.
+ *	Parameters:
+ *		i_unicode -> unicode value of the class
+ *		io_alphabet_ptr <-> alphabet to add the class to
+ *		o_class_ptr_ptr <- address of the AUCR_Class_Ptr to store the class in
+ *	Preconditions:
+ *		i_unicode is not 0x0000 and io_alphabet_ptr is a valid alphabet
+ *	Postconditions:
+ *		the class of i_unicode is in the table and stored at o_class_ptr_ptr, and
+ *		any class ptr found before may have moved
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_NO_MEMORY if the table could not be grown
+ */
+static AUCR_Error AUCR_Alphabet_Add_Class(
+										  wchar_t i_unicode,
+										  AUCR_Alphabet_Ptr io_alphabet_ptr,
+										  AUCR_Class_Ptr * o_class_ptr_ptr )
+{
+	//local variables
+	AUCR_Class_Ptr tempclasses;
+	int newmax, live, i, j;
+	
+	//the class may already be in the table
+	( *o_class_ptr_ptr ) = AUCR_Alphabet_Find_Class( io_alphabet_ptr, i_unicode );
+	if( ( *o_class_ptr_ptr ) != NULL )
+	{
+		return( AUCR_ERR_SUCCESS );
+	}
+	
+	//grow the table if one more class would fill more than half of it, leaving it
+	//at most a quarter full with only the classes that still have characters
+	if( ( io_alphabet_ptr->num_classes + 1 ) * 2 > io_alphabet_ptr->max_classes )
+	{
+		live = 0;
+		for( i = 0; i < io_alphabet_ptr->max_classes; i++ )
+		{
+			if( io_alphabet_ptr->classes[i].num_prototypes > 0 )
+			{
+				live++;
+			}
+		}
+		newmax = AUCR_ALPHABET_CLASSES;
+		while( newmax < ( live + 1 ) * 4 )
+		{
+			newmax *= 2;
+		}
+		
+		tempclasses = (AUCR_Class_Ptr)calloc( newmax, sizeof( AUCR_Class ) );
+		if( tempclasses == NULL )
+		{
+			return( AUCR_ERR_NO_MEMORY );
+		}
+		for( i = 0; i < io_alphabet_ptr->max_classes; i++ )
+		{
+			if( io_alphabet_ptr->classes[i].num_prototypes > 0 )
+			{
+				j = AUCR_Class_Probe( tempclasses, newmax, io_alphabet_ptr->classes[i].unicode );
+				tempclasses[j] = io_alphabet_ptr->classes[i];
+			}
+		}
+		
+		free( io_alphabet_ptr->classes );
+		io_alphabet_ptr->classes = tempclasses;
+		io_alphabet_ptr->max_classes = newmax;
+		io_alphabet_ptr->num_classes = live;
+	}
+	
+	//take the empty entry the unicode value probes to
+	j = AUCR_Class_Probe( io_alphabet_ptr->classes, io_alphabet_ptr->max_classes, i_unicode );
+	io_alphabet_ptr->classes[j].unicode = i_unicode;
+	io_alphabet_ptr->classes[j].num_prototypes = 0;
+	io_alphabet_ptr->classes[j].first_prototype = NULL;
+	io_alphabet_ptr->classes[j].last_prototype = NULL;
+	( io_alphabet_ptr->num_classes )++;
+	( *o_class_ptr_ptr ) = &( io_alphabet_ptr->classes[j] );
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Class_Append()
+ *	Description:
+ *		adds a character in an alphabet's slot to the end of a class
+ *	Parameters:
+ *		i_character_ptr -> character to add, in a slot of the alphabet
+ *		io_class_ptr <-> class to add it to
+ *	Preconditions:
+ *		i_character_ptr is in a slot and in no class, and has the unicode value of
+ *		io_class_ptr
+ *	Postconditions:
+ *		i_character_ptr is the last character of the class
+ *	Returns:
+ *		none
+ */
+static void AUCR_Class_Append(
+							  AUCR_Character_Ptr i_character_ptr,
+							  AUCR_Class_Ptr io_class_ptr )
+{
+	( (AUCR_Slot *)i_character_ptr )->next_prototype = NULL;
+	if( io_class_ptr->last_prototype == NULL )
+	{
+		io_class_ptr->first_prototype = i_character_ptr;
+	}
+	else
+	{
+		( (AUCR_Slot *)( io_class_ptr->last_prototype ) )->next_prototype = i_character_ptr;
+	}
+	io_class_ptr->last_prototype = i_character_ptr;
+	( io_class_ptr->num_prototypes )++;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_Swap_Out()
+ *	Description:
+ *		swaps a character with the last character of an alphabet and drops it from
+ *		the characters, leaving its slot free for the next character added.  the
+ *		slot's published copy is given up, so the next character put in it is
+ *		copied when it is published.
+ *	Parameters:
+ *		i_character_number -> index of the character in characters_ptr_ptr
+ *		io_alphabet_ptr <-> alphabet to drop the character from
+ *	Preconditions:
+ *		i_character_number is at least zero and less than num_characters, and the
+ *		character has been taken out of its class
+ *	Postconditions:
+ *		num_characters is decremented by one, the index of every slot moved
+ *		matches where its ptr now is, and the freed slot has no published copy
+ *	Returns:
+ *		none
+ */
+static void AUCR_Alphabet_Swap_Out(
+								   int i_character_number,
+								   AUCR_Alphabet_Ptr io_alphabet_ptr )
+{
+	//local variables
+	AUCR_Character_Ptr tempchar, lastchar;
+	int last;
+	
+	last = io_alphabet_ptr->num_characters - 1;
+	tempchar = io_alphabet_ptr->characters_ptr_ptr[i_character_number];
+	lastchar = io_alphabet_ptr->characters_ptr_ptr[last];
+	
+	io_alphabet_ptr->characters_ptr_ptr[i_character_number] = lastchar;
+	( (AUCR_Slot *)lastchar )->index = i_character_number;
+	io_alphabet_ptr->characters_ptr_ptr[last] = tempchar;
+	( (AUCR_Slot *)tempchar )->index = last;
+	if( ( (AUCR_Slot *)tempchar )->published != NULL )
+	{
+		AUCR_Character_Unshare( ( (AUCR_Slot *)tempchar )->published );
+		( (AUCR_Slot *)tempchar )->published = NULL;
+	}
+	
+	( io_alphabet_ptr->num_characters )--;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Init()
+ *	Description:
+ *		Initializes a new AUCR_ALPHABET instance by allocating appropriate
+ *		memories and setting member values.
+ *	Parameters:
+ *		i_directional_code_map_ptr -> the memory address of a directional code
+ *							map structure that is used to fill in the directional
+ *							code map used by the alphabet.
+ *		i_num_activity_regions -> number of activity regions for to allocate
+ *							activity measure memories for.
+ *		i_num_directional_codes -> number of directional codes to allocate memory
+ *							for.
+ *		o_alphabet_ptr_ptr <- memory address of the AUCR_Alphabet_Ptr to be
+ *							populated with the new AUCR_Alphabet_Ptr which points to
+ *							new AUCR_Alphabet.
+ *	Preconditions:
+ *		The *AUCR_Alphabet_Ptr at o_alphabet_ptr_ptr
+ *		is a valid address of a AUCR_Alphabet_Prt that
+ *		is currently set to NULL. i_directional_code_map_ptr
+ *		is a valide pointer. i_num_activity_regions,
+ *		and i_num_directional_codes, are positive, nonzero numbers.
+ *	Postconditions:
+ *		the structure pointed to by i_directional_code_map_ptr has been copied,
+ *		the values held by i_num_activity_regions and i_num_directional_codes
+ *		have been stored, bias is new array of biases(length i_num_activity_regions),
+ *		activity_regions is a new array of activity regions (length i_num_activity_regions),
+ *		characters_ptr_ptr, blocks and classes are set to NULL, num_characters,
+ *		max_characters, max_classes and num_classes are set to zero, and o_alphabet_ptr_ptr points to an AUCR_Alphabet_Ptr which in turn points
+ *		to a newly created AUCR_Alphabet structure which contains all the previous information.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_ALPHABET_Init(
+							  AUCR_Directional_Code_Map_Ptr i_directional_code_map_ptr,
+							  int i_num_activity_regions,
+							  int i_num_directional_codes,
+							  AUCR_Alphabet_Ptr * o_alphabet_ptr_ptr )
+{
+	//local variables
+	int i, tempbias;
+	AUCR_Error temperror;
+	
+	//verify input
+	if( i_num_activity_regions <=0 || i_num_directional_codes <= 0 ||
+	   o_alphabet_ptr_ptr == NULL || *o_alphabet_ptr_ptr != NULL ||
+	   i_directional_code_map_ptr == NULL )
+	{
+		//bad input, return
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//allocate memory for alphabet structure
+	( *o_alphabet_ptr_ptr ) = ( AUCR_Alphabet_Ptr ) malloc( sizeof( AUCR_Alphabet ) );
+	if( ( *o_alphabet_ptr_ptr ) == NULL )
+	{
+		//unable to get memory, return
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//allocate memory for new directional code map stucture
+	( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr ) = NULL;
+	temperror = AUCR_DIRECTIONAL_CODE_MAP_Init( 
+											   i_directional_code_map_ptr->mappable_directional_codes,
+											   &( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if there is an error, throw it up
+		free( *o_alphabet_ptr_ptr );
+		return( temperror );
+	}
+	
+	//allocate memory for activity region arrays
+	( ( *o_alphabet_ptr_ptr )->activity_regions ) = 
+	( AUCR_Activity_Region_Ptr )malloc( i_num_activity_regions * sizeof( AUCR_Activity_Region ) );
+	if( ( ( *o_alphabet_ptr_ptr )->activity_regions ) == NULL )
+	{
+		free( ( *o_alphabet_ptr_ptr ) );
+		AUCR_DIRECTIONAL_CODE_MAP_Release( &( ( * o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//allocate memory for activity region biases
+	( ( *o_alphabet_ptr_ptr )->bias ) = (int *)malloc( i_num_activity_regions * sizeof( int ) );
+	if( ( ( *o_alphabet_ptr_ptr )->bias ) == NULL )
+	{
+		free( ( *o_alphabet_ptr_ptr ) );
+		AUCR_DIRECTIONAL_CODE_MAP_Release( &( ( * o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
+		free( ( *o_alphabet_ptr_ptr )->activity_regions );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//memory allocated, errors avoided, go ahead and fill in values
+	( ( *o_alphabet_ptr_ptr )->num_directional_codes ) = i_num_directional_codes;
+	( ( *o_alphabet_ptr_ptr )->num_activity_regions ) = i_num_activity_regions;
+	( ( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr )->mappable_directional_codes ) =
+    i_directional_code_map_ptr->mappable_directional_codes;      
+	( ( *o_alphabet_ptr_ptr )->num_characters ) = 0;
+	( ( *o_alphabet_ptr_ptr )->characters_ptr_ptr ) = NULL;
+	( ( *o_alphabet_ptr_ptr )->max_characters ) = 0;
+	( ( *o_alphabet_ptr_ptr )->blocks ) = NULL;
+	( ( *o_alphabet_ptr_ptr )->classes ) = NULL;
+	( ( *o_alphabet_ptr_ptr )->max_classes ) = 0;
+	( ( *o_alphabet_ptr_ptr )->num_classes ) = 0;
+	
+	//copy x and y arrays from i_directional code map into
+	//directional code map in the alphabet
+	for( i = 0; i < i_directional_code_map_ptr->mappable_directional_codes; i++ )
+	{
+		( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr )->x[i] = i_directional_code_map_ptr->x[i];
+		( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr )->y[i] = i_directional_code_map_ptr->y[i];
+	}
+	
+	//finalize internal dircode map
+	temperror = AUCR_DIRECTIONAL_CODE_MAP_Finalize( 
+												   ( *o_alphabet_ptr_ptr )->directional_code_map_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		free( ( *o_alphabet_ptr_ptr ) );
+		AUCR_DIRECTIONAL_CODE_MAP_Release( 
+										  &( ( * o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
+		free( ( *o_alphabet_ptr_ptr )->activity_regions );
+		free( ( *o_alphabet_ptr_ptr )->bias );
+		return( temperror );
+	}
+	
+	//fill in bias array
+	tempbias = AUCR_SCALE;
+	//  tempbias = AUCR_Rounding_Divide( AUCR_SCALE * i_num_directional_codes *
+	//      ( i_directional_code_map_ptr->mappable_directional_codes / 2 ) *
+	//      ( i_directional_code_map_ptr->mappable_directional_codes / 2 ),
+	//      i_num_activity_regions 
+	//      * ( i_directional_code_map_ptr->mappable_directional_codes + 1 )
+	//      * ( i_directional_code_map_ptr->mappable_directional_codes + 1 ) );
+	for( i = 0; i < i_num_activity_regions; i++ )
+	{
+		( *o_alphabet_ptr_ptr )->bias[i] = tempbias;
+	}
+	
+	//all done, return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Release()
+ *	Description:
+ *		Frees all dynamically allocated memories for the AUCR_ALPHABET_Release
+ *		and NULLs the AUCR_Alphabet_Ptr.
+ *	Parameters:
+ *		io_alphabet_ptr_ptr <-> address of the AUCR_Alphabet memory to be freed.
+ *	Preconditions:
+ *		The AUCR_Alphabet_Ptr at io_alphabet_ptr_ptr
+ *		is a valid address of an AUCR_Alphabet.
+ *	Postconditions:
+ *		each slot's published copy has been given up, every block of character
+ *		slots has been freed, the characters_ptr_ptr array
+ *		and the table of classes have been freed, the biases array has been freed, the activity_regions array
+ *		has been freed, the AUCR_Directional_Code_Map has been freed, the AUCR_Alphabet
+ *		structure has been freed and the AUCR_Alphabet_Ptr at io_alphabet_ptr_ptr has
+ *		been set to NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_ALPHABET_Release(
+						   AUCR_Alphabet_Ptr * io_alphabet_ptr_ptr )
+{
+	//local variables
+	void * tempblock;
+	int i;
+	
+	//check for valid input
+	if( ( io_alphabet_ptr_ptr == NULL ) && ( ( *io_alphabet_ptr_ptr ) == NULL ) )
+	{
+		return;
+	}
+	
+	//free directional code map
+	AUCR_DIRECTIONAL_CODE_MAP_Release( &( *io_alphabet_ptr_ptr )->directional_code_map_ptr );
+	
+	//give up the copies published from the slots; a snapshot's alphabet has no
+	//slots, and its characters are given up by AUCR_SNAPSHOT_Unpin()
+	if( ( *io_alphabet_ptr_ptr )->blocks != NULL )
+	{
+		for( i = 0; i < ( *io_alphabet_ptr_ptr )->max_characters; i++ )
+		{
+			if( ( (AUCR_Slot *)( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i] )->published != NULL )
+			{
+				AUCR_Character_Unshare( ( (AUCR_Slot *)( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i] )->published );
+			}
+		}
+	}
+	
+	//free every block of character slots, each of which holds the one before it
+	while( ( *io_alphabet_ptr_ptr )->blocks != NULL )
+	{
+		tempblock = ( *io_alphabet_ptr_ptr )->blocks;
+		( *io_alphabet_ptr_ptr )->blocks = *( (void **)tempblock );
+		free( tempblock );
+	}
+	
+	//free table of classes
+	free( ( *io_alphabet_ptr_ptr )->classes );
+	
+	//free character array itself
+	free( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr );
+	
+	//free activity regions array
+	free( ( *io_alphabet_ptr_ptr )->activity_regions );
+	
+	//free bias array
+	free( ( *io_alphabet_ptr_ptr )->bias );
+	
+	//free alphabet structure
+	free( ( *io_alphabet_ptr_ptr ) );
+	
+	//NULL alphabet structure pointer
+	( *io_alphabet_ptr_ptr ) = NULL;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Add_Interpolated_Character()
+ *	Description:
+ *		Adds the specified character to the specified alphabet
+ *	Parameters:
+ *		i_interpolated_character_ptr -> address of an interpolated character
+ *		io_alphabet_ptr -> address of the alphabet to add the character to
+ *	Preconditions:
+ *		i_interpolated_character_ptr is the address of a valid AUCR_Interpolated_Character
+ *		whose unicode is not 0x0000, which is reserved as an error character,
+ *		io_alphabet_ptr is the address of a valid AUCR_Alphabet, and the num_directional_codes
+ *		for the alphabet is in agreement with the num_directional_codes for the character
+ *	Postconditions:
+ *		interpolated character has been converted to character in the next free slot
+ *		of the alphabet, which is stored in character array of the alphabet and last
+ *		in its class, num_characters has been incremented by 1.  if there was no free slot, the
+ *		character array and the slots have first grown to twice their number.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet, which includes a character whose
+ *						unicode is 0x0000.  the alphabet is then unchanged.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_ALPHABET_Add_Interpolated_Character(
+													AUCR_Interpolated_Character_Ptr i_interpolated_character_ptr,
+													AUCR_Alphabet_Ptr io_alphabet_ptr )
+{
+	//local variables
+	AUCR_Character_Ptr tempchar;
+	AUCR_Class_Ptr tempclass;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_interpolated_character_ptr == NULL || io_alphabet_ptr == NULL ||
+	   i_interpolated_character_ptr->unicode == 0x0000 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	else if( i_interpolated_character_ptr->num_directional_codes !=
+			io_alphabet_ptr->num_directional_codes )
+	{
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+	}
+	
+	//make sure the character's class is in the table
+	temperror = AUCR_Alphabet_Add_Class( i_interpolated_character_ptr->unicode,
+										io_alphabet_ptr, &tempclass );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if adding returns an error, throw it up
+		return( temperror );
+	}
+	
+	//make sure there is a free slot, doubling the slots if there is not
+	temperror = AUCR_Alphabet_Grow( io_alphabet_ptr->num_characters + 1, io_alphabet_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if growing returns an error, throw it up
+		return( temperror );
+	}
+	
+	//convert interpolated character into the character in the next free slot
+	tempchar = io_alphabet_ptr->characters_ptr_ptr[io_alphabet_ptr->num_characters];
+	tempchar->unicode = i_interpolated_character_ptr->unicode;
+	temperror = AUCR_CHARACTER_From_Interpolated(
+												 i_interpolated_character_ptr, io_alphabet_ptr, tempchar, NULL );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up, leaving the slot free
+		return( temperror );
+	}
+	
+	//the slot now holds a character of the alphabet, last in its class
+	( io_alphabet_ptr->num_characters )++;
+	AUCR_Class_Append( tempchar, tempclass );
+	
+	//everything worked, return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Add_Raw()
+ *	Description:
+ *		Converts the supplied raw coordinates to an interpolated character
+ *		and adds the interpolated character to the specified alphabet
+ *	Parameters:
+ *		i_unicode -> the unicode value the character represents
+ *		i_num_coordinates -> the number of raw coordinates given
+ *		i_coordinates -> array of i_num_coordinates coordinates
+ *		io_alphabet_ptr -> address of the alphabet to add the character to
+ *	Preconditions:
+ *		i_num_coordinates is a positive integer
+ *		i_coordinates is non NULL and is the address of a valid array of
+ *							coordinates of length i_num_coordinates
+ *		io_alphabet_ptr is the address of a valid AUCR_Alphabet
+ *	Postconditions:
+ *		raw coordinates have been converted to an interpolated character, which is then
+ *		converted to character, stored in character array of the alphabet, num_characters
+ *		has been incremented by 1, characters_ptr_ptr and the slots grow as
+ *		AUCR_ALPHABET_Add_Interpolated_Character() grows them,
+ *		i_coordinates is unchanged, short strokes are scaled up as they are read
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_ALPHABET_Add_Raw(
+								 wchar_t i_unicode,
+								 int i_num_coordinates,
+								 const AUCR_Coordinate * i_coordinates,
+								 AUCR_Alphabet_Ptr io_alphabet_ptr )
+{
+	//local variables
+	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || io_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//create interpolated character
+	temperror = AUCR_INTERPOLATED_CHARACTER_Init( i_unicode,
+												 io_alphabet_ptr->num_directional_codes, &tempinterpchar );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if creation returns an error, throw it up
+		return( temperror );
+	}
+	
+	//convert raw coordinates to interpolated character
+	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
+													 i_num_coordinates, i_coordinates, tempinterpchar, NULL );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		return( temperror );
+	}
+	
+	//add interpolated character to the alphabet
+	temperror = AUCR_ALPHABET_Add_Interpolated_Character( tempinterpchar, io_alphabet_ptr );
+	
+	//free tempinterpchar memory
+	AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	
+	//return the value returned by add_interpolated
+	return( temperror );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Remove_Character()
+ *	Description:
+ *		Removes the specified character from the specified alphabet
+ *	Parameters:
+ *			i_character_number -> index of the character in the alphabets
+ *											character array
+ *			io_alphabet_ptr -> address of the alphabet to remove the character from
+ *	Preconditions:
+ *		i_character_number is a valid array index, greater than or equal to zero, and
+ *		less than num_characters, io_alphabet_ptr is a valid pointer to a valid
+ *		AUCR_Alphabet structure
+ *	Postconditions:
+ *		the character at characters_ptr_ptr[i_character_number] is removed from this
+ *		array by swapping it with the last character, and from its class.  its slot is
+ *		kept free for the next character added, and num_characters is decremented by
+ *		one.  no memory is freed or moved, so the pointers to the other characters are
+ *		still valid.
+ *
+ *		the swap reorders the character array: the last character takes the index of
+ *		the one removed.  the recognizers give the lower index of two equally close
+ *		characters, so removing a character can change which of two ties is
+ *		recognized, and anything that lists the characters by index sees the last
+ *		moved forward.  the order of each class is kept, so alfEdit, which shows a
+ *		class through AUCR_ALPHABET_Get_Class(), still shows it in the order added.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_ALPHABET_Remove_Character(
+										  int i_character_number, /* which character in the character array to remove */
+										  AUCR_Alphabet_Ptr io_alphabet_ptr )
+{
+	//local variables
+	AUCR_Character_Ptr tempchar, prevchar;
+	AUCR_Class_Ptr tempclass;
+	
+	//check for valid input
+	if( io_alphabet_ptr == NULL || i_character_number < 0 ||
+	   i_character_number >= io_alphabet_ptr->num_characters )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//take the character out of its class, finding the one before it
+	tempchar = io_alphabet_ptr->characters_ptr_ptr[i_character_number];
+	tempclass = AUCR_Alphabet_Find_Class( io_alphabet_ptr, tempchar->unicode );
+	prevchar = NULL;
+	if( tempclass->first_prototype != tempchar )
+	{
+		prevchar = tempclass->first_prototype;
+		while( ( (AUCR_Slot *)prevchar )->next_prototype != tempchar )
+		{
+			prevchar = ( (AUCR_Slot *)prevchar )->next_prototype;
+		}
+	}
+	if( prevchar == NULL )
+	{
+		tempclass->first_prototype = ( (AUCR_Slot *)tempchar )->next_prototype;
+	}
+	else
+	{
+		( (AUCR_Slot *)prevchar )->next_prototype = ( (AUCR_Slot *)tempchar )->next_prototype;
+	}
+	if( tempclass->last_prototype == tempchar )
+	{
+		tempclass->last_prototype = prevchar;
+	}
+	( tempclass->num_prototypes )--;
+	
+	//swap the character with the last character, so its slot is the
+	//first free one
+	AUCR_Alphabet_Swap_Out( i_character_number, io_alphabet_ptr );
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Get_Class()
+ *	Description:
+ *		looks up the characters of the alphabet with a unicode value in the alphabet's
+ *		table of classes, without scanning the characters
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet to look in
+ *		i_unicode -> unicode value of the class
+ *		i_max_prototypes -> most characters to store in o_prototypes
+ *		o_prototypes <- array of i_max_prototypes character ptrs to fill in
+ *		o_num_prototypes_ptr <- address of int variable to store the number of
+ *								characters in the class in
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet, i_max_prototypes is not negative, and
+ *		o_prototypes holds that many ptrs, or may be NULL if it is zero
+ *	Postconditions:
+ *		the first i_max_prototypes characters of the class, or all of them if there
+ *		are fewer, are stored in o_prototypes in the order they were added, and the
+ *		number of characters in the class is stored in the variable pointed to by
+ *		o_num_prototypes_ptr.  it is 0 if no character has i_unicode.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_ALPHABET_Get_Class(
+									const AUCR_Alphabet * i_alphabet_ptr,
+									wchar_t i_unicode,
+									int i_max_prototypes,
+									AUCR_Character_Ptr * o_prototypes,
+									int * o_num_prototypes_ptr )
+{
+	//local variables
+	AUCR_Class_Ptr tempclass;
+	AUCR_Character_Ptr tempchar;
+	int i;
+	
+	//check for valid input
+	if( i_alphabet_ptr == NULL || i_max_prototypes < 0 || o_num_prototypes_ptr == NULL ||
+	   ( i_max_prototypes > 0 && o_prototypes == NULL ) )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//a unicode value not in the table has no characters
+	( *o_num_prototypes_ptr ) = 0;
+	tempclass = AUCR_Alphabet_Find_Class( i_alphabet_ptr, i_unicode );
+	if( tempclass == NULL )
+	{
+		return( AUCR_ERR_SUCCESS );
+	}
+	
+	//follow the class from its first character
+	( *o_num_prototypes_ptr ) = tempclass->num_prototypes;
+	tempchar = tempclass->first_prototype;
+	for( i = 0; i < i_max_prototypes && tempchar != NULL; i++ )
+	{
+		o_prototypes[i] = tempchar;
+		tempchar = ( (AUCR_Slot *)tempchar )->next_prototype;
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Replace_Class()
+ *	Description:
+ *		replaces every character of the alphabet with a unicode value by characters
+ *		converted from interpolated characters
+ *	Parameters:
+ *		i_unicode -> unicode value of the class to replace
+ *		i_num_interpolated_characters -> number of interpolated characters given
+ *		i_interpolated_characters -> array of i_num_interpolated_characters
+ *										interpolated character ptrs
+ *		io_alphabet_ptr <-> alphabet to replace the class in
+ *	Preconditions:
+ *		i_unicode is not 0x0000, i_num_interpolated_characters is not negative,
+ *		i_interpolated_characters holds that many valid interpolated characters, or
+ *		may be NULL if it is zero, io_alphabet_ptr is a valid alphabet, and the
+ *		num_directional_codes of every interpolated character agrees with the alphabet
+ *	Postconditions:
+ *		the characters of the class have been removed as
+ *		AUCR_ALPHABET_Remove_Character() removes them, and the interpolated characters
+ *		have been converted to characters with the unicode value i_unicode and added
+ *		to the class in their order.  if an error is returned, the class is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the slots or the table of classes could not be grown
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_ALPHABET_Replace_Class(
+										wchar_t i_unicode,
+										int i_num_interpolated_characters,
+										AUCR_Interpolated_Character_Ptr * i_interpolated_characters,
+										AUCR_Alphabet_Ptr io_alphabet_ptr )
+{
+	//local variables
+	AUCR_Class_Ptr tempclass;
+	AUCR_Character_Ptr tempchar, oldchar;
+	AUCR_Error temperror;
+	int i;
+	
+	//check for valid input
+	if( i_unicode == 0x0000 || i_num_interpolated_characters < 0 || io_alphabet_ptr == NULL ||
+	   ( i_num_interpolated_characters > 0 && i_interpolated_characters == NULL ) )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	for( i = 0; i < i_num_interpolated_characters; i++ )
+	{
+		if( i_interpolated_characters[i] == NULL )
+		{
+			return( AUCR_ERR_FAILED );
+		}
+		else if( i_interpolated_characters[i]->num_directional_codes !=
+				io_alphabet_ptr->num_directional_codes )
+		{
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+	}
+	
+	//make sure the class is in the table, and there is a free slot for every
+	//new character
+	temperror = AUCR_Alphabet_Add_Class( i_unicode, io_alphabet_ptr, &tempclass );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	temperror = AUCR_Alphabet_Grow( io_alphabet_ptr->num_characters + i_num_interpolated_characters,
+								   io_alphabet_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	
+	//convert the interpolated characters into the free slots, where a failure
+	//leaves them free and the class unchanged
+	for( i = 0; i < i_num_interpolated_characters; i++ )
+	{
+		tempchar = io_alphabet_ptr->characters_ptr_ptr[io_alphabet_ptr->num_characters + i];
+		tempchar->unicode = i_unicode;
+		temperror = AUCR_CHARACTER_From_Interpolated(
+													 i_interpolated_characters[i], io_alphabet_ptr, tempchar, NULL );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			return( temperror );
+		}
+	}
+	
+	//take the old characters out of the class, and make the new ones its characters
+	oldchar = tempclass->first_prototype;
+	tempclass->first_prototype = NULL;
+	tempclass->last_prototype = NULL;
+	tempclass->num_prototypes = 0;
+	for( i = 0; i < i_num_interpolated_characters; i++ )
+	{
+		AUCR_Class_Append( io_alphabet_ptr->characters_ptr_ptr[io_alphabet_ptr->num_characters], tempclass );
+		( io_alphabet_ptr->num_characters )++;
+	}
+	
+	//drop the old characters, freeing their slots
+	while( oldchar != NULL )
+	{
+		tempchar = oldchar;
+		oldchar = ( (AUCR_Slot *)oldchar )->next_prototype;
+		AUCR_Alphabet_Swap_Out( ( (AUCR_Slot *)tempchar )->index, io_alphabet_ptr );
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_From_Interpolated()
+ *	Description:
+ *		finds the character in the alphabet that is closest to the
+ *		interpolated character given as an argument and return the
+ *		unicode of this found character
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			io_alphabet_ptr <-> address of the alphabet to find the character in
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		io_alphabet_ptr is a valid pointer to a valid pointer to a valid alphabet,
+ *		num_directional_codes between the alphabet and the character is in agreement
+ *	Postconditions:
+ *		the closest character in the alphabet has been found, and its unicode value
+ *		is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_From_Interpolated(
+													 const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+													 const AUCR_Alphabet * i_alphabet_ptr,
+													 wchar_t * o_unicode_ptr,
+													 AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Character_Ptr tempchar = NULL;
+	AUCR_Error temperror;
+	int minindex;
+	
+	//check for valid input
+	if( i_interpolated_character_ptr == NULL || i_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	else if( i_interpolated_character_ptr->num_directional_codes !=
+			i_alphabet_ptr->num_directional_codes )
+	{
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+	}
+	
+	//take character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempchar = &( io_workspace_ptr->character );
+	}
+	else
+	{
+		temperror = AUCR_CHARACTER_Init(
+										i_interpolated_character_ptr->unicode, i_alphabet_ptr->num_directional_codes,
+										i_alphabet_ptr->num_activity_regions, &tempchar );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	
+	//convert interpolated character into character
+	temperror = AUCR_CHARACTER_From_Interpolated(
+												 i_interpolated_character_ptr, i_alphabet_ptr, tempchar,
+												 io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_CHARACTER_Release( &tempchar );
+		}
+		return( temperror );
+	}
+	
+	//find the closest character
+	minindex = AUCR_Alphabet_Closest( i_alphabet_ptr, tempchar );
+	
+	//index of closest character now stored in minindex
+	
+	//retrieve unicode value of closest character and place in o_unicode_ptr
+	( *o_unicode_ptr ) = i_alphabet_ptr->characters_ptr_ptr[minindex]->unicode;
+	
+	//free character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_CHARACTER_Release( &tempchar );
+	}
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+	
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_From_Raw()
+ *	Description:
+ *		finds the character in the alphabet that is closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then return the unicode of this found character.  the features are found
+ *		in one pass along the raw coordinates, without building the interpolated
+ *		character, and are the same as AUCR_CHARACTER_From_Interpolated() gives
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			io_alphabet_ptr <-> pointer to alphabet to search against
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		io_alphabet_ptr is a valid pointer to a valid pointer to a valid alphabet,
+ *	Postconditions:
+ *		the closest character in the alphabet has been found, and its unicode value
+ *		is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_From_Raw(
+											int i_num_coordinates,
+											const AUCR_Coordinate * i_coordinates,
+											const AUCR_Alphabet * i_alphabet_ptr,
+											wchar_t * o_unicode_ptr,
+											AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//go from the raw coordinates straight to the closest character
+	return( AUCR_Alphabet_Recognize_Path( i_num_coordinates, i_coordinates, NULL,
+										 i_alphabet_ptr, NULL, o_unicode_ptr, io_workspace_ptr ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_From_Stroke()
+ *	Description:
+ *		finds the character in the alphabet that is closest to the
+ *		interpolated character that is created from the stroke that is given,
+ *		then return the unicode of this found character.  the features are found
+ *		in one pass along the raw coordinates, without building the interpolated
+ *		character, and are the same as AUCR_CHARACTER_From_Interpolated() gives
+ *	Parameters:
+ *			i_stroke_ptr -> pointer to the stroke to recognize
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_stroke_ptr is a valid stroke of at least one coordinate,
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet
+ *	Postconditions:
+ *		the closest character in the alphabet has been found, and its unicode value
+ *		is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_From_Stroke(
+											   const AUCR_Stroke * i_stroke_ptr,
+											   const AUCR_Alphabet * i_alphabet_ptr,
+											   wchar_t * o_unicode_ptr,
+											   AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//check for valid input
+	if( i_stroke_ptr == NULL || i_stroke_ptr->num_coordinates < 1 || i_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//go from the stroke straight to the closest character, along the
+	//distances it kept as it was drawn
+	return( AUCR_Alphabet_Recognize_Path( i_stroke_ptr->num_coordinates, i_stroke_ptr->coordinates,
+										 i_stroke_ptr->distances, i_alphabet_ptr, NULL, o_unicode_ptr,
+										 io_workspace_ptr ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_CLASS_FILTER_Init()
+ *	Description:
+ *		Initializes a new AUCR_Class_Filter of the unicode values that
+ *		AUCR_ALPHABET_Recognize_Filtered() may give, such as the digits of a field
+ *		that only takes numbers.  the unicode values are sorted and repeats dropped.
+ *	Parameters:
+ *		i_num_unicodes -> number of unicode values given
+ *		i_unicodes -> array of i_num_unicodes unicode values
+ *		o_filter_ptr_ptr <- address of the AUCR_Class_Filter_Ptr to be populated
+ *							with the new AUCR_Class_Filter
+ *	Preconditions:
+ *		i_num_unicodes is positive, i_unicodes holds that many unicode values, none
+ *		of them 0x0000, and the AUCR_Class_Filter_Ptr at o_filter_ptr_ptr is NULL
+ *	Postconditions:
+ *		o_filter_ptr_ptr points to a new filter holding each unicode value once, in
+ *		increasing order, and i_unicodes is unchanged
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_CLASS_FILTER_Init(
+								  int i_num_unicodes,
+								  const wchar_t * i_unicodes,
+								  AUCR_Class_Filter_Ptr * o_filter_ptr_ptr )
+{
+	//local variables
+	int i, j;
+	wchar_t tempunicode;
+	
+	//check for valid input
+	if( i_num_unicodes < 1 || i_unicodes == NULL ||
+	   o_filter_ptr_ptr == NULL || ( *o_filter_ptr_ptr ) != NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	for( i = 0; i < i_num_unicodes; i++ )
+	{
+		if( i_unicodes[i] == 0x0000 )
+		{
+			return( AUCR_ERR_FAILED );
+		}
+	}
+	
+	//allocate memory for filter structure and its unicode values
+	( *o_filter_ptr_ptr ) = (AUCR_Class_Filter_Ptr)malloc( sizeof( AUCR_Class_Filter ) );
+	if( ( *o_filter_ptr_ptr ) == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	( *o_filter_ptr_ptr )->unicodes = (wchar_t *)malloc( i_num_unicodes * sizeof( wchar_t ) );
+	if( ( *o_filter_ptr_ptr )->unicodes == NULL )
+	{
+		free( *o_filter_ptr_ptr );
+		( *o_filter_ptr_ptr ) = NULL;
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//copy the unicode values in order, with an insertion sort as there are few
+	for( i = 0; i < i_num_unicodes; i++ )
+	{
+		tempunicode = i_unicodes[i];
+		for( j = i; j > 0 && ( *o_filter_ptr_ptr )->unicodes[j - 1] > tempunicode; j-- )
+		{
+			( *o_filter_ptr_ptr )->unicodes[j] = ( *o_filter_ptr_ptr )->unicodes[j - 1];
+		}
+		( *o_filter_ptr_ptr )->unicodes[j] = tempunicode;
+	}
+	
+	//drop repeats, which are now next to each other
+	( *o_filter_ptr_ptr )->num_unicodes = 1;
+	for( i = 1; i < i_num_unicodes; i++ )
+	{
+		if( ( *o_filter_ptr_ptr )->unicodes[i] !=
+		   ( *o_filter_ptr_ptr )->unicodes[( *o_filter_ptr_ptr )->num_unicodes - 1] )
+		{
+			( *o_filter_ptr_ptr )->unicodes[( *o_filter_ptr_ptr )->num_unicodes] =
+			( *o_filter_ptr_ptr )->unicodes[i];
+			( ( *o_filter_ptr_ptr )->num_unicodes )++;
+		}
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_CLASS_FILTER_Release()
+ *	Description:
+ *		Frees all dynamically allocated memories for the AUCR_Class_Filter and NULLs
+ *		the AUCR_Class_Filter_Ptr.
+ *	Parameters:
+ *		io_filter_ptr_ptr <-> address of the AUCR_Class_Filter_Ptr to be freed
+ *	Preconditions:
+ *		The AUCR_Class_Filter_Ptr at io_filter_ptr_ptr is a valid filter or NULL
+ *	Postconditions:
+ *		the filter's memories have been freed and the AUCR_Class_Filter_Ptr at
+ *		io_filter_ptr_ptr is NULL
+ *	Returns:
+ *		none
+ */
+void AUCR_CLASS_FILTER_Release(
+							   AUCR_Class_Filter_Ptr * io_filter_ptr_ptr )
+{
+	//check for valid input
+	if( io_filter_ptr_ptr == NULL || ( *io_filter_ptr_ptr ) == NULL )
+	{
+		return;
+	}
+	
+	//free unicode values, then filter structure
+	free( ( *io_filter_ptr_ptr )->unicodes );
+	free( *io_filter_ptr_ptr );
+	( *io_filter_ptr_ptr ) = NULL;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_Filtered()
+ *	Description:
+ *		finds the character closest to raw coordinates among only the classes of
+ *		a filter, and returns its unicode value.  the classes are followed from the
+ *		alphabet's table of classes, so the characters of every other class are
+ *		skipped without being read, and the time taken grows with the characters
+ *		of the filter's classes rather than with the alphabet.  the features are
+ *		found as AUCR_ALPHABET_Recognize_From_Raw() finds them, and the result is
+ *		what it would give for an alphabet of only the filter's classes.
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinates
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			i_filter_ptr -> filter of the unicode values that may be given
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num_coordinates is positive, i_coordinates points to a valid array of
+ *		i_num_coordinates coordinates, i_alphabet_ptr is a valid alphabet with a
+ *		table of classes, which the alphabet of a snapshot does not have, and
+ *		i_filter_ptr is a valid filter
+ *	Postconditions:
+ *		the closest character of the filter's classes has been found, and its
+ *		unicode value is stored in the variable pointed to by o_unicode_ptr, or
+ *		0x0000 if no character of the alphabet is in the filter
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet, or the alphabet has characters
+ *		but no table of classes
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if the workspace was made for another geometry
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_Filtered(
+											int i_num_coordinates,
+											const AUCR_Coordinate * i_coordinates,
+											const AUCR_Alphabet * i_alphabet_ptr,
+											const AUCR_Class_Filter * i_filter_ptr,
+											wchar_t * o_unicode_ptr,
+											AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_alphabet_ptr == NULL ||
+	   i_filter_ptr == NULL || o_unicode_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//a snapshot's alphabet has characters but no classes to follow them from
+	if( i_alphabet_ptr->num_characters > 0 && i_alphabet_ptr->max_classes == 0 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//go from the raw coordinates straight to the closest character of the
+	//filter's classes
+	return( AUCR_Alphabet_Recognize_Path( i_num_coordinates, i_coordinates, NULL,
+										 i_alphabet_ptr, i_filter_ptr, o_unicode_ptr,
+										 io_workspace_ptr ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_Candidates_From_Interpolated()
+ *	Description:
+ *		finds the characters in the alphabet that are closest to the
+ *		interpolated character given as an argument, and returns up to
+ *		i_max_candidates of them, closest first, with their unicode values,
+ *		their indices in the alphabet and their differences.  characters are
+ *		skipped once their activity measure difference is farther than the farthest
+ *		of the closest candidates found so far, so with one candidate the result is
+ *		the character that AUCR_ALPHABET_Recognize_From_Interpolated() would find.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_alphabet_ptr -> address of the alphabet to find the characters in
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		num_directional_codes between the alphabet and the character is in agreement
+ *	Postconditions:
+ *		the closest characters in the alphabet have been found and are stored closest
+ *		first in o_candidates, and their number, the smaller of i_max_candidates and
+ *		the number of characters in the alphabet, is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_Candidates_From_Interpolated(
+																const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+																const AUCR_Alphabet * i_alphabet_ptr,
+																int i_max_candidates,
+																AUCR_Candidate * o_candidates,
+																int * o_num_candidates_ptr,
+																AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Character_Ptr tempchar = NULL;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_interpolated_character_ptr == NULL || i_alphabet_ptr == NULL ||
+	   i_max_candidates < 1 || o_candidates == NULL || o_num_candidates_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	else if( i_interpolated_character_ptr->num_directional_codes !=
+			i_alphabet_ptr->num_directional_codes )
+	{
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+	}
+	
+	//take character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempchar = &( io_workspace_ptr->character );
+	}
+	else
+	{
+		temperror = AUCR_CHARACTER_Init(
+										i_interpolated_character_ptr->unicode, i_alphabet_ptr->num_directional_codes,
+										i_alphabet_ptr->num_activity_regions, &tempchar );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	
+	//convert interpolated character into character
+	temperror = AUCR_CHARACTER_From_Interpolated(
+												 i_interpolated_character_ptr, i_alphabet_ptr, tempchar,
+												 io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_CHARACTER_Release( &tempchar );
+		}
+		return( temperror );
+	}
+	
+	( *o_num_candidates_ptr ) = 0;
+	
+	//check new character against each character in the alphabet
+	AUCR_Alphabet_Scan( i_alphabet_ptr, tempchar, i_max_candidates, o_candidates, o_num_candidates_ptr );
+	
+	//order the candidates closest first
+	AUCR_Candidates_Sort( o_candidates, ( *o_num_candidates_ptr ) );
+	
+	//free character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_CHARACTER_Release( &tempchar );
+	}
+	
+	//return success
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_Candidates_From_Raw()
+ *	Description:
+ *		finds the characters in the alphabet that are closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then returns up to i_max_candidates of them, closest first
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates
+ *	Postconditions:
+ *		the closest characters in the alphabet have been found and are stored closest
+ *		first in o_candidates, and their number is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_Candidates_From_Raw(
+													   int i_num_coordinates,
+													   const AUCR_Coordinate * i_coordinates,
+													   const AUCR_Alphabet * i_alphabet_ptr,
+													   int i_max_candidates,
+													   AUCR_Candidate * o_candidates,
+													   int * o_num_candidates_ptr,
+													   AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//take interpolated character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempinterpchar = &( io_workspace_ptr->interpolated_character );
+	}
+	else
+	{
+		temperror = AUCR_INTERPOLATED_CHARACTER_Init( 0x0001,
+													 i_alphabet_ptr->num_directional_codes, &tempinterpchar );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	
+	//convert raw coordinates to interpolated character
+	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
+													 i_num_coordinates, i_coordinates, tempinterpchar,
+													 io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		}
+		return( temperror );
+	}
+	
+	//call interpolated_recognize
+	temperror = AUCR_ALPHABET_Recognize_Candidates_From_Interpolated(
+																	 tempinterpchar, i_alphabet_ptr, i_max_candidates,
+																	 o_candidates, o_num_candidates_ptr, io_workspace_ptr ); 
+	
+	//free interpolated character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	}
+	
+	//return value returned by interpolated_recognize
+	return( temperror );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_Batch()
+ *	Description:
+ *		finds the character in the alphabet that is closest to each of many
+ *		strokes of raw data, storing the unicode of each found character.  the
+ *		alphabet is compiled once for the batch, and the strokes are recognized
+ *		by AUCR_COMPILED_ALPHABET_Recognize_Batch().  each result is the same as
+ *		AUCR_ALPHABET_Recognize_From_Raw() gives for its stroke.
+ *	Parameters:
+ *			i_num_strokes -> number of strokes supplied
+ *			i_stroke_offsets -> array of (i_num_strokes + 1) offsets into i_coordinates,
+ *							stroke s is made of the coordinates from i_stroke_offsets[s]
+ *							up to but not including i_stroke_offsets[s + 1]
+ *			i_coordinates -> array of the raw coordinates of every stroke
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			o_unicodes <- array of i_num_strokes wchar_t variables to store unicodes in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num_strokes is non negative, i_stroke_offsets is non NULL, starts at zero or
+ *		more and never decreases, i_coordinates is non NULL and holds all of the
+ *		coordinates the offsets refer to, and i_alphabet_ptr is a valid pointer to a
+ *		valid alphabet with at least one character
+ *	Postconditions:
+ *		the closest character to each stroke has been found, and its unicode value
+ *		is stored in o_unicodes.  strokes with no coordinates are given 0x0000.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if the alphabet's characters do not agree with it
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_Batch(
+										 int i_num_strokes,
+										 const int * i_stroke_offsets,
+										 const AUCR_Coordinate * i_coordinates,
+										 const AUCR_Alphabet * i_alphabet_ptr,
+										 wchar_t * o_unicodes,
+										 AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Compiled_Alphabet_Ptr tempcompiled = NULL;
+	AUCR_Error temperror;
+	
+	//compile alphabet for the batch
+	temperror = AUCR_ALPHABET_Compile( i_alphabet_ptr, &tempcompiled );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if compiling returns an error, throw it up
+		return( temperror );
+	}
+	
+	//recognize every stroke against the compiled alphabet
+	temperror = AUCR_COMPILED_ALPHABET_Recognize_Batch( i_num_strokes, i_stroke_offsets,
+													   i_coordinates, tempcompiled, o_unicodes,
+													   io_workspace_ptr );
+	
+	//free compiled alphabet memory
+	AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+	
+	return( temperror );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Put_Le32()
+ *	Description:
+ *		stores the low 32 bits of a value as four little-endian bytes
+ *	Parameters:
+ *		i_value -> value to store
+ *		o_bytes <- the four bytes to store it in
+ *	Preconditions:
+ *		o_bytes has room for four bytes
+ *	Postconditions:
+ *		o_bytes holds the value, least significant byte first
+ *	Returns:
+ *		none
+ */
+static void AUCR_Put_Le32( unsigned long i_value, unsigned char * o_bytes )
+{
+	o_bytes[0] = (unsigned char)( i_value & 0xFF );
+	o_bytes[1] = (unsigned char)( ( i_value >> 8 ) & 0xFF );
+	o_bytes[2] = (unsigned char)( ( i_value >> 16 ) & 0xFF );
+	o_bytes[3] = (unsigned char)( ( i_value >> 24 ) & 0xFF );
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Get_Le32()
+ *	Description:
+ *		loads a 32 bit value from four little-endian bytes
+ *	Parameters:
+ *		i_bytes -> the four bytes to load
+ *	Preconditions:
+ *		i_bytes holds four bytes
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the value, from 0 to 0xFFFFFFFF
+ */
+static unsigned long AUCR_Get_Le32( const unsigned char * i_bytes )
+{
+	return( (unsigned long)i_bytes[0] | ( (unsigned long)i_bytes[1] << 8 ) |
+		   ( (unsigned long)i_bytes[2] << 16 ) | ( (unsigned long)i_bytes[3] << 24 ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Le32_To_Int()
+ *	Description:
+ *		takes a 32 bit value loaded by AUCR_Get_Le32() as a two's complement int
+ *	Parameters:
+ *		i_value -> value from 0 to 0xFFFFFFFF
+ *	Preconditions:
+ *		the int it stands for fits in an int
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the int
+ */
+static int AUCR_Le32_To_Int( unsigned long i_value )
+{
+	if( i_value & 0x80000000UL )
+	{
+		return( -(int)( ( ~i_value ) & 0x7FFFFFFFUL ) - 1 );
+	}
+	
+	return( (int)i_value );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Checksum()
+ *	Description:
+ *		finds the Adler-32 checksum of a run of bytes
+ *	Parameters:
+ *		i_bytes -> bytes to check
+ *		i_length -> number of bytes in i_bytes
+ *	Preconditions:
+ *		i_bytes holds i_length bytes
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the checksum, from 0 to 0xFFFFFFFF
+ */
+static unsigned long AUCR_Checksum( const unsigned char * i_bytes, unsigned long i_length )
+{
+	//local variables
+	unsigned long a = 1, b = 0, run;
+	
+	while( i_length > 0 )
+	{
+		//5552 bytes is the longest run the sums cannot overflow 32 bits in
+		run = ( i_length < 5552 ) ? i_length : 5552;
+		i_length -= run;
+		while( run > 0 )
+		{
+			a += *i_bytes;
+			b += a;
+			i_bytes++;
+			run--;
+		}
+		a %= 65521;
+		b %= 65521;
+	}
+	
+	return( ( b << 16 ) | a );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Host_Reads_Files()
+ *	Description:
+ *		tells whether this host lays out a compiled alphabet's block just as a
+ *		compiled alphabet file does, so a file's block can be used in place
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		nonzero if ints and unicode values are 32 bits, shorts 16 bits, an activity
+ *		region two ints and the host little-endian, else zero
+ */
+static int AUCR_Host_Reads_Files( void )
+{
+	//local variables
+	unsigned int one = 1;
+	
+	return( sizeof( int ) == 4 && sizeof( short ) == 2 && sizeof( wchar_t ) == 4 &&
+		   sizeof( AUCR_Activity_Region ) == 2 * sizeof( int ) &&
+		   *( (unsigned char *)&one ) == 1 );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Shape()
+ *	Description:
+ *		sets the strides and coarse codes of a compiled alphabet from its numbers
+ *		of directional codes and activity regions
+ *	Parameters:
+ *		io_compiled_alphabet_ptr <-> compiled alphabet to shape
+ *	Preconditions:
+ *		num_directional_codes and num_activity_regions are positive
+ *	Postconditions:
+ *		the strides, num_coarse_codes and coarse_code_weight are set
+ *	Returns:
+ *		none
+ */
+static void AUCR_Compiled_Shape( AUCR_Compiled_Alphabet_Ptr io_compiled_alphabet_ptr )
+{
+	//rows are padded with zero codes, which never add to a difference
+	io_compiled_alphabet_ptr->directional_code_stride =
+	(int)AUCR_Round_Up( io_compiled_alphabet_ptr->num_directional_codes, AUCR_CODE_ROW_ALIGNMENT );
+	io_compiled_alphabet_ptr->activity_measure_stride =
+	(int)AUCR_Round_Up( io_compiled_alphabet_ptr->num_activity_regions, 4 );
+	io_compiled_alphabet_ptr->block_sum_stride =
+	(int)AUCR_Round_Up( 2 * ( ( io_compiled_alphabet_ptr->num_directional_codes + AUCR_BLOCK_CODES - 1 ) /
+							 AUCR_BLOCK_CODES ), 4 );
+	io_compiled_alphabet_ptr->num_coarse_codes =
+	( io_compiled_alphabet_ptr->num_directional_codes < AUCR_COARSE_SEGMENTS ) ?
+	io_compiled_alphabet_ptr->num_directional_codes : AUCR_COARSE_SEGMENTS;
+	io_compiled_alphabet_ptr->coarse_code_weight =
+	io_compiled_alphabet_ptr->num_directional_codes / io_compiled_alphabet_ptr->num_coarse_codes;
+	io_compiled_alphabet_ptr->coarse_code_stride =
+	(int)AUCR_Round_Up( io_compiled_alphabet_ptr->num_coarse_codes, AUCR_CODE_ROW_ALIGNMENT );
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Layout()
+ *	Description:
+ *		lays out every section of a compiled alphabet's block on its own cache line,
+ *		for ints, shorts and unicode values of the sizes given, which are this
+ *		host's for a block in memory and 4, 2 and 4 for the block of a file
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> shaped compiled alphabet to lay out
+ *		i_mappable_directional_codes -> number of entries in x and y
+ *		i_int_size -> bytes in an int
+ *		i_short_size -> bytes in a short
+ *		i_wchar_size -> bytes in a unicode value
+ *		o_offsets <- array of AUCR_SECTIONS offsets to fill in
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr has been shaped by AUCR_Compiled_Shape()
+ *	Postconditions:
+ *		o_offsets holds the offset of each section from the start of the block
+ *	Returns:
+ *		the number of bytes in the block
+ */
+static unsigned long AUCR_Compiled_Layout(
+										  const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+										  int i_mappable_directional_codes,
+										  unsigned long i_int_size,
+										  unsigned long i_short_size,
+										  unsigned long i_wchar_size,
+										  unsigned long * o_offsets )
+{
+	//local variables
+	unsigned long num_characters, num_activity_regions;
+	
+	num_characters = (unsigned long)i_compiled_alphabet_ptr->num_characters;
+	num_activity_regions = (unsigned long)i_compiled_alphabet_ptr->num_activity_regions;
+	
+	o_offsets[AUCR_SECTION_CODES] = 0;
+	o_offsets[AUCR_SECTION_MEASURES] = AUCR_Round_Up( o_offsets[AUCR_SECTION_CODES] + num_characters *
+													 i_compiled_alphabet_ptr->directional_code_stride, AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_UNICODES] = AUCR_Round_Up( o_offsets[AUCR_SECTION_MEASURES] + num_characters *
+													 i_compiled_alphabet_ptr->activity_measure_stride * i_int_size,
+													 AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_INDICES] = AUCR_Round_Up( o_offsets[AUCR_SECTION_UNICODES] + num_characters *
+													i_wchar_size, AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_BIAS] = AUCR_Round_Up( o_offsets[AUCR_SECTION_INDICES] + num_characters *
+												 i_int_size, AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_REGIONS] = AUCR_Round_Up( o_offsets[AUCR_SECTION_BIAS] + num_activity_regions *
+													i_int_size, AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_X] = AUCR_Round_Up( o_offsets[AUCR_SECTION_REGIONS] + num_activity_regions *
+											  2 * i_int_size, AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_Y] = AUCR_Round_Up( o_offsets[AUCR_SECTION_X] +
+											  (unsigned long)i_mappable_directional_codes * i_int_size, AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_TABLE] = AUCR_Round_Up( o_offsets[AUCR_SECTION_Y] +
+												  (unsigned long)i_mappable_directional_codes * i_int_size, AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_SUMS] = AUCR_Round_Up( o_offsets[AUCR_SECTION_TABLE] +
+												 (unsigned long)8 * ( AUCR_CODE_TABLE_SLOPES + 1 ) * i_short_size,
+												 AUCR_CACHE_LINE );
+	o_offsets[AUCR_SECTION_COARSE] = AUCR_Round_Up( o_offsets[AUCR_SECTION_SUMS] + num_characters *
+												   i_compiled_alphabet_ptr->block_sum_stride * i_int_size,
+												   AUCR_CACHE_LINE );
+	
+	return( o_offsets[AUCR_SECTION_COARSE] + num_characters * i_compiled_alphabet_ptr->coarse_code_stride );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Point()
+ *	Description:
+ *		points every array of a compiled alphabet into its block
+ *	Parameters:
+ *		i_base -> cache line aligned start of the block
+ *		i_offsets -> offsets of the sections, from AUCR_Compiled_Layout() for this host
+ *		io_compiled_alphabet_ptr <-> compiled alphabet to point into the block
+ *	Preconditions:
+ *		i_base holds a block laid out by i_offsets
+ *	Postconditions:
+ *		every array, and the x, y and code_table of the directional code map, point
+ *		into the block
+ *	Returns:
+ *		none
+ */
+static void AUCR_Compiled_Point(
+								unsigned char * i_base,
+								const unsigned long * i_offsets,
+								AUCR_Compiled_Alphabet_Ptr io_compiled_alphabet_ptr )
+{
+	io_compiled_alphabet_ptr->directional_codes = i_base + i_offsets[AUCR_SECTION_CODES];
+	io_compiled_alphabet_ptr->activity_measures = (int *)( i_base + i_offsets[AUCR_SECTION_MEASURES] );
+	io_compiled_alphabet_ptr->unicodes = (wchar_t *)( i_base + i_offsets[AUCR_SECTION_UNICODES] );
+	io_compiled_alphabet_ptr->indices = (int *)( i_base + i_offsets[AUCR_SECTION_INDICES] );
+	io_compiled_alphabet_ptr->bias = (int *)( i_base + i_offsets[AUCR_SECTION_BIAS] );
+	io_compiled_alphabet_ptr->activity_regions =
+	(AUCR_Activity_Region *)( i_base + i_offsets[AUCR_SECTION_REGIONS] );
+	io_compiled_alphabet_ptr->directional_code_map.x = (int *)( i_base + i_offsets[AUCR_SECTION_X] );
+	io_compiled_alphabet_ptr->directional_code_map.y = (int *)( i_base + i_offsets[AUCR_SECTION_Y] );
+	io_compiled_alphabet_ptr->directional_code_map.code_table =
+	(short *)( i_base + i_offsets[AUCR_SECTION_TABLE] );
+	io_compiled_alphabet_ptr->block_sums = (int *)( i_base + i_offsets[AUCR_SECTION_SUMS] );
+	io_compiled_alphabet_ptr->coarse_codes = i_base + i_offsets[AUCR_SECTION_COARSE];
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Convert_Ints()
+ *	Description:
+ *		copies ints to or from fixed width little-endian bytes, four an int
+ *	Parameters:
+ *		io_ints <-> array of i_num_ints ints
+ *		i_num_ints -> number of ints to copy
+ *		io_bytes <-> array of 4 * i_num_ints bytes
+ *		i_to_file -> nonzero to copy the ints to the bytes, zero to copy the bytes
+ *							to the ints
+ *	Preconditions:
+ *		both arrays are of the sizes given above
+ *	Postconditions:
+ *		the array copied to holds every value of the array copied from
+ *	Returns:
+ *		none
+ */
+static void AUCR_Convert_Ints(
+							  int * io_ints,
+							  unsigned long i_num_ints,
+							  unsigned char * io_bytes,
+							  int i_to_file )
+{
+	//local variables
+	unsigned long i;
+	
+	for( i = 0; i < i_num_ints; i++ )
+	{
+		if( i_to_file )
+		{
+			AUCR_Put_Le32( (unsigned long)io_ints[i], io_bytes + ( 4 * i ) );
+		}
+		else
+		{
+			io_ints[i] = AUCR_Le32_To_Int( AUCR_Get_Le32( io_bytes + ( 4 * i ) ) );
+		}
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Convert()
+ *	Description:
+ *		copies every section of a compiled alphabet's block to or from the block of
+ *		a file, turning each value into or out of fixed width little-endian bytes.
+ *		a compiled alphabet without a code table is written with every entry -1,
+ *		which recognizes just as having none does.
+ *	Parameters:
+ *		io_compiled_alphabet_ptr <-> compiled alphabet, which is only read when
+ *							writing to the file's block
+ *		io_file_block <-> the file's block
+ *		i_file_offsets -> offsets of the sections of the file's block
+ *		i_to_file -> nonzero to copy to the file's block, zero to copy from it
+ *	Preconditions:
+ *		both blocks are laid out for the same shaped compiled alphabet
+ *	Postconditions:
+ *		the block copied to holds every value of the block copied from
+ *	Returns:
+ *		none
+ */
+static void AUCR_Compiled_Convert(
+								  AUCR_Compiled_Alphabet_Ptr io_compiled_alphabet_ptr,
+								  unsigned char * io_file_block,
+								  const unsigned long * i_file_offsets,
+								  int i_to_file )
+{
+	//local variables
+	unsigned long i, entry;
+	unsigned long num_characters, num_activity_regions, mappable, num_table;
+	unsigned char * bytes;
+	
+	num_characters = (unsigned long)io_compiled_alphabet_ptr->num_characters;
+	num_activity_regions = (unsigned long)io_compiled_alphabet_ptr->num_activity_regions;
+	mappable = (unsigned long)io_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes;
+	num_table = (unsigned long)8 * ( AUCR_CODE_TABLE_SLOPES + 1 );
+	
+	//codes are bytes either way
+	if( i_to_file )
+	{
+		memcpy( io_file_block + i_file_offsets[AUCR_SECTION_CODES], io_compiled_alphabet_ptr->directional_codes,
+			   num_characters * io_compiled_alphabet_ptr->directional_code_stride );
+		memcpy( io_file_block + i_file_offsets[AUCR_SECTION_COARSE], io_compiled_alphabet_ptr->coarse_codes,
+			   num_characters * io_compiled_alphabet_ptr->coarse_code_stride );
+	}
+	else
+	{
+		memcpy( io_compiled_alphabet_ptr->directional_codes, io_file_block + i_file_offsets[AUCR_SECTION_CODES],
+			   num_characters * io_compiled_alphabet_ptr->directional_code_stride );
+		memcpy( io_compiled_alphabet_ptr->coarse_codes, io_file_block + i_file_offsets[AUCR_SECTION_COARSE],
+			   num_characters * io_compiled_alphabet_ptr->coarse_code_stride );
+	}
+	
+	//every section of ints
+	AUCR_Convert_Ints( io_compiled_alphabet_ptr->activity_measures,
+					  num_characters * io_compiled_alphabet_ptr->activity_measure_stride,
+					  io_file_block + i_file_offsets[AUCR_SECTION_MEASURES], i_to_file );
+	AUCR_Convert_Ints( io_compiled_alphabet_ptr->indices, num_characters,
+					  io_file_block + i_file_offsets[AUCR_SECTION_INDICES], i_to_file );
+	AUCR_Convert_Ints( io_compiled_alphabet_ptr->bias, num_activity_regions,
+					  io_file_block + i_file_offsets[AUCR_SECTION_BIAS], i_to_file );
+	AUCR_Convert_Ints( io_compiled_alphabet_ptr->directional_code_map.x, mappable,
+					  io_file_block + i_file_offsets[AUCR_SECTION_X], i_to_file );
+	AUCR_Convert_Ints( io_compiled_alphabet_ptr->directional_code_map.y, mappable,
+					  io_file_block + i_file_offsets[AUCR_SECTION_Y], i_to_file );
+	AUCR_Convert_Ints( io_compiled_alphabet_ptr->block_sums,
+					  num_characters * io_compiled_alphabet_ptr->block_sum_stride,
+					  io_file_block + i_file_offsets[AUCR_SECTION_SUMS], i_to_file );
+	
+	//activity regions, a start and a stop each
+	bytes = io_file_block + i_file_offsets[AUCR_SECTION_REGIONS];
+	for( i = 0; i < num_activity_regions; i++, bytes += 8 )
+	{
+		if( i_to_file )
+		{
+			AUCR_Put_Le32( (unsigned long)io_compiled_alphabet_ptr->activity_regions[i].start, bytes );
+			AUCR_Put_Le32( (unsigned long)io_compiled_alphabet_ptr->activity_regions[i].stop, bytes + 4 );
+		}
+		else
+		{
+			io_compiled_alphabet_ptr->activity_regions[i].start = AUCR_Le32_To_Int( AUCR_Get_Le32( bytes ) );
+			io_compiled_alphabet_ptr->activity_regions[i].stop = AUCR_Le32_To_Int( AUCR_Get_Le32( bytes + 4 ) );
+		}
+	}
+	
+	//unicode values
+	bytes = io_file_block + i_file_offsets[AUCR_SECTION_UNICODES];
+	for( i = 0; i < num_characters; i++, bytes += 4 )
+	{
+		if( i_to_file )
+		{
+			AUCR_Put_Le32( (unsigned long)io_compiled_alphabet_ptr->unicodes[i], bytes );
+		}
+		else
+		{
+			io_compiled_alphabet_ptr->unicodes[i] = (wchar_t)AUCR_Get_Le32( bytes );
+		}
+	}
+	
+	//code table, two bytes an entry
+	bytes = io_file_block + i_file_offsets[AUCR_SECTION_TABLE];
+	for( i = 0; i < num_table; i++, bytes += 2 )
+	{
+		if( i_to_file )
+		{
+			entry = ( io_compiled_alphabet_ptr->directional_code_map.code_table == NULL ) ? 0xFFFF :
+			(unsigned long)io_compiled_alphabet_ptr->directional_code_map.code_table[i];
+			bytes[0] = (unsigned char)( entry & 0xFF );
+			bytes[1] = (unsigned char)( ( entry >> 8 ) & 0xFF );
+		}
+		else
+		{
+			entry = (unsigned long)bytes[0] | ( (unsigned long)bytes[1] << 8 );
+			io_compiled_alphabet_ptr->directional_code_map.code_table[i] =
+			( entry & 0x8000 ) ? (short)( (long)entry - 0x10000L ) : (short)entry;
+		}
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Compiled_Verify()
+ *	Description:
+ *		checks the values of a compiled alphabet from a file that recognition
+ *		indexes arrays with, so that a file whose block checksum is not checked
+ *		cannot make recognition reach outside them: the begins and ends and code
+ *		table of the directional code map, the activity regions and the indices.
+ *		these are a few thousand values, however many characters there are.
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to check
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is pointed into its block, and its sizes have been
+ *		checked against the file's header
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		AUCR_ERR_SUCCESS if every value is in range
+ *		AUCR_ERR_FAILED if any is not
+ */
+static AUCR_Error AUCR_Compiled_Verify( const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr )
+{
+	//local variables
+	const AUCR_Directional_Code_Map * tempmap;
+	int i, mappable;
+	
+	tempmap = &( i_compiled_alphabet_ptr->directional_code_map );
+	mappable = tempmap->mappable_directional_codes;
+	
+	//begins and ends are directional codes, or -1 for an empty half plane
+	if( tempmap->positive_begin < -1 || tempmap->positive_begin >= mappable ||
+	   tempmap->negative_begin < -1 || tempmap->negative_begin >= mappable ||
+	   tempmap->positive_end < -1 || tempmap->positive_end >= mappable ||
+	   tempmap->negative_end < -1 || tempmap->negative_end >= mappable )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//every code table entry is a directional code, or -1 to search
+	for( i = 0; i < 8 * ( AUCR_CODE_TABLE_SLOPES + 1 ); i++ )
+	{
+		if( tempmap->code_table[i] < -1 || tempmap->code_table[i] >= mappable )
+		{
+			return( AUCR_ERR_FAILED );
+		}
+	}
+	
+	//activity regions count the directional codes between their start and stop
+	for( i = 0; i < i_compiled_alphabet_ptr->num_activity_regions; i++ )
+	{
+		if( i_compiled_alphabet_ptr->activity_regions[i].start < 0 ||
+		   i_compiled_alphabet_ptr->activity_regions[i].start >
+		   i_compiled_alphabet_ptr->activity_regions[i].stop ||
+		   i_compiled_alphabet_ptr->activity_regions[i].stop >= i_compiled_alphabet_ptr->num_directional_codes )
+		{
+			return( AUCR_ERR_FAILED );
+		}
+	}
+	
+	//indices are of the alphabet's characters
+	for( i = 0; i < i_compiled_alphabet_ptr->num_characters; i++ )
+	{
+		if( i_compiled_alphabet_ptr->indices[i] < 0 ||
+		   i_compiled_alphabet_ptr->indices[i] >= i_compiled_alphabet_ptr->num_characters )
+		{
+			return( AUCR_ERR_FAILED );
+		}
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Alphabet_From_Compiled()
+ *	Description:
+ *		makes an alphabet of the characters of a compiled alphabet, in the order of
+ *		its rows, so that a compiled alphabet file can be edited
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to copy
+ *		o_alphabet_ptr_ptr <- address of the AUCR_Alphabet_Ptr to be populated with
+ *							the new AUCR_Alphabet
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is a valid compiled alphabet.  The AUCR_Alphabet_Ptr
+ *		at o_alphabet_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_alphabet_ptr_ptr points to a newly allocated alphabet with the characters,
+ *		directional code map, activity regions and biases of the compiled alphabet
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if a row has the unicode value 0x0000
+ */
+static AUCR_Error AUCR_Alphabet_From_Compiled(
+											  const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+											  AUCR_Alphabet_Ptr * o_alphabet_ptr_ptr )
+{
+	//local variables
+	AUCR_Directional_Code_Map_Ptr tempdircode = NULL;
+	AUCR_Character_Ptr tempchar;
+	AUCR_Class_Ptr tempclass;
+	AUCR_Error temperr;
+	int i, j;
+	
+	//create an alphabet with the compiled alphabet's directional code map
+	temperr = AUCR_DIRECTIONAL_CODE_MAP_Init(
+											 i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes,
+											 &tempdircode );
+	if( temperr != AUCR_ERR_SUCCESS )
+	{
+		return( temperr );
+	}
+	for( i = 0; i < tempdircode->mappable_directional_codes; i++ )
+	{
+		tempdircode->x[i] = i_compiled_alphabet_ptr->directional_code_map.x[i];
+		tempdircode->y[i] = i_compiled_alphabet_ptr->directional_code_map.y[i];
+	}
+	temperr = AUCR_ALPHABET_Init( tempdircode, i_compiled_alphabet_ptr->num_activity_regions,
+								 i_compiled_alphabet_ptr->num_directional_codes, o_alphabet_ptr_ptr );
+	AUCR_DIRECTIONAL_CODE_MAP_Release( &tempdircode );
+	if( temperr != AUCR_ERR_SUCCESS )
+	{
+		return( temperr );
+	}
+	
+	//copy activity regions and biases
+	for( i = 0; i < i_compiled_alphabet_ptr->num_activity_regions; i++ )
+	{
+		( *o_alphabet_ptr_ptr )->activity_regions[i] = i_compiled_alphabet_ptr->activity_regions[i];
+		( *o_alphabet_ptr_ptr )->bias[i] = i_compiled_alphabet_ptr->bias[i];
+	}
+	
+	//create a slot for every character at once
+	temperr = AUCR_Alphabet_Grow( i_compiled_alphabet_ptr->num_characters, *o_alphabet_ptr_ptr );
+	if( temperr != AUCR_ERR_SUCCESS )
+	{
+		AUCR_ALPHABET_Release( o_alphabet_ptr_ptr );
+		return( temperr );
+	}
+	
+	//fill in each character from its row
+	for( i = 0; i < i_compiled_alphabet_ptr->num_characters; i++ )
+	{
+		tempchar = ( *o_alphabet_ptr_ptr )->characters_ptr_ptr[i];
+		if( i_compiled_alphabet_ptr->unicodes[i] == 0x0000 )
+		{
+			AUCR_ALPHABET_Release( o_alphabet_ptr_ptr );
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		tempchar->unicode = i_compiled_alphabet_ptr->unicodes[i];
+		
+		//add the character to its class
+		temperr = AUCR_Alphabet_Add_Class( tempchar->unicode, *o_alphabet_ptr_ptr, &tempclass );
+		if( temperr != AUCR_ERR_SUCCESS )
+		{
+			AUCR_ALPHABET_Release( o_alphabet_ptr_ptr );
+			return( temperr );
+		}
+		AUCR_Class_Append( tempchar, tempclass );
+		
+		for( j = 0; j < i_compiled_alphabet_ptr->num_directional_codes; j++ )
+		{
+			tempchar->directional_codes[j] =
+			i_compiled_alphabet_ptr->directional_codes[i * i_compiled_alphabet_ptr->directional_code_stride + j];
+		}
+		for( j = 0; j < i_compiled_alphabet_ptr->num_activity_regions; j++ )
+		{
+			tempchar->activity_measures[j] =
+			i_compiled_alphabet_ptr->activity_measures[i * i_compiled_alphabet_ptr->activity_measure_stride + j];
+		}
+		
+		//character added, increment num_characters
+		( ( *o_alphabet_ptr_ptr )->num_characters )++;
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Save_To_File()
+ *	Description:
+ *		takes the alphabet given as a parameter, and saves all the data contained
+ *		in the alphabet as an ascii file that is given by the file pointer given as
+ *		an argument.  
+ *	Parameters:
+ *		i_alphabet_ptr -> pointer to alphabet that will be saved
+ *		io_file_path -> pointer to a string that gives the full path of the file
+ *	Preconditions:
+ *		i_alphabet_ptr is a non-NULL, valid pointer to a valid alphabet structure,
+ *		and i_file_ptr is a valid pointer to a valid string that gives the full pathname
+ *		for a file that can be written without causing an error.
+ *	Postconditions:
+ *		the alphabet has been written to the file, and the alphabet itself is
+ *		unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_ALPHABET_Save_To_File( 
+									  const char * io_file_path,
+									  AUCR_Alphabet_Ptr i_alphabet_ptr )
+{
+	//local variables
+	FILE * tempfp;
+	int i;
+	
+	//check for valid input
+	if( io_file_path == NULL || i_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//open file
+	tempfp = fopen( io_file_path, "wb" );
+	if( tempfp == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//write number of characters 
+	fwrite( &( i_alphabet_ptr->num_characters ), sizeof( int ), 1, tempfp );
+	
+	//write number of activity regions
+	fwrite( &( i_alphabet_ptr->num_activity_regions ),
+		   sizeof( int ), 1, tempfp );
+	
+	//write number of directional codes
+	fwrite( &( i_alphabet_ptr->num_directional_codes ),
+		   sizeof( int ), 1, tempfp );
+	
+	//write mappable directional codes
+	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ),
+		   
+		   sizeof( int ), 1, tempfp );
+	
+	//write directional code map structure arrays
+	fwrite( i_alphabet_ptr->directional_code_map_ptr->x, sizeof( int ), 
+		   i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes, tempfp );
+	fwrite( i_alphabet_ptr->directional_code_map_ptr->y, sizeof( int ), 
+		   i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes, tempfp );
+	
+	//write setup info for directional code map 
+	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->positive_begin ), 
+		   sizeof( int ), 1, tempfp );
+	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->negative_begin ), 
+		   sizeof( int ), 1, tempfp );
+	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->positive_end ), 
+		   sizeof( int ), 1, tempfp );
+	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->negative_end ), 
+		   sizeof( int ), 1, tempfp ); 
+	
+	//write all character structures
+	for( i = 0; i < i_alphabet_ptr->num_characters; i++ )
+	{
+		fwrite( &( i_alphabet_ptr->characters_ptr_ptr[i]->unicode ), 
+			   
+			   sizeof( wchar_t ), 1, tempfp );
+		fwrite( &( i_alphabet_ptr->characters_ptr_ptr[i]->num_directional_codes ), 
+			   sizeof( int ), 1, tempfp );
+		fwrite( &( i_alphabet_ptr->characters_ptr_ptr[i]->num_activity_regions ), 
+			   sizeof( int ), 1, tempfp );
+		
+		//write directional code array
+		fwrite( i_alphabet_ptr->characters_ptr_ptr[i]->directional_codes, sizeof( int ),
+			   i_alphabet_ptr->characters_ptr_ptr[i]->num_directional_codes, tempfp );
+		
+		//write activity measures array
+		fwrite( i_alphabet_ptr->characters_ptr_ptr[i]->activity_measures, sizeof( int ),
+			   i_alphabet_ptr->characters_ptr_ptr[i]->num_activity_regions, tempfp );
+	}
+	
+	//write all activity region structures
+	fwrite( i_alphabet_ptr->activity_regions, sizeof( AUCR_Activity_Region ),
+		   i_alphabet_ptr->num_activity_regions, tempfp );
+	
+	//write all biases
+	fwrite( i_alphabet_ptr->bias, sizeof( int ),
+		   i_alphabet_ptr->num_activity_regions, tempfp ); 
+	
+	if( fclose( tempfp ) != 0 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Open_From_File()
+ *	Description:
+ *		takes the alphabet given as a pointer to a pointer parameter, and fills it with the
+ *		information contained in the file that is given as a parameter.
+ *	Parameters:
+ *		io_alphabet_ptr_ptr -> pointer to pointer to alphabet that will be filled in
+ *		i_file_path -> pointer to a string that gives the full path of
+ *							the file
+ *	Preconditions:
+ *		io_alphabet_ptr_ptr is a a valid pointer to a NULL alphabet pointer
+ *		and i_file_path is a valid pointer to a valid string that is the
+ *		path name of a valid file that was previously created by a call to the 
+ *		AUCR_ALPHABET_Save_To_File() or AUCR_COMPILED_ALPHABET_Save_To_File() function.
+ *	Postconditions:
+ *		the alphabet has been filled in with the information from the file, and the
+ *		file itself remains unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if a character in the file does not agree with
+ *													the alphabet in its numbers of codes or regions,
+ *													or a compiled alphabet file cannot be opened
+ *													by this build
+ */
+AUCR_Error AUCR_ALPHABET_Open_From_File(
+										const char * i_file_path,
+										AUCR_Alphabet_Ptr * io_alphabet_ptr_ptr )
+{
+	//local variables
+	FILE * tempfp;
+	int temp_num_characters, temp_num_activity_regions;
+	int temp_num_directional_codes, temp_mappable_directional_codes;
+	int i;
+	wchar_t temp_unicode;
+	AUCR_Error temperr;
+	AUCR_Directional_Code_Map_Ptr tempdircode = NULL;
+	AUCR_Class_Ptr tempclass;
+	AUCR_Compiled_Alphabet_Ptr tempcompiled = NULL;
+	unsigned char tempmagic[4];
+	
+	//check for valid input
+	if( i_file_path == NULL || io_alphabet_ptr_ptr == NULL
+	   || ( *io_alphabet_ptr_ptr ) != NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//open file
+	tempfp = fopen( i_file_path, "rb" );
+	if( tempfp == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//a compiled alphabet file is opened as a compiled alphabet and copied out
+	if( fread( tempmagic, 1, 4, tempfp ) == 4 && AUCR_Get_Le32( tempmagic ) == AUCR_FILE_MAGIC )
+	{
+		fclose( tempfp );
+		temperr = AUCR_COMPILED_ALPHABET_Open_From_File( i_file_path, 1, &tempcompiled );
+		if( temperr != AUCR_ERR_SUCCESS )
+		{
+			return( temperr );
+		}
+		temperr = AUCR_Alphabet_From_Compiled( tempcompiled, io_alphabet_ptr_ptr );
+		AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+		return( temperr );
+	}
+	rewind( tempfp );
+	
+	//read number of characters 
+	fread( &temp_num_characters, sizeof( int ), 1, tempfp );
+	
+	//read number of activity regions
+	fread( &temp_num_activity_regions,
+		  sizeof( int ), 1, tempfp );
+	
+	//read number of directional codes
+	fread( &temp_num_directional_codes,
+		  sizeof( int ), 1, tempfp );
+	
+	//read mappable directional codes
+	fread( &temp_mappable_directional_codes,
+		  sizeof( int ), 1, tempfp );
+	
+	//create directional code map structure
+	temperr = AUCR_DIRECTIONAL_CODE_MAP_Init(
+											 temp_mappable_directional_codes, &tempdircode );
+	if( temperr != AUCR_ERR_SUCCESS )
+	{
+		fclose( tempfp );
+		return( temperr );
+	}
+	
+	//fill in directional code map structure
+	fread( tempdircode->x, sizeof( int ), 
+		  temp_mappable_directional_codes, tempfp );
+	fread( tempdircode->y, sizeof( int ), 
+		  temp_mappable_directional_codes, tempfp );
+	
+	//create alphabet
+	temperr = AUCR_ALPHABET_Init( tempdircode, temp_num_activity_regions,
+								 temp_num_directional_codes, io_alphabet_ptr_ptr );
+	if( temperr != AUCR_ERR_SUCCESS )
+	{
+		fclose( tempfp );
+		AUCR_DIRECTIONAL_CODE_MAP_Release( &tempdircode );
+		return( temperr );
+	}
+	
+	//release temporary directional code map
+	AUCR_DIRECTIONAL_CODE_MAP_Release( &tempdircode );
+	
+	//fill dir code mapping
+	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->positive_begin ), 
+		  sizeof( int ), 1, tempfp );
+	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->negative_begin ), 
+		  sizeof( int ), 1, tempfp );
+	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->positive_end ), 
+		  sizeof( int ), 1, tempfp );
+	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->negative_end ), 
+		  sizeof( int ), 1, tempfp );  
+	
+	//refill the code table from the begins and ends just read
+	AUCR_Code_Table_Fill( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr );
+	
+	//create a slot for every character at once
+	temperr = AUCR_Alphabet_Grow( temp_num_characters, *io_alphabet_ptr_ptr );
+	if( temperr != AUCR_ERR_SUCCESS )
+	{
+		fclose( tempfp );
+		AUCR_ALPHABET_Release( io_alphabet_ptr_ptr );
+		return( temperr );
+	}
+	
+	//fill in all character structures
+	for( i = 0; i < temp_num_characters; i++ )
+	{
+		fread( &temp_unicode, sizeof( wchar_t ), 1, tempfp );
+		fread( &temp_num_directional_codes, sizeof( int ), 1, tempfp );
+		fread( &temp_num_activity_regions, sizeof( int ), 1, tempfp );
+		
+		//every slot is sized for the alphabet, so each character must agree with it
+		if( temp_unicode == 0x0000 ||
+		   temp_num_directional_codes != ( *io_alphabet_ptr_ptr )->num_directional_codes ||
+		   temp_num_activity_regions != ( *io_alphabet_ptr_ptr )->num_activity_regions )
+		{
+			fclose( tempfp );
+			AUCR_ALPHABET_Release( io_alphabet_ptr_ptr );
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i]->unicode = temp_unicode;
+		
+		//add the character to its class
+		temperr = AUCR_Alphabet_Add_Class( temp_unicode, *io_alphabet_ptr_ptr, &tempclass );
+		if( temperr != AUCR_ERR_SUCCESS )
+		{
+			fclose( tempfp );
+			AUCR_ALPHABET_Release( io_alphabet_ptr_ptr );
+			return( temperr );
+		}
+		AUCR_Class_Append( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i], tempclass );
+		
+		//fill in directional code array
+		fread( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i]->directional_codes,
+			  sizeof( int ), temp_num_directional_codes, tempfp );
+		
+		//fill in activity measures array
+		fread( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i]->activity_measures, 
+			  sizeof( int ), temp_num_activity_regions, tempfp );
+		
+		//character added, increment num_characters
+		( ( *io_alphabet_ptr_ptr )->num_characters )++;
+	}
+	
+	//fill in all activity region structures
+	fread( ( *io_alphabet_ptr_ptr )->activity_regions, sizeof( AUCR_Activity_Region ),
+		  ( *io_alphabet_ptr_ptr )->num_activity_regions, tempfp );
+	
+	//fill in all biases
+	fread( ( *io_alphabet_ptr_ptr )->bias, sizeof( int ),
+		  ( *io_alphabet_ptr_ptr )->num_activity_regions, tempfp );
+	
+	//close file
+	if( fclose( tempfp ) != 0 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Compile()
+ *	Description:
+ *		builds a read-only snapshot of an alphabet that is laid out for fast
+ *		recognition.  all of the directional codes are packed one byte per code
+ *		into rows of one matrix, all of the activity measures into rows of a second
+ *		matrix, and all of the unicode values into a third array, all inside of a
+ *		single cache line aligned block of memory.  each row also keeps the block
+ *		sums of its directional codes, which let recognition drop far rows before
+ *		checking their codes one by one, and up to AUCR_COARSE_SEGMENTS coarse
+ *		codes, which the coarse recognizers shortlist rows with.  the snapshot does
+ *		not refer back to the alphabet, so the alphabet may be changed or released
+ *		afterwards.
+ *	Parameters:
+ *		i_alphabet_ptr -> pointer to the alphabet to compile
+ *		o_compiled_alphabet_ptr_ptr <- address of the AUCR_Compiled_Alphabet_Ptr to be
+ *							populated with the new AUCR_Compiled_Alphabet
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet whose characters all
+ *		agree with it on num_directional_codes and num_activity_regions, and whose
+ *		mappable_directional_codes is no more than 256.  The AUCR_Compiled_Alphabet_Ptr
+ *		at o_compiled_alphabet_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_compiled_alphabet_ptr_ptr points to a newly allocated compiled copy of the
+ *		alphabet, and the alphabet itself is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													the characters with the alphabet are met
+ */
+AUCR_Error AUCR_ALPHABET_Compile(
+								 const AUCR_Alphabet * i_alphabet_ptr,
+								 AUCR_Compiled_Alphabet_Ptr * o_compiled_alphabet_ptr_ptr )
+{
+	//local variables
+	AUCR_Compiled_Alphabet_Ptr tempcompiled;
+	AUCR_Character_Ptr tempchar;
+	unsigned char * base;
+	unsigned long offsets[AUCR_SECTIONS];
+	unsigned long total;
+	int i, j, num_characters, mappable;
+	
+	//check for valid input
+	if( i_alphabet_ptr == NULL || o_compiled_alphabet_ptr_ptr == NULL ||
+	   ( *o_compiled_alphabet_ptr_ptr ) != NULL ||
+	   i_alphabet_ptr->directional_code_map_ptr == NULL ||
+	   i_alphabet_ptr->num_directional_codes < 1 ||
+	   i_alphabet_ptr->num_activity_regions < 1 ||
+	   i_alphabet_ptr->num_characters < 0 ||
+	   ( i_alphabet_ptr->num_characters > 0 && i_alphabet_ptr->characters_ptr_ptr == NULL ) )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	num_characters = i_alphabet_ptr->num_characters;
+	mappable = i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes;
+	
+	//codes must fit in one byte each
+	if( mappable < 1 || mappable > 256 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//make sure every character agrees with the alphabet
+	for( i = 0; i < num_characters; i++ )
+	{
+		tempchar = i_alphabet_ptr->characters_ptr_ptr[i];
+		if( tempchar == NULL )
+		{
+			return( AUCR_ERR_FAILED );
+		}
+		else if( tempchar->num_directional_codes != i_alphabet_ptr->num_directional_codes ||
+				tempchar->num_activity_regions != i_alphabet_ptr->num_activity_regions )
+		{
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		for( j = 0; j < tempchar->num_directional_codes; j++ )
+		{
+			if( tempchar->directional_codes[j] < 0 || tempchar->directional_codes[j] >= mappable )
+			{
+				return( AUCR_ERR_FAILED );
+			}
+		}
+	}
+	
+	//allocate structure memory
+	tempcompiled = (AUCR_Compiled_Alphabet_Ptr)malloc( sizeof( AUCR_Compiled_Alphabet ) );
+	if( tempcompiled == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	tempcompiled->num_characters = num_characters;
+	tempcompiled->num_directional_codes = i_alphabet_ptr->num_directional_codes;
+	tempcompiled->num_activity_regions = i_alphabet_ptr->num_activity_regions;
+	tempcompiled->mapping = NULL;
+	tempcompiled->mapping_size = 0;
+	AUCR_Compiled_Shape( tempcompiled );
+	
+	//lay out every section of the block on its own cache line
+	total = AUCR_Compiled_Layout( tempcompiled, mappable, sizeof( int ), sizeof( short ),
+								 sizeof( wchar_t ), offsets );
+	
+	//allocate block memory, with room to align its start
+	tempcompiled->block = malloc( total + AUCR_CACHE_LINE - 1 );
+	if( tempcompiled->block == NULL )
+	{
+		free( tempcompiled );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	base = (unsigned char *)AUCR_Round_Up( (unsigned long)tempcompiled->block, AUCR_CACHE_LINE );
+	memset( base, 0, total );
+	
+	//copy directional code map
+	tempcompiled->directional_code_map = *( i_alphabet_ptr->directional_code_map_ptr );
+	AUCR_Compiled_Point( base, offsets, tempcompiled );
+	for( i = 0; i < mappable; i++ )
+	{
+		tempcompiled->directional_code_map.x[i] = i_alphabet_ptr->directional_code_map_ptr->x[i];
+		tempcompiled->directional_code_map.y[i] = i_alphabet_ptr->directional_code_map_ptr->y[i];
+	}
+	if( i_alphabet_ptr->directional_code_map_ptr->code_table == NULL )
+	{
+		tempcompiled->directional_code_map.code_table = NULL;
+	}
+	else
+	{
+		for( i = 0; i < 8 * ( AUCR_CODE_TABLE_SLOPES + 1 ); i++ )
+		{
+			tempcompiled->directional_code_map.code_table[i] =
+			i_alphabet_ptr->directional_code_map_ptr->code_table[i];
+		}
+	}
+	
+	//copy activity regions and biases
+	for( i = 0; i < tempcompiled->num_activity_regions; i++ )
+	{
+		tempcompiled->activity_regions[i] = i_alphabet_ptr->activity_regions[i];
+		tempcompiled->bias[i] = i_alphabet_ptr->bias[i];
+	}
+	
+	//copy each character into its rows
+	for( i = 0; i < num_characters; i++ )
+	{
+		tempchar = i_alphabet_ptr->characters_ptr_ptr[i];
+		for( j = 0; j < tempcompiled->num_directional_codes; j++ )
+		{
+			tempcompiled->directional_codes[i * tempcompiled->directional_code_stride + j] =
+			(unsigned char)tempchar->directional_codes[j];
+		}
+		for( j = 0; j < tempcompiled->num_activity_regions; j++ )
+		{
+			tempcompiled->activity_measures[i * tempcompiled->activity_measure_stride + j] =
+			tempchar->activity_measures[j];
+		}
+		AUCR_Block_Sums( tempcompiled->directional_codes + ( i * tempcompiled->directional_code_stride ),
+						tempcompiled->num_directional_codes, mappable,
+						tempcompiled->block_sums + ( i * tempcompiled->block_sum_stride ) );
+		AUCR_Coarse_Codes( tempcompiled->directional_codes + ( i * tempcompiled->directional_code_stride ),
+						  tempcompiled->num_directional_codes, tempcompiled->num_coarse_codes, mappable,
+						  tempcompiled->coarse_codes + ( i * tempcompiled->coarse_code_stride ) );
+		tempcompiled->unicodes[i] = tempchar->unicode;
+		tempcompiled->indices[i] = i;
+	}
+	
+	( *o_compiled_alphabet_ptr_ptr ) = tempcompiled;
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Release()
+ *	Description:
+ *		Frees the memory block of the AUCR_Compiled_Alphabet, or unmaps the file it was
+ *		opened from, and the structure itself, and NULLs the AUCR_Compiled_Alphabet_Ptr.
+ *	Parameters:
+ *		io_compiled_alphabet_ptr_ptr <-> address of the AUCR_Compiled_Alphabet to be freed.
+ *	Preconditions:
+ *		The AUCR_Compiled_Alphabet_Ptr at io_compiled_alphabet_ptr_ptr is NULL or
+ *		the address of an AUCR_Compiled_Alphabet created by AUCR_ALPHABET_Compile() or
+ *		AUCR_COMPILED_ALPHABET_Open_From_File().
+ *	Postconditions:
+ *		all memory of the compiled alphabet is freed and the AUCR_Compiled_Alphabet_Ptr
+ *		at io_compiled_alphabet_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_COMPILED_ALPHABET_Release(
+									AUCR_Compiled_Alphabet_Ptr * io_compiled_alphabet_ptr_ptr )
+{
+	if( io_compiled_alphabet_ptr_ptr == NULL || ( *io_compiled_alphabet_ptr_ptr ) == NULL )
+	{
+		return;
+	}
+	
+#if defined( AUCR_MAP_FILES )
+	if( ( *io_compiled_alphabet_ptr_ptr )->mapping != NULL )
+	{
+		munmap( ( *io_compiled_alphabet_ptr_ptr )->mapping, ( *io_compiled_alphabet_ptr_ptr )->mapping_size );
+	}
+#endif
+	free( ( *io_compiled_alphabet_ptr_ptr )->block );
+	free( *io_compiled_alphabet_ptr_ptr );
+	( *io_compiled_alphabet_ptr_ptr ) = NULL;
+	
+	return;
+}
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Save_To_File()
+ *	Description:
+ *		writes a compiled alphabet to a file that AUCR_COMPILED_ALPHABET_Open_From_File()
+ *		can map and recognize against without parsing it.  the file is a versioned
+ *		header followed by the compiled alphabet's block, every section of it cache
+ *		line aligned, with every value a fixed width little-endian integer, so the
+ *		file is the same whatever host writes it.  the header and the block each
+ *		carry a checksum.
+ *	Parameters:
+ *		i_file_path -> pointer to a string that gives the full path of the file
+ *		i_compiled_alphabet_ptr -> compiled alphabet to write
+ *	Preconditions:
+ *		i_file_path is a valid path to a file that may be written, and
+ *		i_compiled_alphabet_ptr is a valid compiled alphabet
+ *	Postconditions:
+ *		the file holds the compiled alphabet, which is unchanged
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet or the file could not be written
+ *		AUCR_ERR_NO_MEMORY if the file's block could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Save_To_File(
+											   const char * i_file_path,
+											   const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr )
+{
+	//local variables
+	FILE * tempfp;
+	unsigned char header[AUCR_FILE_FIELDS * 4];
+	unsigned long fields[AUCR_FILE_FIELDS];
+	unsigned long offsets[AUCR_SECTIONS];
+	unsigned long blocksize;
+	unsigned char * fileblock;
+	int i, written;
+	
+	//check for valid input
+	if( i_file_path == NULL || i_compiled_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//lay out and fill in the file's block
+	blocksize = AUCR_Compiled_Layout( i_compiled_alphabet_ptr,
+									 i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes,
+									 4, 2, 4, offsets );
+	fileblock = (unsigned char *)malloc( blocksize );
+	if( fileblock == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	memset( fileblock, 0, blocksize );
+	//only reads the compiled alphabet when copying to the file's block
+	AUCR_Compiled_Convert( (AUCR_Compiled_Alphabet_Ptr)i_compiled_alphabet_ptr, fileblock, offsets, 1 );
+	
+	//fill in the header
+	memset( fields, 0, sizeof( fields ) );
+	fields[AUCR_FIELD_MAGIC] = AUCR_FILE_MAGIC;
+	fields[AUCR_FIELD_VERSION] = AUCR_FILE_VERSION;
+	fields[AUCR_FIELD_HEADER_SIZE] = sizeof( header );
+	fields[AUCR_FIELD_BLOCK_SIZE] = blocksize;
+	fields[AUCR_FIELD_BLOCK_CHECKSUM] = AUCR_Checksum( fileblock, blocksize );
+	fields[AUCR_FIELD_NUM_CHARACTERS] = i_compiled_alphabet_ptr->num_characters;
+	fields[AUCR_FIELD_NUM_DIRECTIONAL_CODES] = i_compiled_alphabet_ptr->num_directional_codes;
+	fields[AUCR_FIELD_NUM_ACTIVITY_REGIONS] = i_compiled_alphabet_ptr->num_activity_regions;
+	fields[AUCR_FIELD_MAPPABLE_DIRECTIONAL_CODES] =
+	i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes;
+	fields[AUCR_FIELD_DIRECTIONAL_CODE_STRIDE] = i_compiled_alphabet_ptr->directional_code_stride;
+	fields[AUCR_FIELD_ACTIVITY_MEASURE_STRIDE] = i_compiled_alphabet_ptr->activity_measure_stride;
+	fields[AUCR_FIELD_BLOCK_SUM_STRIDE] = i_compiled_alphabet_ptr->block_sum_stride;
+	fields[AUCR_FIELD_NUM_COARSE_CODES] = i_compiled_alphabet_ptr->num_coarse_codes;
+	fields[AUCR_FIELD_COARSE_CODE_WEIGHT] = i_compiled_alphabet_ptr->coarse_code_weight;
+	fields[AUCR_FIELD_COARSE_CODE_STRIDE] = i_compiled_alphabet_ptr->coarse_code_stride;
+	fields[AUCR_FIELD_POSITIVE_BEGIN] = (unsigned long)i_compiled_alphabet_ptr->directional_code_map.positive_begin;
+	fields[AUCR_FIELD_NEGATIVE_BEGIN] = (unsigned long)i_compiled_alphabet_ptr->directional_code_map.negative_begin;
+	fields[AUCR_FIELD_POSITIVE_END] = (unsigned long)i_compiled_alphabet_ptr->directional_code_map.positive_end;
+	fields[AUCR_FIELD_NEGATIVE_END] = (unsigned long)i_compiled_alphabet_ptr->directional_code_map.negative_end;
+	fields[AUCR_FIELD_BLOCK_CODES] = AUCR_BLOCK_CODES;
+	fields[AUCR_FIELD_CODE_TABLE_SLOPES] = AUCR_CODE_TABLE_SLOPES;
+	for( i = 0; i < AUCR_SECTIONS; i++ )
+	{
+		fields[AUCR_FIELD_SECTIONS + i] = offsets[i];
+	}
+	for( i = 0; i < AUCR_FILE_FIELDS - 1; i++ )
+	{
+		AUCR_Put_Le32( fields[i], header + ( 4 * i ) );
+	}
+	AUCR_Put_Le32( AUCR_Checksum( header, 4 * ( AUCR_FILE_FIELDS - 1 ) ),
+				  header + ( 4 * ( AUCR_FILE_FIELDS - 1 ) ) );
+	
+	//write the header and the block
+	tempfp = fopen( i_file_path, "wb" );
+	if( tempfp == NULL )
+	{
+		free( fileblock );
+		return( AUCR_ERR_FAILED );
+	}
+	written = ( fwrite( header, 1, sizeof( header ), tempfp ) == sizeof( header ) &&
+			   fwrite( fileblock, 1, blocksize, tempfp ) == blocksize );
+	free( fileblock );
+	if( fclose( tempfp ) != 0 || !written )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Open_From_File()
+ *	Description:
+ *		opens a compiled alphabet written by AUCR_COMPILED_ALPHABET_Save_To_File().
+ *		on a little-endian host with 32 bit ints and unicode values, which lays out
+ *		a compiled alphabet just as the file does, the file is mapped read-only and
+ *		recognized against in place, so only the pages recognition touches are ever
+ *		read.  any other host, or one without mmap(), reads the block in one go and
+ *		converts it if it must.  the header is always checked, and so are the values
+ *		recognition indexes arrays with; the block's checksum is checked when asked,
+ *		which reads every page of a mapped file, and always when the block is read.
+ *	Parameters:
+ *		i_file_path -> pointer to a string that gives the full path of the file
+ *		i_verify -> nonzero to check the block's checksum even if the file is mapped
+ *		o_compiled_alphabet_ptr_ptr <- address of the AUCR_Compiled_Alphabet_Ptr to be
+ *							populated with the compiled alphabet
+ *	Preconditions:
+ *		i_file_path is a valid path to a file written by
+ *		AUCR_COMPILED_ALPHABET_Save_To_File().  The AUCR_Compiled_Alphabet_Ptr at
+ *		o_compiled_alphabet_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_compiled_alphabet_ptr_ptr points to the compiled alphabet, which is released
+ *		with AUCR_COMPILED_ALPHABET_Release() as any other, and the file itself is
+ *		unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet, or the file is not a compiled
+ *							alphabet file of this version, fails a checksum or
+ *							holds a value out of range
+ *		AUCR_ERR_NO_MEMORY if the structure or block memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if the file was written with other values of
+ *													AUCR_CODE_ROW_ALIGNMENT, AUCR_BLOCK_CODES,
+ *													AUCR_COARSE_SEGMENTS or AUCR_CODE_TABLE_SLOPES
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Open_From_File(
+												 const char * i_file_path,
+												 int i_verify,
+												 AUCR_Compiled_Alphabet_Ptr * o_compiled_alphabet_ptr_ptr )
+{
+	//local variables
+	FILE * tempfp;
+	unsigned char header[AUCR_FILE_FIELDS * 4];
+	unsigned long fields[AUCR_FILE_FIELDS];
+	unsigned long offsets[AUCR_SECTIONS], nativeoffsets[AUCR_SECTIONS];
+	unsigned long blocksize, total;
+	unsigned char * fileblock = NULL;
+	unsigned char * base;
+	AUCR_Compiled_Alphabet_Ptr tempcompiled;
+	AUCR_Error temperror = AUCR_ERR_SUCCESS;
+	int i;
+#if defined( AUCR_MAP_FILES )
+	struct stat tempstat;
+	void * tempmap;
+#endif
+	
+	//check for valid input
+	if( i_file_path == NULL || o_compiled_alphabet_ptr_ptr == NULL ||
+	   ( *o_compiled_alphabet_ptr_ptr ) != NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//read and check the header
+	tempfp = fopen( i_file_path, "rb" );
+	if( tempfp == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	if( fread( header, 1, sizeof( header ), tempfp ) != sizeof( header ) )
+	{
+		fclose( tempfp );
+		return( AUCR_ERR_FAILED );
+	}
+	for( i = 0; i < AUCR_FILE_FIELDS; i++ )
+	{
+		fields[i] = AUCR_Get_Le32( header + ( 4 * i ) );
+	}
+	if( fields[AUCR_FIELD_MAGIC] != AUCR_FILE_MAGIC || fields[AUCR_FIELD_VERSION] != AUCR_FILE_VERSION ||
+	   fields[AUCR_FIELD_HEADER_SIZE] != sizeof( header ) ||
+	   fields[AUCR_FILE_FIELDS - 1] != AUCR_Checksum( header, 4 * ( AUCR_FILE_FIELDS - 1 ) ) ||
+	   fields[AUCR_FIELD_NUM_CHARACTERS] > INT_MAX / 1024 ||
+	   fields[AUCR_FIELD_NUM_DIRECTIONAL_CODES] < 1 || fields[AUCR_FIELD_NUM_DIRECTIONAL_CODES] > INT_MAX / 1024 ||
+	   fields[AUCR_FIELD_NUM_ACTIVITY_REGIONS] < 1 || fields[AUCR_FIELD_NUM_ACTIVITY_REGIONS] > INT_MAX / 1024 ||
+	   fields[AUCR_FIELD_MAPPABLE_DIRECTIONAL_CODES] < 1 || fields[AUCR_FIELD_MAPPABLE_DIRECTIONAL_CODES] > 256 )
+	{
+		fclose( tempfp );
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//allocate structure memory
+	tempcompiled = (AUCR_Compiled_Alphabet_Ptr)malloc( sizeof( AUCR_Compiled_Alphabet ) );
+	if( tempcompiled == NULL )
+	{
+		fclose( tempfp );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	tempcompiled->num_characters = (int)fields[AUCR_FIELD_NUM_CHARACTERS];
+	tempcompiled->num_directional_codes = (int)fields[AUCR_FIELD_NUM_DIRECTIONAL_CODES];
+	tempcompiled->num_activity_regions = (int)fields[AUCR_FIELD_NUM_ACTIVITY_REGIONS];
+	tempcompiled->directional_code_map.mappable_directional_codes =
+	(int)fields[AUCR_FIELD_MAPPABLE_DIRECTIONAL_CODES];
+	tempcompiled->directional_code_map.positive_begin = AUCR_Le32_To_Int( fields[AUCR_FIELD_POSITIVE_BEGIN] );
+	tempcompiled->directional_code_map.negative_begin = AUCR_Le32_To_Int( fields[AUCR_FIELD_NEGATIVE_BEGIN] );
+	tempcompiled->directional_code_map.positive_end = AUCR_Le32_To_Int( fields[AUCR_FIELD_POSITIVE_END] );
+	tempcompiled->directional_code_map.negative_end = AUCR_Le32_To_Int( fields[AUCR_FIELD_NEGATIVE_END] );
+	tempcompiled->block = NULL;
+	tempcompiled->mapping = NULL;
+	tempcompiled->mapping_size = 0;
+	
+	//the rows must be shaped as this build shapes them
+	AUCR_Compiled_Shape( tempcompiled );
+	if( fields[AUCR_FIELD_BLOCK_CODES] != AUCR_BLOCK_CODES ||
+	   fields[AUCR_FIELD_CODE_TABLE_SLOPES] != AUCR_CODE_TABLE_SLOPES ||
+	   fields[AUCR_FIELD_DIRECTIONAL_CODE_STRIDE] != (unsigned long)tempcompiled->directional_code_stride ||
+	   fields[AUCR_FIELD_ACTIVITY_MEASURE_STRIDE] != (unsigned long)tempcompiled->activity_measure_stride ||
+	   fields[AUCR_FIELD_BLOCK_SUM_STRIDE] != (unsigned long)tempcompiled->block_sum_stride ||
+	   fields[AUCR_FIELD_NUM_COARSE_CODES] != (unsigned long)tempcompiled->num_coarse_codes ||
+	   fields[AUCR_FIELD_COARSE_CODE_WEIGHT] != (unsigned long)tempcompiled->coarse_code_weight ||
+	   fields[AUCR_FIELD_COARSE_CODE_STRIDE] != (unsigned long)tempcompiled->coarse_code_stride )
+	{
+		fclose( tempfp );
+		free( tempcompiled );
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+	}
+	
+	//and the sections must be where this build lays them out
+	blocksize = AUCR_Compiled_Layout( tempcompiled, tempcompiled->directional_code_map.mappable_directional_codes,
+									 4, 2, 4, offsets );
+	for( i = 0; i < AUCR_SECTIONS; i++ )
+	{
+		if( fields[AUCR_FIELD_SECTIONS + i] != offsets[i] )
+		{
+			temperror = AUCR_ERR_FAILED;
+		}
+	}
+	if( fields[AUCR_FIELD_BLOCK_SIZE] != blocksize )
+	{
+		temperror = AUCR_ERR_FAILED;
+	}
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		fclose( tempfp );
+		free( tempcompiled );
+		return( temperror );
+	}
+	
+#if defined( AUCR_MAP_FILES )
+	//map the file and use its block in place, if this host lays blocks out as
+	//files do and the file is long enough
+	if( AUCR_Host_Reads_Files() && fstat( fileno( tempfp ), &tempstat ) == 0 &&
+	   (unsigned long)tempstat.st_size >= sizeof( header ) + blocksize )
+	{
+		tempmap = mmap( NULL, sizeof( header ) + blocksize, PROT_READ, MAP_PRIVATE, fileno( tempfp ), 0 );
+		if( tempmap != MAP_FAILED )
+		{
+			fclose( tempfp );
+			base = (unsigned char *)tempmap + sizeof( header );
+			if( i_verify && AUCR_Checksum( base, blocksize ) != fields[AUCR_FIELD_BLOCK_CHECKSUM] )
+			{
+				munmap( tempmap, sizeof( header ) + blocksize );
+				free( tempcompiled );
+				return( AUCR_ERR_FAILED );
+			}
+			tempcompiled->mapping = tempmap;
+			tempcompiled->mapping_size = sizeof( header ) + blocksize;
+			AUCR_Compiled_Point( base, offsets, tempcompiled );
+			if( AUCR_Compiled_Verify( tempcompiled ) != AUCR_ERR_SUCCESS )
+			{
+				AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+				return( AUCR_ERR_FAILED );
+			}
+			( *o_compiled_alphabet_ptr_ptr ) = tempcompiled;
+			return( AUCR_ERR_SUCCESS );
+		}
+	}
+#endif
+	
+	//otherwise read the block in one go
+	fileblock = (unsigned char *)malloc( blocksize + AUCR_CACHE_LINE - 1 );
+	if( fileblock == NULL )
+	{
+		fclose( tempfp );
+		free( tempcompiled );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	base = (unsigned char *)AUCR_Round_Up( (unsigned long)fileblock, AUCR_CACHE_LINE );
+	if( fread( base, 1, blocksize, tempfp ) != blocksize ||
+	   AUCR_Checksum( base, blocksize ) != fields[AUCR_FIELD_BLOCK_CHECKSUM] )
+	{
+		fclose( tempfp );
+		free( fileblock );
+		free( tempcompiled );
+		return( AUCR_ERR_FAILED );
+	}
+	fclose( tempfp );
+	
+	//use it as it is if this host lays blocks out as files do
+	if( AUCR_Host_Reads_Files() )
+	{
+		tempcompiled->block = fileblock;
+		AUCR_Compiled_Point( base, offsets, tempcompiled );
+		if( AUCR_Compiled_Verify( tempcompiled ) != AUCR_ERR_SUCCESS )
+		{
+			AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+			return( AUCR_ERR_FAILED );
+		}
+		( *o_compiled_alphabet_ptr_ptr ) = tempcompiled;
+		return( AUCR_ERR_SUCCESS );
+	}
+	
+	//or else convert it into a block laid out for this host
+	total = AUCR_Compiled_Layout( tempcompiled, tempcompiled->directional_code_map.mappable_directional_codes,
+								 sizeof( int ), sizeof( short ), sizeof( wchar_t ), nativeoffsets );
+	tempcompiled->block = malloc( total + AUCR_CACHE_LINE - 1 );
+	if( tempcompiled->block == NULL )
+	{
+		free( fileblock );
+		free( tempcompiled );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	AUCR_Compiled_Point( (unsigned char *)AUCR_Round_Up( (unsigned long)tempcompiled->block, AUCR_CACHE_LINE ),
+						nativeoffsets, tempcompiled );
+	AUCR_Compiled_Convert( tempcompiled, base, offsets, 0 );
+	free( fileblock );
+	
+	if( AUCR_Compiled_Verify( tempcompiled ) != AUCR_ERR_SUCCESS )
+	{
+		AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+		return( AUCR_ERR_FAILED );
+	}
+	
+	( *o_compiled_alphabet_ptr_ptr ) = tempcompiled;
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character given as an argument and return the
+ *		unicode of this found character.  the result is always the same as
+ *		AUCR_ALPHABET_Recognize_From_Interpolated() gives for the alphabet
+ *		the compiled alphabet was compiled from.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the character in
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at least
+ *		one character, num_directional_codes between the compiled alphabet and the
+ *		character is in agreement
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
  *	Returns:
- *		none
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
  */
-void AUCR_INTERPOLATED_CHARACTER_Release(
-										 AUCR_Interpolated_Character_Ptr * io_interpolated_character_ptr_ptr )
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated(
+															  const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+															  const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+															  wchar_t * o_unicode_ptr,
+															  AUCR_Workspace_Ptr io_workspace_ptr )
 {
+	//local variables
+	AUCR_Candidate tempcandidate;
+	int num_candidates;
+	AUCR_Error temperror;
+	
 	//check for valid input
-	if( ( io_interpolated_character_ptr_ptr == NULL ) ||
-	   ( ( * io_interpolated_character_ptr_ptr ) == NULL ) )
+	if( i_interpolated_character_ptr == NULL || i_compiled_alphabet_ptr == NULL ||
+	   o_unicode_ptr == NULL || i_compiled_alphabet_ptr->num_characters < 1 )
 	{
-		return;
+		return( AUCR_ERR_FAILED );
 	}
 	
-	//free coordinate array
-	free( ( * io_interpolated_character_ptr_ptr )->coordinates );
+	//the closest character is the only candidate of a search for one
+	temperror = AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated(
+																			  i_interpolated_character_ptr, i_compiled_alphabet_ptr, 1,
+																			  &tempcandidate, &num_candidates, io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
 	
-	//free character structure
-	free( ( * io_interpolated_character_ptr_ptr ) );
+	//place unicode value of closest row in o_unicode_ptr
+	( *o_unicode_ptr ) = tempcandidate.unicode;
 	
-	//set pointer to null
-	( * io_interpolated_character_ptr_ptr ) = NULL;
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Raw()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then return the unicode of this found character
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at least
+ *		one character
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_From_Raw(
+													 int i_num_coordinates,
+													 const AUCR_Coordinate * i_coordinates,
+													 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+													 wchar_t * o_unicode_ptr,
+													 AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
+	AUCR_Error temperror;
 	
-	return;
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_compiled_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//take interpolated character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempinterpchar = &( io_workspace_ptr->interpolated_character );
+	}
+	else
+	{
+		temperror = AUCR_INTERPOLATED_CHARACTER_Init( 0x0001,
+													 i_compiled_alphabet_ptr->num_directional_codes, &tempinterpchar );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	
+	//convert raw coordinates to interpolated character
+	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
+													 i_num_coordinates, i_coordinates, tempinterpchar,
+													 io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		}
+		return( temperror );
+	}
+	
+	//call interpolated_recognize
+	temperror = AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated(
+																   tempinterpchar, i_compiled_alphabet_ptr, o_unicode_ptr, io_workspace_ptr ); 
+	
+	//free interpolated character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	}
 	
+	//return value returned by interpolated_recognize
+	return( temperror );
 }
 
 
 /*
  *	Name:
- *		AUCR_INTERPOLATED_CHARACTER_From_Raw()
+ *		AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated()
  *	Description:
- *		Converts an array of AUCR_Coordinates (captured by a GUI) to an AUCR_Interpolated_Character.
+ *		finds the characters in the compiled alphabet that are closest to the
+ *		interpolated character given as an argument, and returns up to
+ *		i_max_candidates of them, closest first.  the candidates are always the
+ *		same as AUCR_ALPHABET_Recognize_Candidates_From_Interpolated() gives for
+ *		the alphabet the compiled alphabet was compiled from.
  *	Parameters:
- *		i_num_coordinates -> i_number of coordinates in the i_coordinates array.
- *		i_coordinates -> array of raw pen coordinates
- *		io_interpolated_character_ptr <-> address of the AUCR_Interpolated_Character
- *								to be populated from the raw data
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the characters in
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
- *		io_interpolated_character_ptr is a valid address of an initialized AUCR_Interpolated_Character.
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
  *	Postconditions:
- *		io_interpolated_character_ptr is populated with the interpolated version if the raw
- *		coordinates.
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number, the smaller of i_max_candidates
+ *		and the number of characters in the compiled alphabet, is stored at
+ *		o_num_candidates_ptr
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
  *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
  */
-AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Raw(
-												int i_num_coordinates,
-												AUCR_Coordinate * i_coordinates,
-												AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr )
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated(
+																		 const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+																		 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+																		 int i_max_candidates,
+																		 AUCR_Candidate * o_candidates,
+																		 int * o_num_candidates_ptr,
+																		 AUCR_Workspace_Ptr io_workspace_ptr )
 {
-	//declare variables
-	//array of distances for each point
-	unsigned int * distances;
-	//holds scale factor if needed
-	int tempscalar;
-	//holds length all segments will be
-	int seglength;
-	//index of point currently being looked at
-	int currentcoord = 1;
-	//parameter in parametric equations for doing interpolations
-	int t;
-	//loop index
-	int i;
+	//local variables
+	AUCR_Workspace_Ptr tempworkspace = NULL;
+	AUCR_Error temperror;
 	
 	//check for valid input
-	if( io_interpolated_character_ptr == NULL ||
-	   i_num_coordinates < 1 )
+	if( i_interpolated_character_ptr == NULL || i_compiled_alphabet_ptr == NULL ||
+	   i_max_candidates < 1 || o_candidates == NULL || o_num_candidates_ptr == NULL )
 	{
 		return( AUCR_ERR_FAILED );
 	}
+	else if( i_interpolated_character_ptr->num_directional_codes !=
+			i_compiled_alphabet_ptr->num_directional_codes )
+	{
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+	}
 	
-	//get memory for distance array
-	distances = (unsigned int *)malloc( i_num_coordinates * sizeof( unsigned int ) );
-	if( distances == NULL )
+	//use the workspace given, or create one for this call
+	if( io_workspace_ptr != NULL )
 	{
-		return( AUCR_ERR_NO_MEMORY );
-	}  
+		if( !AUCR_Workspace_Fits( io_workspace_ptr, i_compiled_alphabet_ptr->num_directional_codes,
+								 i_compiled_alphabet_ptr->num_activity_regions,
+								 i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes ) )
+		{
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		tempworkspace = io_workspace_ptr;
+	}
+	else
+	{
+		temperror = AUCR_WORKSPACE_Init_From_Compiled( i_compiled_alphabet_ptr, &tempworkspace );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
 	
-	distances[0] = 0;
+	//find the features of the interpolated character
+	AUCR_Compiled_Query( i_compiled_alphabet_ptr, i_interpolated_character_ptr->coordinates,
+						tempworkspace->hits, tempworkspace->character.directional_codes,
+						tempworkspace->character.activity_measures, tempworkspace->row,
+						tempworkspace->block_sums );
+	
+	//find the closest rows and order them closest first
+	( *o_num_candidates_ptr ) = 0;
+	AUCR_Compiled_Scan( i_compiled_alphabet_ptr, tempworkspace->row,
+					   tempworkspace->character.activity_measures, tempworkspace->block_sums,
+					   0, i_compiled_alphabet_ptr->num_characters,
+					   i_max_candidates, o_candidates, o_num_candidates_ptr,
+					   &( tempworkspace->statistics ) );
+	AUCR_Candidates_Sort( o_candidates, ( *o_num_candidates_ptr ) );
+	
+	//free workspace memory unless it was given
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_WORKSPACE_Release( &tempworkspace );
+	}
 	
-	//loop to calculate distances
-	for(i = 1; i < i_num_coordinates; i++ )
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Raw()
+ *	Description:
+ *		finds the characters in the compiled alphabet that are closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then returns up to i_max_candidates of them, closest first
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates
+ *	Postconditions:
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Raw(
+																int i_num_coordinates,
+																const AUCR_Coordinate * i_coordinates,
+																const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+																int i_max_candidates,
+																AUCR_Candidate * o_candidates,
+																int * o_num_candidates_ptr,
+																AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_compiled_alphabet_ptr == NULL )
 	{
-		distances[i] = distances[i - 1] + AUCR_Integer_Square_Root( 
-																   ( ( i_coordinates[i].x - i_coordinates[i - 1].x ) *
-																	( i_coordinates[i].x - i_coordinates[i - 1].x ) ) +
-																   ( ( i_coordinates[i].y - i_coordinates[i - 1].y ) *
-																	( i_coordinates[i].y - i_coordinates[i - 1].y ) ) );
+		return( AUCR_ERR_FAILED );
 	}
 	
-	//case 1: input has no distance
-	if( distances[i_num_coordinates - 1] < 1 )
-	{ 
-		//fill in entire coordinate array with zeros
-		for( i = 0; i <= io_interpolated_character_ptr->num_directional_codes; i++ )
+	//take interpolated character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempinterpchar = &( io_workspace_ptr->interpolated_character );
+	}
+	else
+	{
+		temperror = AUCR_INTERPOLATED_CHARACTER_Init( 0x0001,
+													 i_compiled_alphabet_ptr->num_directional_codes, &tempinterpchar );
+		if( temperror != AUCR_ERR_SUCCESS )
 		{
-			io_interpolated_character_ptr->coordinates[i].x = 0;
-			io_interpolated_character_ptr->coordinates[i].y = 0;
+			//if creation returns an error, throw it up
+			return( temperror );
 		}
 	}
 	
-	//case 2: input has distance
+	//convert raw coordinates to interpolated character
+	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
+													 i_num_coordinates, i_coordinates, tempinterpchar,
+													 io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		}
+		return( temperror );
+	}
+	
+	//call interpolated_recognize
+	temperror = AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated(
+																			  tempinterpchar, i_compiled_alphabet_ptr, i_max_candidates,
+																			  o_candidates, o_num_candidates_ptr, io_workspace_ptr ); 
+	
+	//free interpolated character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	}
+	
+	//return value returned by interpolated_recognize
+	return( temperror );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Batch()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to each of
+ *		many strokes of raw data, storing the unicode of each found character.
+ *		the strokes are recognized AUCR_BATCH_QUERIES at a time, and each tile of
+ *		strokes is checked against AUCR_BATCH_ROWS rows of the compiled alphabet at
+ *		a time, so that every block of rows is read from memory once per tile rather
+ *		than once per stroke.  one workspace is used for the whole batch.  each
+ *		result is the same as
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Raw() gives for its stroke.
+ *	Parameters:
+ *			i_num_strokes -> number of strokes supplied
+ *			i_stroke_offsets -> array of (i_num_strokes + 1) offsets into i_coordinates,
+ *							stroke s is made of the coordinates from i_stroke_offsets[s]
+ *							up to but not including i_stroke_offsets[s + 1]
+ *			i_coordinates -> array of the raw coordinates of every stroke
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			o_unicodes <- array of i_num_strokes wchar_t variables to store unicodes in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num_strokes is non negative, i_stroke_offsets is non NULL, starts at zero or
+ *		more and never decreases, i_coordinates is non NULL and holds all of the
+ *		coordinates the offsets refer to, and i_compiled_alphabet_ptr is a valid
+ *		pointer to a compiled alphabet with at least one character
+ *	Postconditions:
+ *		the closest character to each stroke has been found, and its unicode value
+ *		is stored in o_unicodes.  strokes with no coordinates are given 0x0000.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Batch(
+												  int i_num_strokes,
+												  const int * i_stroke_offsets,
+												  const AUCR_Coordinate * i_coordinates,
+												  const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+												  wchar_t * o_unicodes,
+												  AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Workspace_Ptr tempworkspace = NULL;
+	AUCR_Candidate candidates[AUCR_BATCH_QUERIES];
+	int num_candidates[AUCR_BATCH_QUERIES];
+	AUCR_Error temperror;
+	int * measures;
+	int * sums;
+	unsigned char * rows;
+	int first, count, q, stroke, row, stoprow;
+	
+	//check for valid input
+	if( i_num_strokes < 0 || i_stroke_offsets == NULL || i_coordinates == NULL ||
+	   i_compiled_alphabet_ptr == NULL || o_unicodes == NULL ||
+	   i_compiled_alphabet_ptr->num_characters < 1 || i_stroke_offsets[0] < 0 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	for( stroke = 0; stroke < i_num_strokes; stroke++ )
+	{
+		if( i_stroke_offsets[stroke + 1] < i_stroke_offsets[stroke] )
+		{
+			return( AUCR_ERR_FAILED );
+		}
+	}
+	
+	//use the workspace given, or create one for the whole batch
+	if( io_workspace_ptr != NULL )
+	{
+		if( !AUCR_Workspace_Fits( io_workspace_ptr, i_compiled_alphabet_ptr->num_directional_codes,
+								 i_compiled_alphabet_ptr->num_activity_regions,
+								 i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes ) )
+		{
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		tempworkspace = io_workspace_ptr;
+	}
 	else
 	{
-		//make sure input has long enough distance
-		//
-		//the ( io_interpolated_character_ptr->num_directional_codes * AUCR_SCALE * 2 )
-		//term is the scaling cut off factor and should have a noticeable impact on 
-		//the efficiency and accuracy of the interpolation algorithm.
-		//
-		//for smaller input devices, it may be better to go ahead and just scale 
-		//everything without even checking how much total information we read in.
-		//
-		//the larger the term is (i.e. increasing the 2 to a 5) should give us a 
-		//better interpolation and make the resulting segmented curve smoother, 
-		//but on the other hand making it too large makes us run the risk of  
-		//overflow in longer cases and will also force us to rescale more often 
-		//which may not have adequate run time performance
-		//
-		if(distances[i_num_coordinates - 1] < 
-		   (unsigned int)( io_interpolated_character_ptr->num_directional_codes * AUCR_SCALE * 10 ) )
+		temperror = AUCR_WORKSPACE_Init_From_Compiled( i_compiled_alphabet_ptr, &tempworkspace );
+		if( temperror != AUCR_ERR_SUCCESS )
 		{
-			//too short, so we will scale
-			//scale factor
-			tempscalar = AUCR_Rounding_Divide( 
-											  io_interpolated_character_ptr->num_directional_codes * AUCR_SCALE * 20,
-											  distances[i_num_coordinates - 1] );
-			//scale first raw coordinate
-			i_coordinates[0].x = tempscalar * i_coordinates[0].x;
-			i_coordinates[0].y = tempscalar * i_coordinates[0].y;
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	measures = tempworkspace->batch_activity_measures;
+	sums = tempworkspace->batch_block_sums;
+	rows = tempworkspace->batch_rows;
+	
+	for( first = 0; first < i_num_strokes; first += AUCR_BATCH_QUERIES )
+	{
+		count = i_num_strokes - first;
+		if( count > AUCR_BATCH_QUERIES )
+		{
+			count = AUCR_BATCH_QUERIES;
+		}
+		
+		//find the features of every stroke in the tile
+		for( q = 0; q < count; q++ )
+		{
+			stroke = first + q;
+			
+			//strokes with no coordinates have nothing to recognize
+			if( i_stroke_offsets[stroke + 1] == i_stroke_offsets[stroke] )
+			{
+				num_candidates[q] = -1;
+				continue;
+			}
 			
-			//scale all subsequent raw coordinates and distances
-			for( i = 1; i < i_num_coordinates; i++ )
+			//convert raw coordinates to interpolated character
+			temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
+															 i_stroke_offsets[stroke + 1] - i_stroke_offsets[stroke],
+															 i_coordinates + i_stroke_offsets[stroke],
+															 &( tempworkspace->interpolated_character ), tempworkspace );
+			if( temperror != AUCR_ERR_SUCCESS )
 			{
-				i_coordinates[i].x = tempscalar * i_coordinates[i].x;
-				i_coordinates[i].y = tempscalar * i_coordinates[i].y;
-				distances[i] = tempscalar * distances[i];
+				//if conversion returns an error, throw it up
+				if( io_workspace_ptr == NULL )
+				{
+					AUCR_WORKSPACE_Release( &tempworkspace );
+				}
+				return( temperror );
 			}
+			
+			AUCR_Compiled_Query( i_compiled_alphabet_ptr, tempworkspace->interpolated_character.coordinates,
+								tempworkspace->hits, tempworkspace->character.directional_codes,
+								measures + ( q * i_compiled_alphabet_ptr->num_activity_regions ),
+								rows + ( q * i_compiled_alphabet_ptr->directional_code_stride ),
+								sums + ( q * tempworkspace->block_sum_stride ) );
+			num_candidates[q] = 0;
 		}
 		
-		//first interpolated point is the same as first raw point
-		io_interpolated_character_ptr->coordinates[0].x = i_coordinates[0].x;
-		io_interpolated_character_ptr->coordinates[0].y = i_coordinates[0].y;
-		
-		//find segment length
-		seglength = AUCR_Rounding_Divide( distances[i_num_coordinates - 1],
-										 io_interpolated_character_ptr->num_directional_codes );
-		
-		//interpolate middle points
-		for( i = 1; i < io_interpolated_character_ptr->num_directional_codes; i++ )
+		//check the whole tile against one block of rows at a time
+		for( row = 0; row < i_compiled_alphabet_ptr->num_characters; row += AUCR_BATCH_ROWS )
 		{
-			//while the total distance from the start to the current coordinate
-			//is less than the current multiple of the segment length
-			while( ( distances[currentcoord] ) < (unsigned int)( i * seglength ) )
+			stoprow = row + AUCR_BATCH_ROWS;
+			if( stoprow > i_compiled_alphabet_ptr->num_characters )
 			{
-				//move to the next coordinate
-				currentcoord++;
+				stoprow = i_compiled_alphabet_ptr->num_characters;
+			}
+			
+			for( q = 0; q < count; q++ )
+			{
+				if( num_candidates[q] >= 0 )
+				{
+					AUCR_Compiled_Scan( i_compiled_alphabet_ptr,
+									   rows + ( q * i_compiled_alphabet_ptr->directional_code_stride ),
+									   measures + ( q * i_compiled_alphabet_ptr->num_activity_regions ),
+									   sums + ( q * tempworkspace->block_sum_stride ),
+									   row, stoprow, 1, &( candidates[q] ), &( num_candidates[q] ),
+									   &( tempworkspace->statistics ) );
+				}
 			}
-			//calculate parameter t that will give us the interpolated point
-			//when used in parametric equations for the current segment
-			t = AUCR_Rounding_Divide( (unsigned int) ( ( i * seglength ) - 
-													  distances[currentcoord - 1] ), AUCR_Rounding_Divide( 
-																										  ( distances[currentcoord] -
-																										   distances[currentcoord - 1] ), AUCR_SCALE ) );
-			//parametric equation for x
-			io_interpolated_character_ptr->coordinates[i].x = 
-			i_coordinates[currentcoord - 1].x + AUCR_Rounding_Divide( 
-																	 ( ( i_coordinates[currentcoord].x -
-																		i_coordinates[currentcoord - 1].x ) * t ), AUCR_SCALE );
-			//parametric equation for y
-			io_interpolated_character_ptr->coordinates[i].y = 
-			i_coordinates[currentcoord - 1].y + AUCR_Rounding_Divide( 
-																	 ( ( i_coordinates[currentcoord].y -
-																		i_coordinates[currentcoord - 1].y ) * t ), AUCR_SCALE );
 		}
 		
-		//last interpolated point is the same as last raw point
-		io_interpolated_character_ptr->coordinates[i].x = 
-		i_coordinates[i_num_coordinates - 1].x;
-		io_interpolated_character_ptr->coordinates[i].y =
-		i_coordinates[i_num_coordinates - 1].y;
+		//store the unicode of the closest row to each stroke
+		for( q = 0; q < count; q++ )
+		{
+			o_unicodes[first + q] = ( num_candidates[q] > 0 ) ? candidates[q].unicode : 0x0000;
+		}
+	}
+	
+	//free workspace memory unless it was given
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_WORKSPACE_Release( &tempworkspace );
 	}
 	
-	//return success
 	return( AUCR_ERR_SUCCESS );
 }
 
 
 /*
  *	Name:
- *		AUCR_INTERPOLATED_CHARACTER_From_Character()
+ *		AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Interpolated()
  *	Description:
- *		takes in a character and the alphabet that formed the character, as
- *		well as a rectangle (in pixels) and the border inside the rectangle
- *		and returns an interpolated character whose coordinates fill a
- *		rectangle of the given size while always staying a distance of
- *		border pixels from the edge of the rectangle.
- *		note: this function is primarily intended to be used as a mechanism
- *		to get points that can be written to screen, such that a character
- *		may be displayed.  it does not return an interpolated character
- *		that is identical to the interpolated character that was used to
- *		create the character in the alphabet.
+ *		finds characters in the compiled alphabet that are close to the interpolated
+ *		character given as an argument, first at the coarse resolution and then at
+ *		full resolution.  every row is checked by its coarse codes and activity
+ *		measures, which takes a fraction of the work of checking its directional
+ *		codes, and only the i_shortlist_size closest rows are checked by their
+ *		directional codes to choose up to i_max_candidates of them, closest first.
+ *		the candidates are the closest of the shortlist, so a larger shortlist
+ *		trades speed for agreement with
+ *		AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated(), and a
+ *		shortlist as large as the compiled alphabet gives exactly its candidates.
  *	Parameters:
- *		i_character_ptr -> a pointer to a character
- *		i_alphabet_ptr -> a pointer to the alphabet that was used to create the character
- *		i_rectangle_width -> the width in pixels of the bounding rectangle for the points
- *										in the interpolated character
- *		i_rectangle_height -> the height in pixels of the bounding rectangle for the points
- *										in the interpolated character
- *		i_rectangle_border -> the closest distance in pixels that any point in the
- *										interpolated character can come to the edge of the
- *										bounding rectangle
- *		io_interpolated charactercharacter_ptr <-> a pointer to an interpolated character
- *				that will be filled in by extrapolating information from the character
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the characters in
+ *			i_shortlist_size -> most rows to check at full resolution
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
- *		io_interpolated_character_ptr is non NULL and is a pointer to a valid
- *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
- *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
- *		character, i_rectangle_width is positive, i_rectangle_height is positive,
- *		i_rectangle_border is non negative, and num_directional_codes between
- *		the alphabet, character, and the interpolated character are in agreement
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		i_shortlist_size is from i_max_candidates to AUCR_COARSE_SHORTLIST,
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
  *	Postconditions:
- *		io_interpolated_character_ptr is populated with the interpolated version of the
- *		character in i_character_ptr
+ *		the closest characters of the shortlist have been found and are stored closest
+ *		first in o_candidates, and their number, the smaller of i_max_candidates and
+ *		the number of characters in the compiled alphabet, is stored at
+ *		o_num_candidates_ptr
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
  *													num_directional_codes are met
  */
-AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Character(
-													  AUCR_Character_Ptr i_character_ptr,
-													  AUCR_Alphabet_Ptr i_alphabet_ptr,
-													  int i_rectangle_width,
-													  int i_rectangle_height,
-													  int i_rectangle_border,
-													  AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr )
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Interpolated(
+																	 const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+																	 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+																	 int i_shortlist_size,
+																	 int i_max_candidates,
+																	 AUCR_Candidate * o_candidates,
+																	 int * o_num_candidates_ptr,
+																	 AUCR_Workspace_Ptr io_workspace_ptr )
 {
 	//local variables
-	int i, xoff, yoff, scale, div, nextDirCode;
-	int  xmin = 0, ymin = 0, xmax = 0, ymax = 0;
+	AUCR_Workspace_Ptr tempworkspace = NULL;
+	AUCR_Error temperror;
+	const int * tempmeasures;
+	unsigned long int difference;
+	int i, j, row, num_shortlisted;
 	
 	//check for valid input
-	if( io_interpolated_character_ptr == NULL ||
-	   i_alphabet_ptr == NULL || i_character_ptr == NULL )
+	if( i_interpolated_character_ptr == NULL || i_compiled_alphabet_ptr == NULL ||
+	   i_max_candidates < 1 || i_shortlist_size < i_max_candidates ||
+	   i_shortlist_size > AUCR_COARSE_SHORTLIST ||
+	   o_candidates == NULL || o_num_candidates_ptr == NULL )
 	{
 		return( AUCR_ERR_FAILED );
 	}
-	else if( io_interpolated_character_ptr->num_directional_codes
-			!= i_alphabet_ptr->num_directional_codes ||
-			io_interpolated_character_ptr->num_directional_codes
-			!= i_character_ptr->num_directional_codes ||
-			i_character_ptr->num_directional_codes
-			!= i_alphabet_ptr->num_directional_codes )
+	else if( i_interpolated_character_ptr->num_directional_codes !=
+			i_compiled_alphabet_ptr->num_directional_codes )
 	{
 		return( AUCR_ERR_CONFLICTING_PARAMETERS );
 	}
 	
-	//start at ( 0, 0 )
-	io_interpolated_character_ptr->coordinates[0].x = 0;
-	io_interpolated_character_ptr->coordinates[0].y = 0;
-	
-	//calculate remaining points, using a scale of AUCR_SCALE
-	//and an offset of ( 0, 0 )
-	for( i = 0; i < i_alphabet_ptr->num_directional_codes; i++ )
+	//use the workspace given, or create one for this call
+	if( io_workspace_ptr != NULL )
 	{
-		if( i_character_ptr->directional_codes[i] ==
-		   ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes - 1 ) )
-		{ 
-			nextDirCode = 0;
-		}
-		else
+		if( !AUCR_Workspace_Fits( io_workspace_ptr, i_compiled_alphabet_ptr->num_directional_codes,
+								 i_compiled_alphabet_ptr->num_activity_regions,
+								 i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes ) )
 		{
-			nextDirCode = i_character_ptr->directional_codes[i] + 1;
-		}
-		div = AUCR_Integer_Square_Root( 
-									   ( ( i_alphabet_ptr->directional_code_map_ptr->x[i_character_ptr->directional_codes[i]] +
-										  i_alphabet_ptr->directional_code_map_ptr->x[nextDirCode] ) *
-										( i_alphabet_ptr->directional_code_map_ptr->x[i_character_ptr->directional_codes[i]] +
-										 i_alphabet_ptr->directional_code_map_ptr->x[nextDirCode] ) ) +
-									   ( ( i_alphabet_ptr->directional_code_map_ptr->y[i_character_ptr->directional_codes[i]] +
-										  i_alphabet_ptr->directional_code_map_ptr->y[nextDirCode] ) *
-										( i_alphabet_ptr->directional_code_map_ptr->y[i_character_ptr->directional_codes[i]] +
-										 i_alphabet_ptr->directional_code_map_ptr->y[nextDirCode] ) ) );   
-		io_interpolated_character_ptr->coordinates[i + 1].x = ( AUCR_Rounding_Divide(
-																					 ( i_alphabet_ptr->directional_code_map_ptr->x[i_character_ptr->directional_codes[i]]
-																					  + i_alphabet_ptr->directional_code_map_ptr->x[nextDirCode] ) * AUCR_SCALE,
-																					 div ) + io_interpolated_character_ptr->coordinates[i].x );
-		io_interpolated_character_ptr->coordinates[i + 1].y = ( AUCR_Rounding_Divide(
-																					 ( i_alphabet_ptr->directional_code_map_ptr->y[i_character_ptr->directional_codes[i]]
-																					  + i_alphabet_ptr->directional_code_map_ptr->y[nextDirCode] ) * AUCR_SCALE,
-																					 div ) + io_interpolated_character_ptr->coordinates[i].y );
-		if( io_interpolated_character_ptr->coordinates[i + 1].x > xmax )
-		{
-			xmax = io_interpolated_character_ptr->coordinates[i + 1].x;
-		}
-		if( io_interpolated_character_ptr->coordinates[i + 1].x < xmin )
-		{
-			xmin = io_interpolated_character_ptr->coordinates[i + 1].x;
-		}
-		if( io_interpolated_character_ptr->coordinates[i + 1].y > ymax )
-		{
-			ymax = io_interpolated_character_ptr->coordinates[i + 1].y;
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
 		}
-		if( io_interpolated_character_ptr->coordinates[i + 1].y < ymin )
+		tempworkspace = io_workspace_ptr;
+	}
+	else
+	{
+		temperror = AUCR_WORKSPACE_Init_From_Compiled( i_compiled_alphabet_ptr, &tempworkspace );
+		if( temperror != AUCR_ERR_SUCCESS )
 		{
-			ymin = io_interpolated_character_ptr->coordinates[i + 1].y;
+			//if creation returns an error, throw it up
+			return( temperror );
 		}
 	}
 	
-	//calculate scale and offsets to map points to rectangle 
-	if( ( ( ymax - ymin ) * i_rectangle_width ) > ( ( xmax - xmin ) * i_rectangle_height ) )
+	//find the features of the interpolated character, and its coarse codes
+	AUCR_Compiled_Query( i_compiled_alphabet_ptr, i_interpolated_character_ptr->coordinates,
+						tempworkspace->hits, tempworkspace->character.directional_codes,
+						tempworkspace->character.activity_measures, tempworkspace->row,
+						tempworkspace->block_sums );
+	memset( tempworkspace->coarse_row, 0, i_compiled_alphabet_ptr->coarse_code_stride );
+	AUCR_Coarse_Codes( tempworkspace->row, i_compiled_alphabet_ptr->num_directional_codes,
+					  i_compiled_alphabet_ptr->num_coarse_codes,
+					  i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes,
+					  tempworkspace->coarse_row );
+	
+	//shortlist the closest rows at the coarse resolution
+	num_shortlisted = 0;
+	AUCR_Compiled_Shortlist( i_compiled_alphabet_ptr, tempworkspace->coarse_row,
+							tempworkspace->character.activity_measures, i_shortlist_size,
+							tempworkspace->shortlist, &num_shortlisted, &( tempworkspace->statistics ) );
+	
+	//check each row of the shortlist at full resolution
+	( *o_num_candidates_ptr ) = 0;
+	for( i = 0; i < num_shortlisted; i++ )
 	{
-		//y is the constraining direction
-		if( ( ymax - ymin ) < 10 * ( i_rectangle_height - ( 2 * i_rectangle_border ) ) )
+		row = tempworkspace->shortlist[i].index;
+		tempmeasures = i_compiled_alphabet_ptr->activity_measures +
+		( row * i_compiled_alphabet_ptr->activity_measure_stride );
+		
+		difference = 0;
+		for( j = 0; j < i_compiled_alphabet_ptr->num_activity_regions; j++ )
 		{
-			scale = AUCR_Rounding_Divide( 
-										 20 * ( i_rectangle_height - ( 2 * i_rectangle_border ) ), ( ymax - ymin ) );
-			xmax = xmax * scale;
-			ymax = ymax * scale;
-			xmin = xmin * scale;
-			ymin = ymin * scale;
-			for( i = 0; i <= i_alphabet_ptr->num_directional_codes; i++ )
-			{
-				io_interpolated_character_ptr->coordinates[i].x =
-				io_interpolated_character_ptr->coordinates[i].x * scale;
-				io_interpolated_character_ptr->coordinates[i].y =
-				io_interpolated_character_ptr->coordinates[i].y * scale;
-			}
+			difference += AUCR_Activity_Difference( tempworkspace->character.activity_measures[j],
+												   tempmeasures[j], i_compiled_alphabet_ptr->bias[j] );
 		}
+		difference += AUCR_SCALE * AUCR_Direction_Difference( tempworkspace->row,
+															  i_compiled_alphabet_ptr->directional_codes +
+															  ( row * i_compiled_alphabet_ptr->directional_code_stride ),
+															  i_compiled_alphabet_ptr->directional_code_stride,
+															  i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes );
 		
-		scale = ( i_rectangle_height - ( 2 * i_rectangle_border ) );
-		div = ( ymax - ymin );
-		
-		yoff = i_rectangle_border - AUCR_Rounding_Divide( ymin * scale, div );
-		xoff = i_rectangle_border - AUCR_Rounding_Divide( xmin * scale, div )
-		+ AUCR_Rounding_Divide( i_rectangle_width - ( 2 * 
-													 i_rectangle_border ) - AUCR_Rounding_Divide( 
-																								 ( xmax - xmin ) * scale, div ), 2 );
+		AUCR_Candidates_Offer( o_candidates, o_num_candidates_ptr, i_max_candidates,
+							  i_compiled_alphabet_ptr->unicodes[row],
+							  i_compiled_alphabet_ptr->indices[row], difference );
+	}
+	AUCR_Candidates_Sort( o_candidates, ( *o_num_candidates_ptr ) );
+	
+	//free workspace memory unless it was given
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_WORKSPACE_Release( &tempworkspace );
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Raw()
+ *	Description:
+ *		finds characters in the compiled alphabet that are close to the interpolated
+ *		character that is created from the raw data that is given, first at the
+ *		coarse resolution and then at full resolution, then returns up to
+ *		i_max_candidates of them, closest first
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			i_shortlist_size -> most rows to check at full resolution
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		i_shortlist_size is from i_max_candidates to AUCR_COARSE_SHORTLIST
+ *	Postconditions:
+ *		the closest characters of the shortlist have been found and are stored closest
+ *		first in o_candidates, and their number is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Raw(
+															 int i_num_coordinates,
+															 const AUCR_Coordinate * i_coordinates,
+															 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+															 int i_shortlist_size,
+															 int i_max_candidates,
+															 AUCR_Candidate * o_candidates,
+															 int * o_num_candidates_ptr,
+															 AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_compiled_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//take interpolated character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempinterpchar = &( io_workspace_ptr->interpolated_character );
 	}
 	else
 	{
-		//x is the constraining direction
-		if( ( xmax - xmin ) < 10 * ( i_rectangle_width - ( 2 * i_rectangle_border ) ) )
+		temperror = AUCR_INTERPOLATED_CHARACTER_Init( 0x0001,
+													 i_compiled_alphabet_ptr->num_directional_codes, &tempinterpchar );
+		if( temperror != AUCR_ERR_SUCCESS )
 		{
-			scale = AUCR_Rounding_Divide( 
-										 20 * ( i_rectangle_width - ( 2 * i_rectangle_border ) ), ( xmax - xmin ) );
-			xmax = xmax * scale;
-			ymax = ymax * scale;
-			xmin = xmin * scale;
-			ymin = ymin * scale; 
-			for( i = 0; i <= i_alphabet_ptr->num_directional_codes; i++ )
-			{
-				io_interpolated_character_ptr->coordinates[i].x =
-				io_interpolated_character_ptr->coordinates[i].x * scale;
-				io_interpolated_character_ptr->coordinates[i].y =
-				io_interpolated_character_ptr->coordinates[i].y * scale;
-			}
+			//if creation returns an error, throw it up
+			return( temperror );
 		}
-		
-		scale = ( i_rectangle_width - ( 2 * i_rectangle_border ) );
-		div = ( xmax - xmin );
-		
-		xoff = i_rectangle_border - AUCR_Rounding_Divide( xmin * scale, div );
-		yoff = i_rectangle_border - AUCR_Rounding_Divide( ymin * scale, div )
-		+ AUCR_Rounding_Divide( i_rectangle_height - ( 2 * 
-													  i_rectangle_border ) - AUCR_Rounding_Divide( 
-																								  ( ymax - ymin ) * scale, div ), 2 );
 	}
 	
-	//loop through all points, scaling, then offsetting them
-	for( i = 0; i <= i_alphabet_ptr->num_directional_codes; i++ )
+	//convert raw coordinates to interpolated character
+	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
+													 i_num_coordinates, i_coordinates, tempinterpchar,
+													 io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
 	{
-		io_interpolated_character_ptr->coordinates[i].x = xoff +
-		AUCR_Rounding_Divide( 
-							 io_interpolated_character_ptr->coordinates[i].x * scale, div );
-		io_interpolated_character_ptr->coordinates[i].y = yoff +
-		AUCR_Rounding_Divide( 
-							 io_interpolated_character_ptr->coordinates[i].y * scale, div );
+		//if conversion returns an error, throw it up
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		}
+		return( temperror );
 	}
 	
-	//return success
-	return( AUCR_ERR_SUCCESS );
+	//call interpolated_recognize
+	temperror = AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Interpolated(
+																		  tempinterpchar, i_compiled_alphabet_ptr, i_shortlist_size,
+																		  i_max_candidates, o_candidates, o_num_candidates_ptr,
+																		  io_workspace_ptr );
+	
+	//free interpolated character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	}
+	
+	//return value returned by interpolated_recognize
+	return( temperror );
 }
 
 
 /*
  *	Name:
- *		AUCR_DIRECTIONAL_CODE_MAP_Init()
+ *		AUCR_COMPILED_ALPHABET_Query_From_Interpolated()
  *	Description:
- *		Initializes a new AUCR_Directional_Code_Map instance by allocating appropriate
- *		memories and setting member values.
+ *		finds the features of an interpolated character for a compiled alphabet, the
+ *		same way its recognizers do, and leaves them in the workspace: the directional
+ *		codes and activity measures in its character, and the directional codes packed
+ *		like a row of the compiled alphabet in its row.  this lets recognizers outside
+ *		of this file, such as the fixed geometry ones of AUCRTemplate.h, score the rows
+ *		of a compiled alphabet themselves.
  *	Parameters:
- *		i_mappable_directional_codes -> i_number of unique directional codes to allocate memory
- *							for their mappings.
- *		o_directional_code_map_ptr_ptr <- memory address of the AUCR_Directional_Code_Map_Ptr
- *							to be populated with the new AUCR_Directional_Code_Map.
+ *			i_interpolated_character_ptr -> interpolated character to find the features of
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find them for
+ *			io_workspace_ptr <-> workspace to leave the features in
  *	Preconditions:
- *		i_mappable_directional_codes must be a positive, non-zero values.
- *		The AUCR_Directional_Code_Map_Ptr at o_directional_code_map_ptr_ptr must be NULL.
- *	Postconditions:
- *		o_directional_code_map_ptr_ptr is the address of a newly allocated and initialized
- *		AUCR_Directional_Code_Map_Ptr.  Its "x" and "y" variables are newly allocated arrays
- *		of (mappable_directional_codes) elements... each element set to zero.
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		io_workspace_ptr is a valid workspace sized for the compiled alphabet, and
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
+ *	Postconditions:
+ *		the features of the interpolated character are in the workspace
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *							num_directional_codes, or of the workspace with the compiled
+ *							alphabet, are met
  */
-AUCR_Error AUCR_DIRECTIONAL_CODE_MAP_Init(
-										  int i_mappable_directional_codes,
-										  AUCR_Directional_Code_Map_Ptr * o_directional_code_map_ptr_ptr )
+AUCR_Error AUCR_COMPILED_ALPHABET_Query_From_Interpolated(
+														   const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+														   const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+														   AUCR_Workspace_Ptr io_workspace_ptr )
 {
-	//declare local variables
-	int i;
-	
 	//check for valid input
-	if( ( i_mappable_directional_codes < 1 ) || ( o_directional_code_map_ptr_ptr == NULL )
-	   || ( ( * o_directional_code_map_ptr_ptr ) != NULL ) )
+	if( i_interpolated_character_ptr == NULL || i_compiled_alphabet_ptr == NULL ||
+	   io_workspace_ptr == NULL )
 	{
 		return( AUCR_ERR_FAILED );
 	}
-	
-	//malloc space for Directional_Code_Map
-	( * o_directional_code_map_ptr_ptr ) = 
-	( AUCR_Directional_Code_Map_Ptr )malloc( sizeof( AUCR_Directional_Code_Map ) );
-	if( ( * o_directional_code_map_ptr_ptr ) == NULL )
-	{
-		return( AUCR_ERR_NO_MEMORY );
-	}
-	
-	//malloc space for x array
-	( * o_directional_code_map_ptr_ptr )->x = 
-	(int *)malloc( sizeof( int ) * ( i_mappable_directional_codes ) );
-	if( ( * o_directional_code_map_ptr_ptr )->x == NULL )
-	{
-		free( * o_directional_code_map_ptr_ptr );
-		return( AUCR_ERR_NO_MEMORY );
-	}
-	
-	//malloc space for y array
-	( * o_directional_code_map_ptr_ptr )->y = 
-	(int *)malloc( sizeof( int ) * ( i_mappable_directional_codes ) );
-	if( ( * o_directional_code_map_ptr_ptr )->y == NULL )
+	else if( i_interpolated_character_ptr->num_directional_codes !=
+			i_compiled_alphabet_ptr->num_directional_codes ||
+			!AUCR_Workspace_Fits( io_workspace_ptr, i_compiled_alphabet_ptr->num_directional_codes,
+								 i_compiled_alphabet_ptr->num_activity_regions,
+								 i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes ) )
 	{
-		free( * o_directional_code_map_ptr_ptr );
-		free( ( * o_directional_code_map_ptr_ptr )->x );
-		return( AUCR_ERR_NO_MEMORY );
+		return( AUCR_ERR_CONFLICTING_PARAMETERS );
 	}
 	
-	//memory allocation all good
-	//fill in structure
-	( * o_directional_code_map_ptr_ptr )->mappable_directional_codes = 
-	i_mappable_directional_codes;
-	//zero out array entries
-	for( i = 0; i < ( i_mappable_directional_codes ); i++ )
-	{
-		( * o_directional_code_map_ptr_ptr )->x[i] = 0;
-		( * o_directional_code_map_ptr_ptr )->y[i] = 0;
-	}
+	//find the features of the interpolated character
+	AUCR_Compiled_Query( i_compiled_alphabet_ptr, i_interpolated_character_ptr->coordinates,
+						io_workspace_ptr->hits, io_workspace_ptr->character.directional_codes,
+						io_workspace_ptr->character.activity_measures, io_workspace_ptr->row,
+						io_workspace_ptr->block_sums );
 	
-	//return success
 	return( AUCR_ERR_SUCCESS );
 }
 
 
 /*
  *	Name:
- *		AUCR_DIRECTIONAL_CODE_MAP_Release()
+ *		AUCR_WORKSPACE_Init()
  *	Description:
- *		Frees all dynamically allocated memories for the AUCR_Directional_Code_Map
- *		and NULLs the AUCR_Directional_Code_Map_Ptr.
+ *		Initializes a new AUCR_Workspace sized for an alphabet, so that recognizing
+ *		against the alphabet, or any compiled alphabet compiled from it, needs no
+ *		further memory as long as strokes are no longer than the workspace has room for.
+ *		A workspace may only be used by one recognition at a time.
  *	Parameters:
- *		io_directional_code_map_ptr_ptr <-> address of the AUCR_Directional_Code_Map memory to be freed.
+ *		i_alphabet_ptr -> pointer to the alphabet the workspace will be used with
+ *		o_workspace_ptr_ptr <- address of the AUCR_Workspace_Ptr to be populated
+ *							with the new AUCR_Workspace
  *	Preconditions:
- *		The AUCR_Directional_Code_Map_Ptr at io_directional_code_map_ptr_ptr
- *		is a valid address of an AUCR_Directional_Code_Map.
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet.  The AUCR_Workspace_Ptr
+ *		at o_workspace_ptr_ptr must be NULL.
  *	Postconditions:
- *		The AUCR_Directional_Code_Map's "x" and "y" arrays are freed
- *		followed by the memory for the AUCR_Directional_Code_Map as well.
- *		The AUCR_Directional_Code_Map_Ptr at io_directional_code_map_ptr_ptr
- *		is NULL.
+ *		o_workspace_ptr_ptr points to a newly allocated workspace with room for
+ *		AUCR_WORKSPACE_COORDINATES raw coordinates
  *	Returns:
- *		none
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  */
-void AUCR_DIRECTIONAL_CODE_MAP_Release(
-									   AUCR_Directional_Code_Map_Ptr * io_directional_code_map_ptr_ptr )
+AUCR_Error AUCR_WORKSPACE_Init(
+							   const AUCR_Alphabet * i_alphabet_ptr,
+							   AUCR_Workspace_Ptr * o_workspace_ptr_ptr )
 {
 	//check for valid input
-	if( ( io_directional_code_map_ptr_ptr == NULL ) ||
-	   ( ( * io_directional_code_map_ptr_ptr ) == NULL ) )
+	if( i_alphabet_ptr == NULL || i_alphabet_ptr->directional_code_map_ptr == NULL ||
+	   o_workspace_ptr_ptr == NULL || ( *o_workspace_ptr_ptr ) != NULL ||
+	   i_alphabet_ptr->num_directional_codes < 1 || i_alphabet_ptr->num_activity_regions < 1 ||
+	   i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes < 1 )
 	{
-		return;
+		return( AUCR_ERR_FAILED );
 	}
 	
-	//free y array
-	free( ( * io_directional_code_map_ptr_ptr )->y );
-	
-	//free x array
-	free( ( * io_directional_code_map_ptr_ptr )->x );
-	
-	//free Directional_Code_Map structure
-	free( * io_directional_code_map_ptr_ptr );
-	
-	//NULL the structure pointer
-	( * io_directional_code_map_ptr_ptr ) = NULL;
-	
-	return;
+	return( AUCR_Workspace_Create( i_alphabet_ptr->num_directional_codes,
+								  i_alphabet_ptr->num_activity_regions,
+								  i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes,
+								  o_workspace_ptr_ptr ) );
 }
 
 
 /*
  *	Name:
- *		AUCR_DIRECTIONAL_CODE_MAP_Finalize()
+ *		AUCR_WORKSPACE_Init_From_Compiled()
  *	Description:
- *		Prepares a directional code map instance for use in converting from interpolated
- *		characters to characters in the alphabet by setting up data structures required for
- *		arbitrary directional code lookup from arbitrary vectors.
+ *		Initializes a new AUCR_Workspace sized for a compiled alphabet, exactly as
+ *		AUCR_WORKSPACE_Init() does for the alphabet it was compiled from.
  *	Parameters:
- *		io_directional_code_map_ptr <- pointer to AUCR_Directional_Code_Map that has been
- *							filled in completely with mappable_direction_codes (x, y) pairs.
+ *		i_compiled_alphabet_ptr -> pointer to the compiled alphabet the workspace will be used with
+ *		o_workspace_ptr_ptr <- address of the AUCR_Workspace_Ptr to be populated
+ *							with the new AUCR_Workspace
  *	Preconditions:
- *		io_directional_code_map_ptr is non NULL and points to a valid directional code map
- *		that has mappable_directional_codes (x,y) pairs that each describe the vector that
- *		the begginning of a directional region, and all directional vectors, are in
- *		counterclockwise order, starting from the zeroeth direcional code
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet.  The
+ *		AUCR_Workspace_Ptr at o_workspace_ptr_ptr must be NULL.
  *	Postconditions:
- *		positive_begin, positive_end, negative_begin, and negative_end have all been set
- *		to their appropriate values.
+ *		o_workspace_ptr_ptr points to a newly allocated workspace with room for
+ *		AUCR_WORKSPACE_COORDINATES raw coordinates
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  */
-AUCR_Error AUCR_DIRECTIONAL_CODE_MAP_Finalize(
-											  AUCR_Directional_Code_Map_Ptr io_directional_code_map_ptr )
+AUCR_Error AUCR_WORKSPACE_Init_From_Compiled(
+											 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+											 AUCR_Workspace_Ptr * o_workspace_ptr_ptr )
 {
-	//declare local variables
-	int i;
-	int posBeginX = 0;
-	int posBeginY = 1;
-	int posEndX = 0;
-	int posEndY = -1;
-	int negBeginX = 0;
-	int negBeginY = -1;
-	int negEndX = 0;
-	int negEndY = 1;
-	
-	
 	//check for valid input
-	if( io_directional_code_map_ptr == NULL )
+	if( i_compiled_alphabet_ptr == NULL ||
+	   o_workspace_ptr_ptr == NULL || ( *o_workspace_ptr_ptr ) != NULL )
 	{
 		return( AUCR_ERR_FAILED );
 	}
 	
-	//intitialize structure variables to their not found state
-	io_directional_code_map_ptr->positive_begin = -1;
-	io_directional_code_map_ptr->positive_end = -1;
-	io_directional_code_map_ptr->negative_begin = -1;
-	io_directional_code_map_ptr->negative_end = -1;
-	
-	//find correct values for structure variables, if they exist
-	for( i = 0; i < io_directional_code_map_ptr->mappable_directional_codes; i++ )
-	{
-		if( io_directional_code_map_ptr->x[i] > 0 )
-		{
-			if( ( io_directional_code_map_ptr->x[i] * posBeginY ) >= ( io_directional_code_map_ptr->y[i] * posBeginX ) )
-			{
-				io_directional_code_map_ptr->positive_begin = i;
-				posBeginX = io_directional_code_map_ptr->x[i];
-				posBeginY = io_directional_code_map_ptr->y[i];
-			}
-			if( ( io_directional_code_map_ptr->x[i] * posEndY ) <= ( io_directional_code_map_ptr->y[i] * posEndX ) )
-			{
-				io_directional_code_map_ptr->positive_end = i;
-				posEndX = io_directional_code_map_ptr->x[i];
-				posEndY = io_directional_code_map_ptr->y[i];
-			}
-		}
-		else
-		{
-			if( ( io_directional_code_map_ptr->x[i] * negBeginY ) >= ( io_directional_code_map_ptr->y[i] * negBeginX ) )
-			{
-				io_directional_code_map_ptr->negative_begin = i;
-				negBeginX = io_directional_code_map_ptr->x[i];
-				negBeginY = io_directional_code_map_ptr->y[i];
-			}
-			if( ( io_directional_code_map_ptr->x[i] * negEndY ) <= ( io_directional_code_map_ptr->y[i] * negEndX ) )
-			{
-				io_directional_code_map_ptr->negative_end = i;
-				negEndX = io_directional_code_map_ptr->x[i];
-				negEndY = io_directional_code_map_ptr->y[i];
-			}
-		}
-	}
-	
-	//return success
-	return( AUCR_ERR_SUCCESS );
+	return( AUCR_Workspace_Create( i_compiled_alphabet_ptr->num_directional_codes,
+								  i_compiled_alphabet_ptr->num_activity_regions,
+								  i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes,
+								  o_workspace_ptr_ptr ) );
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Init()
+ *		AUCR_WORKSPACE_Reserve()
  *	Description:
- *		Initializes a new AUCR_ALPHABET instance by allocating appropriate
- *		memories and setting member values.
+ *		makes sure a workspace has room for the distances of a stroke of the given
+ *		number of raw coordinates, at least doubling its room whenever it must grow.
+ *		calling this once with the longest expected stroke keeps every later
+ *		recognition free of memory allocation.
  *	Parameters:
- *		i_directional_code_map_ptr -> the memory address of a directional code
- *							map structure that is used to fill in the directional
- *							code map used by the alphabet.
- *		i_num_activity_regions -> number of activity regions for to allocate
- *							activity measure memories for.
- *		i_num_directional_codes -> number of directional codes to allocate memory
- *							for.
- *		o_alphabet_ptr_ptr <- memory address of the AUCR_Alphabet_Ptr to be
- *							populated with the new AUCR_Alphabet_Ptr which points to
- *							new AUCR_Alphabet.
+ *		i_num_coordinates -> number of raw coordinates to make room for
+ *		io_workspace_ptr <-> pointer to the workspace to grow
  *	Preconditions:
- *		The *AUCR_Alphabet_Ptr at o_alphabet_ptr_ptr
- *		is a valid address of a AUCR_Alphabet_Prt that
- *		is currently set to NULL. i_directional_code_map_ptr
- *		is a valide pointer. i_num_activity_regions,
- *		and i_num_directional_codes, are positive, nonzero numbers.
+ *		i_num_coordinates is positive and io_workspace_ptr is a valid workspace
  *	Postconditions:
- *		the structure pointed to by i_directional_code_map_ptr has been copied,
- *		the values held by i_num_activity_regions and i_num_directional_codes
- *		have been stored, bias is new array of biases(length i_num_activity_regions),
- *		activity_regions is a new array of activity regions (length i_num_activity_regions),
- *		characters_ptr_ptr is set to NULL (to prepare it for realloc), num_characters
- *		is set to zero, and o_alphabet_ptr_ptr points to an AUCR_Alphabet_Ptr which in turn points
- *		to a newly created AUCR_Alphabet structure which contains all the previous information.
+ *		the workspace has room for at least i_num_coordinates raw coordinates, and
+ *		is unchanged if it could not be grown
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_NO_MEMORY if the array memory could not be allocated
  */
-AUCR_Error AUCR_ALPHABET_Init(
-							  AUCR_Directional_Code_Map_Ptr i_directional_code_map_ptr,
-							  int i_num_activity_regions,
-							  int i_num_directional_codes,
-							  AUCR_Alphabet_Ptr * o_alphabet_ptr_ptr )
+AUCR_Error AUCR_WORKSPACE_Reserve(
+								  int i_num_coordinates,
+								  AUCR_Workspace_Ptr io_workspace_ptr )
 {
 	//local variables
-	int i, tempbias;
-	AUCR_Error temperror;
+	unsigned int * tempdistances;
+	int tempnum;
 	
-	//verify input
-	if( i_num_activity_regions <=0 || i_num_directional_codes <= 0 ||
-	   o_alphabet_ptr_ptr == NULL || *o_alphabet_ptr_ptr != NULL ||
-	   i_directional_code_map_ptr == NULL )
+	//check for valid input
+	if( i_num_coordinates < 1 || io_workspace_ptr == NULL )
 	{
-		//bad input, return
 		return( AUCR_ERR_FAILED );
 	}
 	
-	//allocate memory for alphabet structure
-	( *o_alphabet_ptr_ptr ) = ( AUCR_Alphabet_Ptr ) malloc( sizeof( AUCR_Alphabet ) );
-	if( ( *o_alphabet_ptr_ptr ) == NULL )
+	if( i_num_coordinates <= io_workspace_ptr->num_distances )
 	{
-		//unable to get memory, return
-		return( AUCR_ERR_NO_MEMORY );
+		return( AUCR_ERR_SUCCESS );
 	}
 	
-	//allocate memory for new directional code map stucture
-	( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr ) = NULL;
-	temperror = AUCR_DIRECTIONAL_CODE_MAP_Init( 
-											   i_directional_code_map_ptr->mappable_directional_codes,
-											   &( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
-	if( temperror != AUCR_ERR_SUCCESS )
+	//at least double the room, so that growing strokes grow it rarely
+	tempnum = 2 * io_workspace_ptr->num_distances;
+	if( tempnum < i_num_coordinates )
 	{
-		//if there is an error, throw it up
-		free( *o_alphabet_ptr_ptr );
-		return( temperror );
+		tempnum = i_num_coordinates;
 	}
 	
-	//allocate memory for activity region arrays
-	( ( *o_alphabet_ptr_ptr )->activity_regions ) = 
-	( AUCR_Activity_Region_Ptr )malloc( i_num_activity_regions * sizeof( AUCR_Activity_Region ) );
-	if( ( ( *o_alphabet_ptr_ptr )->activity_regions ) == NULL )
+	tempdistances = (unsigned int *)realloc( io_workspace_ptr->distances,
+											tempnum * sizeof( unsigned int ) );
+	if( tempdistances == NULL )
 	{
-		free( ( *o_alphabet_ptr_ptr ) );
-		AUCR_DIRECTIONAL_CODE_MAP_Release( &( ( * o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
 		return( AUCR_ERR_NO_MEMORY );
 	}
+	io_workspace_ptr->distances = tempdistances;
+	io_workspace_ptr->num_distances = tempnum;
 	
-	//allocate memory for activity region biases
-	( ( *o_alphabet_ptr_ptr )->bias ) = (int *)malloc( i_num_activity_regions * sizeof( int ) );
-	if( ( ( *o_alphabet_ptr_ptr )->bias ) == NULL )
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_WORKSPACE_Release()
+ *	Description:
+ *		Frees all memories of the AUCR_Workspace and the structure itself,
+ *		and NULLs the AUCR_Workspace_Ptr.
+ *	Parameters:
+ *		io_workspace_ptr_ptr <-> address of the AUCR_Workspace to be freed.
+ *	Preconditions:
+ *		The AUCR_Workspace_Ptr at io_workspace_ptr_ptr is NULL or the address of an
+ *		AUCR_Workspace created by AUCR_WORKSPACE_Init() or AUCR_WORKSPACE_Init_From_Compiled().
+ *	Postconditions:
+ *		all memory of the workspace is freed and the AUCR_Workspace_Ptr at
+ *		io_workspace_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_WORKSPACE_Release(
+							AUCR_Workspace_Ptr * io_workspace_ptr_ptr )
+{
+	if( io_workspace_ptr_ptr == NULL || ( *io_workspace_ptr_ptr ) == NULL )
 	{
-		free( ( *o_alphabet_ptr_ptr ) );
-		AUCR_DIRECTIONAL_CODE_MAP_Release( &( ( * o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
-		free( ( *o_alphabet_ptr_ptr )->activity_regions );
-		return( AUCR_ERR_NO_MEMORY );
+		return;
 	}
 	
-	//memory allocated, errors avoided, go ahead and fill in values
-	( ( *o_alphabet_ptr_ptr )->num_directional_codes ) = i_num_directional_codes;
-	( ( *o_alphabet_ptr_ptr )->num_activity_regions ) = i_num_activity_regions;
-	( ( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr )->mappable_directional_codes ) =
-    i_directional_code_map_ptr->mappable_directional_codes;      
-	( ( *o_alphabet_ptr_ptr )->num_characters ) = 0;
-	( ( *o_alphabet_ptr_ptr )->characters_ptr_ptr ) = NULL;
+	free( ( *io_workspace_ptr_ptr )->distances );
+	free( ( *io_workspace_ptr_ptr )->block );
+	free( *io_workspace_ptr_ptr );
+	( *io_workspace_ptr_ptr ) = NULL;
 	
-	//copy x and y arrays from i_directional code map into
-	//directional code map in the alphabet
-	for( i = 0; i < i_directional_code_map_ptr->mappable_directional_codes; i++ )
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Init()
+ *	Description:
+ *		builds a vantage point tree over the rows of a compiled alphabet, so that the
+ *		closest rows to a character can be found without checking every row.  the
+ *		distance the tree is built on is the square root of the sum of the squared
+ *		circular directional code distances, which is a true metric, so the triangle
+ *		inequality bounds the directional code difference of every row below a node.
+ *		the activity measure differences are never less than zero, so the candidates
+ *		found with the tree are those the linear recognizers find.
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to index
+ *		o_index_ptr_ptr <- address of the AUCR_Index_Ptr to be populated with the new
+ *							AUCR_Index
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet that will
+ *		outlive the index.  The AUCR_Index_Ptr at o_index_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_index_ptr_ptr points to a newly allocated index over the compiled alphabet,
+ *		and the compiled alphabet is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet, or if the directional code
+ *							distances of the compiled alphabet are too large to index
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_INDEX_Init(
+						   const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+						   AUCR_Index_Ptr * o_index_ptr_ptr )
+{
+	//local variables
+	AUCR_Index_Ptr tempindex;
+	int * rows;
+	unsigned long * distances;
+	unsigned long farthest;
+	int i, num_nodes;
+	
+	//check for valid input
+	if( i_compiled_alphabet_ptr == NULL || o_index_ptr_ptr == NULL ||
+	   ( *o_index_ptr_ptr ) != NULL || i_compiled_alphabet_ptr->num_characters < 0 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//the farthest any two rows can be, in steps squared, must fit
+	farthest = (unsigned long)( i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes / 2 );
+	farthest = farthest * farthest;
+	if( farthest > ( ULONG_MAX / AUCR_SCALE / AUCR_INDEX_RESOLUTION / AUCR_INDEX_RESOLUTION /
+					( i_compiled_alphabet_ptr->num_directional_codes ) ) )
 	{
-		( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr )->x[i] = i_directional_code_map_ptr->x[i];
-		( ( *o_alphabet_ptr_ptr )->directional_code_map_ptr )->y[i] = i_directional_code_map_ptr->y[i];
+		return( AUCR_ERR_FAILED );
 	}
 	
-	//finalize internal dircode map
-	temperror = AUCR_DIRECTIONAL_CODE_MAP_Finalize( 
-												   ( *o_alphabet_ptr_ptr )->directional_code_map_ptr );
-	if( temperror != AUCR_ERR_SUCCESS )
+	//allocate structure memory
+	tempindex = (AUCR_Index_Ptr)malloc( sizeof( AUCR_Index ) );
+	if( tempindex == NULL )
 	{
-		free( ( *o_alphabet_ptr_ptr ) );
-		AUCR_DIRECTIONAL_CODE_MAP_Release( 
-										  &( ( * o_alphabet_ptr_ptr )->directional_code_map_ptr ) );
-		free( ( *o_alphabet_ptr_ptr )->activity_regions );
-		free( ( *o_alphabet_ptr_ptr )->bias );
-		return( temperror );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	tempindex->compiled_alphabet_ptr = i_compiled_alphabet_ptr;
+	tempindex->num_nodes = i_compiled_alphabet_ptr->num_characters;
+	
+	//allocate node memory, and scratch memory for building
+	tempindex->nodes = (AUCR_Index_Node_Ptr)malloc( ( tempindex->num_nodes + 1 ) * sizeof( AUCR_Index_Node ) );
+	rows = (int *)malloc( ( tempindex->num_nodes + 1 ) * sizeof( int ) );
+	distances = (unsigned long *)malloc( ( tempindex->num_nodes + 1 ) * sizeof( unsigned long ) );
+	if( tempindex->nodes == NULL || rows == NULL || distances == NULL )
+	{
+		free( distances );
+		free( rows );
+		free( tempindex->nodes );
+		free( tempindex );
+		return( AUCR_ERR_NO_MEMORY );
 	}
 	
-	//fill in bias array
-	tempbias = AUCR_SCALE;
-	//  tempbias = AUCR_Rounding_Divide( AUCR_SCALE * i_num_directional_codes *
-	//      ( i_directional_code_map_ptr->mappable_directional_codes / 2 ) *
-	//      ( i_directional_code_map_ptr->mappable_directional_codes / 2 ),
-	//      i_num_activity_regions 
-	//      * ( i_directional_code_map_ptr->mappable_directional_codes + 1 )
-	//      * ( i_directional_code_map_ptr->mappable_directional_codes + 1 ) );
-	for( i = 0; i < i_num_activity_regions; i++ )
+	//build the tree over every row
+	for( i = 0; i < tempindex->num_nodes; i++ )
 	{
-		( *o_alphabet_ptr_ptr )->bias[i] = tempbias;
+		rows[i] = i;
 	}
+	num_nodes = 0;
+	AUCR_Index_Build( tempindex, rows, distances, tempindex->num_nodes, &num_nodes );
+	
+	free( distances );
+	free( rows );
+	
+	( *o_index_ptr_ptr ) = tempindex;
 	
-	//all done, return success
 	return( AUCR_ERR_SUCCESS );
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Release()
+ *		AUCR_INDEX_Release()
  *	Description:
- *		Frees all dynamically allocated memories for the AUCR_ALPHABET_Release
- *		and NULLs the AUCR_Alphabet_Ptr.
+ *		Frees the nodes of the AUCR_Index and the structure itself, and NULLs the
+ *		AUCR_Index_Ptr.  the compiled alphabet the index was built over is not freed.
  *	Parameters:
- *		io_alphabet_ptr_ptr <-> address of the AUCR_Alphabet memory to be freed.
+ *		io_index_ptr_ptr <-> address of the AUCR_Index to be freed.
  *	Preconditions:
- *		The AUCR_Alphabet_Ptr at io_alphabet_ptr_ptr
- *		is a valid address of an AUCR_Alphabet.
+ *		The AUCR_Index_Ptr at io_index_ptr_ptr is NULL or the address of an
+ *		AUCR_Index created by AUCR_INDEX_Init().
  *	Postconditions:
- *		num_characters AUCR_Characters have been freed, the characters_ptr_ptr array
- *		has been freed, the biases array has been freed, the activity_regions array
- *		has been freed, the AUCR_Directional_Code_Map has been freed, the AUCR_Alphabet
- *		structure has been freed and the AUCR_Alphabet_Ptr at io_alphabet_ptr_ptr has
- *		been set to NULL.
+ *		all memory of the index is freed and the AUCR_Index_Ptr at io_index_ptr_ptr
+ *		is NULL.
  *	Returns:
  *		none
  */
-void AUCR_ALPHABET_Release(
-						   AUCR_Alphabet_Ptr * io_alphabet_ptr_ptr )
+void AUCR_INDEX_Release(
+						AUCR_Index_Ptr * io_index_ptr_ptr )
+{
+	if( io_index_ptr_ptr == NULL || ( *io_index_ptr_ptr ) == NULL )
+	{
+		return;
+	}
+	
+	free( ( *io_index_ptr_ptr )->nodes );
+	free( *io_index_ptr_ptr );
+	( *io_index_ptr_ptr ) = NULL;
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Recognize_From_Interpolated()
+ *	Description:
+ *		finds the character in the indexed compiled alphabet that is closest to the
+ *		interpolated character given as an argument and return the unicode of this
+ *		found character
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_index_ptr -> address of the index to find the character with
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_index_ptr is a valid pointer to an index over a compiled alphabet with at least
+ *		one character, num_directional_codes between the compiled alphabet and the
+ *		character is in agreement
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_INDEX_Recognize_From_Interpolated(
+												  const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+												  const AUCR_Index * i_index_ptr,
+												  wchar_t * o_unicode_ptr,
+												  AUCR_Workspace_Ptr io_workspace_ptr )
 {
 	//local variables
-	int i;
+	AUCR_Candidate tempcandidate;
+	int num_candidates;
+	AUCR_Error temperror;
 	
 	//check for valid input
-	if( ( io_alphabet_ptr_ptr == NULL ) && ( ( *io_alphabet_ptr_ptr ) == NULL ) )
+	if( i_interpolated_character_ptr == NULL || i_index_ptr == NULL ||
+	   o_unicode_ptr == NULL || i_index_ptr->num_nodes < 1 )
 	{
-		return;
+		return( AUCR_ERR_FAILED );
 	}
 	
-	//free directional code map
-	AUCR_DIRECTIONAL_CODE_MAP_Release( &( *io_alphabet_ptr_ptr )->directional_code_map_ptr );
-	
-	//free characters in character array
-	for( i = 0; i < ( *io_alphabet_ptr_ptr )->num_characters; i++ )
+	//the closest character is the only candidate of a search for one
+	temperror = AUCR_INDEX_Recognize_Candidates_From_Interpolated(
+																  i_interpolated_character_ptr, i_index_ptr, 1,
+																  &tempcandidate, &num_candidates, io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
 	{
-		free( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i] );
+		return( temperror );
 	}
 	
-	//free character array itself
-	free( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr );
+	//place unicode value of closest row in o_unicode_ptr
+	( *o_unicode_ptr ) = tempcandidate.unicode;
 	
-	//free activity regions array
-	free( ( *io_alphabet_ptr_ptr )->activity_regions );
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Recognize_From_Raw()
+ *	Description:
+ *		finds the character in the indexed compiled alphabet that is closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then return the unicode of this found character
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_index_ptr -> pointer to index to search with
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_index_ptr is a valid pointer to an index over a compiled alphabet with at
+ *		least one character
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_INDEX_Recognize_From_Raw(
+										 int i_num_coordinates,
+										 const AUCR_Coordinate * i_coordinates,
+										 const AUCR_Index * i_index_ptr,
+										 wchar_t * o_unicode_ptr,
+										 AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Candidate tempcandidate;
+	int num_candidates;
+	AUCR_Error temperror;
 	
-	//free bias array
-	free( ( *io_alphabet_ptr_ptr )->bias );
+	//check for valid input
+	if( i_index_ptr == NULL || o_unicode_ptr == NULL || i_index_ptr->num_nodes < 1 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
 	
-	//free alphabet structure
-	free( ( *io_alphabet_ptr_ptr ) );
+	//the closest character is the only candidate of a search for one
+	temperror = AUCR_INDEX_Recognize_Candidates_From_Raw(
+														 i_num_coordinates, i_coordinates, i_index_ptr, 1,
+														 &tempcandidate, &num_candidates, io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
 	
-	//NULL alphabet structure pointer
-	( *io_alphabet_ptr_ptr ) = NULL;
+	//place unicode value of closest row in o_unicode_ptr
+	( *o_unicode_ptr ) = tempcandidate.unicode;
 	
-	return;
+	return( AUCR_ERR_SUCCESS );
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Add_Interpolated_Character()
+ *		AUCR_INDEX_Recognize_Candidates_From_Interpolated()
  *	Description:
- *		Adds the specified character to the specified alphabet
+ *		finds the characters in the indexed compiled alphabet that are closest to the
+ *		interpolated character given as an argument, and returns up to
+ *		i_max_candidates of them, closest first.  a node's rows are skipped once the
+ *		bound on their difference is farther than the farthest of the closest
+ *		candidates found so far.  each row's difference is the whole sum of its
+ *		activity measure and directional code differences, ties going to the lowest
+ *		index, so the candidates are exactly the closest rows by that sum.  these are
+ *		the candidates AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated()
+ *		gives.
  *	Parameters:
- *		i_interpolated_character_ptr -> address of an interpolated character
- *		io_alphabet_ptr -> address of the alphabet to add the character to
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_index_ptr -> address of the index to find the characters with
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
- *		i_interpolated_character_ptr is the address of a valid AUCR_Interpolated_Character,
- *		io_alphabet_ptr is the address of a valid AUCR_Alphabet, and the num_directional_codes
- *		for the alphabet is in agreement with the num_directional_codes for the character
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_index_ptr is a valid pointer to a valid index,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
  *	Postconditions:
- *		interpolated character has been converted to character, characters_ptr_ptr is
- *		reallocated to have room for new character, which is stored in character array
- *		of the alphabet, num_characters has been incremented by 1,
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number, the smaller of i_max_candidates
+ *		and the number of characters in the compiled alphabet, is stored at
+ *		o_num_candidates_ptr
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
@@ -1194,709 +9024,924 @@ void AUCR_ALPHABET_Release(
  *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
  *													num_directional_codes are met
  */
-AUCR_Error AUCR_ALPHABET_Add_Interpolated_Character(
-													AUCR_Interpolated_Character_Ptr i_interpolated_character_ptr,
-													AUCR_Alphabet_Ptr io_alphabet_ptr )
+AUCR_Error AUCR_INDEX_Recognize_Candidates_From_Interpolated(
+															 const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+															 const AUCR_Index * i_index_ptr,
+															 int i_max_candidates,
+															 AUCR_Candidate * o_candidates,
+															 int * o_num_candidates_ptr,
+															 AUCR_Workspace_Ptr io_workspace_ptr )
 {
 	//local variables
-	AUCR_Character_Ptr tempchar = NULL;
+	const AUCR_Compiled_Alphabet * compiled;
+	AUCR_Workspace_Ptr tempworkspace = NULL;
 	AUCR_Error temperror;
 	
 	//check for valid input
-	if( i_interpolated_character_ptr == NULL || io_alphabet_ptr == NULL )
+	if( i_interpolated_character_ptr == NULL || i_index_ptr == NULL ||
+	   i_max_candidates < 1 || o_candidates == NULL || o_num_candidates_ptr == NULL )
 	{
 		return( AUCR_ERR_FAILED );
 	}
-	else if( i_interpolated_character_ptr->num_directional_codes !=
-			io_alphabet_ptr->num_directional_codes )
+	compiled = i_index_ptr->compiled_alphabet_ptr;
+	if( i_interpolated_character_ptr->num_directional_codes != compiled->num_directional_codes )
 	{
 		return( AUCR_ERR_CONFLICTING_PARAMETERS );
 	}
 	
-	//create character
-	temperror = AUCR_CHARACTER_Init(
-									i_interpolated_character_ptr->unicode, io_alphabet_ptr->num_directional_codes,
-									io_alphabet_ptr->num_activity_regions, &tempchar );
-	if( temperror != AUCR_ERR_SUCCESS )
+	//use the workspace given, or create one for this call
+	if( io_workspace_ptr != NULL )
 	{
-		//if creation returns an error, throw it up
-		return( temperror );
+		if( !AUCR_Workspace_Fits( io_workspace_ptr, compiled->num_directional_codes,
+								 compiled->num_activity_regions,
+								 compiled->directional_code_map.mappable_directional_codes ) )
+		{
+			return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		}
+		tempworkspace = io_workspace_ptr;
 	}
-	
-	//convert interpolated character into character
-	temperror = AUCR_CHARACTER_From_Interpolated(
-												 i_interpolated_character_ptr, io_alphabet_ptr, tempchar );
-	if( temperror != AUCR_ERR_SUCCESS )
+	else
 	{
-		//if conversion returns an error, throw it up
-		AUCR_CHARACTER_Release( &tempchar );
-		return( temperror );
+		temperror = AUCR_WORKSPACE_Init_From_Compiled( compiled, &tempworkspace );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
 	}
 	
-	//increment number of characters in the alphabet
-	( io_alphabet_ptr->num_characters )++;
-	
-	//make room in character array for just one more
-	io_alphabet_ptr->characters_ptr_ptr = 
-	(AUCR_Character_Ptr *)realloc( ( io_alphabet_ptr->characters_ptr_ptr ),
-								  ( ( io_alphabet_ptr->num_characters ) * sizeof( AUCR_Character_Ptr ) ) );
+	//find the features of the interpolated character
+	AUCR_Compiled_Query( compiled, i_interpolated_character_ptr->coordinates,
+						tempworkspace->hits, tempworkspace->character.directional_codes,
+						tempworkspace->character.activity_measures, tempworkspace->row,
+						tempworkspace->block_sums );
 	
-	if( io_alphabet_ptr->characters_ptr_ptr == NULL )
+	//search the tree from its root and order the candidates closest first
+	( *o_num_candidates_ptr ) = 0;
+	if( i_index_ptr->num_nodes > 0 )
 	{
-		//if realloc fails, return out of memory
-		AUCR_CHARACTER_Release( &tempchar );
-		( io_alphabet_ptr->num_characters )--;
-		return( AUCR_ERR_NO_MEMORY );
+		AUCR_Index_Search( i_index_ptr, 0, tempworkspace->row,
+						  tempworkspace->character.activity_measures,
+						  i_max_candidates, o_candidates, o_num_candidates_ptr );
 	}
+	AUCR_Candidates_Sort( o_candidates, ( *o_num_candidates_ptr ) );
 	
-	//add new character
-	io_alphabet_ptr->characters_ptr_ptr[io_alphabet_ptr->num_characters - 1] = tempchar;
+	//free workspace memory unless it was given
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_WORKSPACE_Release( &tempworkspace );
+	}
 	
-	//everything worked, return success
 	return( AUCR_ERR_SUCCESS );
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Add_Raw()
+ *		AUCR_INDEX_Recognize_Candidates_From_Raw()
  *	Description:
- *		Converts the supplied raw coordinates to an interpolated character
- *		and adds the interpolated character to the specified alphabet
+ *		finds the characters in the indexed compiled alphabet that are closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then returns up to i_max_candidates of them, closest first
  *	Parameters:
- *		i_unicode -> the unicode value the character represents
- *		i_num_coordinates -> the number of raw coordinates given
- *		i_coordinates -> array of i_num_coordinates coordinates
- *		io_alphabet_ptr -> address of the alphabet to add the character to
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_index_ptr -> pointer to index to search with
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
- *		i_num_coordinates is a positive integer
- *		i_coordinates is non NULL and is the address of a valid array of
- *							coordinates of length i_num_coordinates
- *		io_alphabet_ptr is the address of a valid AUCR_Alphabet
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_index_ptr is a valid pointer to a valid index,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates
  *	Postconditions:
- *		raw coordinates have been converted to an interpolated character, which is then
- *		converted to character, stored in character array of the alphabet, num_characters
- *		has been incremented by 1, characters_ptr_ptr is reallocated to have room for new character
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number is stored at o_num_candidates_ptr
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
  *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  */
-AUCR_Error AUCR_ALPHABET_Add_Raw(
-								 wchar_t i_unicode,
-								 int i_num_coordinates,
-								 AUCR_Coordinate * i_coordinates,
-								 AUCR_Alphabet_Ptr io_alphabet_ptr )
+AUCR_Error AUCR_INDEX_Recognize_Candidates_From_Raw(
+													int i_num_coordinates,
+													const AUCR_Coordinate * i_coordinates,
+													const AUCR_Index * i_index_ptr,
+													int i_max_candidates,
+													AUCR_Candidate * o_candidates,
+													int * o_num_candidates_ptr,
+													AUCR_Workspace_Ptr io_workspace_ptr )
 {
 	//local variables
 	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
 	AUCR_Error temperror;
 	
 	//check for valid input
-	if( i_num_coordinates < 1 || i_coordinates == NULL || io_alphabet_ptr == NULL )
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_index_ptr == NULL )
 	{
 		return( AUCR_ERR_FAILED );
 	}
 	
-	//create interpolated character
-	temperror = AUCR_INTERPOLATED_CHARACTER_Init( i_unicode,
-												 io_alphabet_ptr->num_directional_codes, &tempinterpchar );
-	if( temperror != AUCR_ERR_SUCCESS )
+	//take interpolated character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
 	{
-		//if creation returns an error, throw it up
-		return( temperror );
+		tempinterpchar = &( io_workspace_ptr->interpolated_character );
+	}
+	else
+	{
+		temperror = AUCR_INTERPOLATED_CHARACTER_Init( 0x0001,
+													 i_index_ptr->compiled_alphabet_ptr->num_directional_codes,
+													 &tempinterpchar );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
 	}
 	
 	//convert raw coordinates to interpolated character
 	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
-													 i_num_coordinates, i_coordinates, tempinterpchar );
+													 i_num_coordinates, i_coordinates, tempinterpchar,
+													 io_workspace_ptr );
 	if( temperror != AUCR_ERR_SUCCESS )
 	{
 		//if conversion returns an error, throw it up
-		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		}
 		return( temperror );
 	}
 	
-	//add interpolated character to the alphabet
-	temperror = AUCR_ALPHABET_Add_Interpolated_Character( tempinterpchar, io_alphabet_ptr );
+	//call interpolated_recognize
+	temperror = AUCR_INDEX_Recognize_Candidates_From_Interpolated(
+																  tempinterpchar, i_index_ptr, i_max_candidates,
+																  o_candidates, o_num_candidates_ptr, io_workspace_ptr ); 
 	
-	//free tempinterpchar memory
-	AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	//free interpolated character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	}
 	
-	//return the value returned by add_interpolated
+	//return value returned by interpolated_recognize
 	return( temperror );
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Remove_Character()
+ *		AUCR_PROGRESSIVE_Init()
  *	Description:
- *		Removes the specified character from the specified alphabet
+ *		Initializes a new AUCR_Progressive that recognizes strokes against the given
+ *		alphabet while they are drawn, with a workspace of its own.
  *	Parameters:
- *			i_character_number -> index of the character in the alphabets
- *											character array
- *			io_alphabet_ptr -> address of the alphabet to remove the character from
+ *		i_alphabet_ptr -> alphabet to recognize against
+ *		i_interval -> number of coordinates a stroke must grow by between
+ *							speculative recognitions
+ *		o_progressive_ptr_ptr <- address of the AUCR_Progressive_Ptr to be populated
+ *							with the new AUCR_Progressive
  *	Preconditions:
- *		i_character_number is a valid array index, greater than or equal to zero, and
- *		less than num_characters, io_alphabet_ptr is a valid pointer to a valid
- *		AUCR_Alphabet structure
+ *		i_alphabet_ptr is a valid alphabet that will outlive the progressive recognizer,
+ *		i_interval is positive.  The AUCR_Progressive_Ptr at o_progressive_ptr_ptr must
+ *		be NULL.
  *	Postconditions:
- *		the character at characters_ptr_ptr[i_character_number] is removed from this
- *		array, and the memory reserved for the character structure is freed, the memory
- *		reserved for the the characters_ptr_ptr array is reallocated and num_characters
- *		is decremented by one
+ *		o_progressive_ptr_ptr points to a newly allocated progressive recognizer with no
+ *		shortlist and zeroed latency.
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
  *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  */
-AUCR_Error AUCR_ALPHABET_Remove_Character(
-										  int i_character_number, /* which character in the character array to remove */
-										  AUCR_Alphabet_Ptr io_alphabet_ptr )
+AUCR_Error AUCR_PROGRESSIVE_Init(
+								 const AUCR_Alphabet * i_alphabet_ptr,
+								 int i_interval,
+								 AUCR_Progressive_Ptr * o_progressive_ptr_ptr )
 {
+	//local variables
+	AUCR_Error temperror;
+	
 	//check for valid input
-	if( io_alphabet_ptr == NULL || i_character_number < 0 ||
-	   i_character_number >= io_alphabet_ptr->num_characters )
+	if( i_alphabet_ptr == NULL || i_interval < 1 ||
+	   o_progressive_ptr_ptr == NULL || ( *o_progressive_ptr_ptr ) != NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//malloc memory for progressive recognizer struct
+	( *o_progressive_ptr_ptr ) = (AUCR_Progressive_Ptr)malloc( sizeof( AUCR_Progressive ) );
+	if( ( *o_progressive_ptr_ptr ) == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	
+	//create its workspace
+	( *o_progressive_ptr_ptr )->workspace_ptr = NULL;
+	temperror = AUCR_WORKSPACE_Init( i_alphabet_ptr, &( ( *o_progressive_ptr_ptr )->workspace_ptr ) );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		free( *o_progressive_ptr_ptr );
+		( *o_progressive_ptr_ptr ) = NULL;
+		return( temperror );
+	}
+	
+	//now fill in fields
+	( *o_progressive_ptr_ptr )->alphabet_ptr = i_alphabet_ptr;
+	( *o_progressive_ptr_ptr )->interval = i_interval;
+	memset( &( ( *o_progressive_ptr_ptr )->latency ), 0, sizeof( AUCR_Latency ) );
+	AUCR_PROGRESSIVE_Begin( *o_progressive_ptr_ptr );
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_PROGRESSIVE_Release()
+ *	Description:
+ *		Frees all memories of the AUCR_Progressive and the structure itself, and
+ *		NULLs the AUCR_Progressive_Ptr.
+ *	Parameters:
+ *		io_progressive_ptr_ptr <-> address of the AUCR_Progressive to be freed.
+ *	Preconditions:
+ *		The AUCR_Progressive_Ptr at io_progressive_ptr_ptr is NULL or the address of
+ *		an AUCR_Progressive created by AUCR_PROGRESSIVE_Init().
+ *	Postconditions:
+ *		all memory of the progressive recognizer is freed and the AUCR_Progressive_Ptr
+ *		at io_progressive_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_PROGRESSIVE_Release(
+							  AUCR_Progressive_Ptr * io_progressive_ptr_ptr )
+{
+	if( io_progressive_ptr_ptr == NULL || ( *io_progressive_ptr_ptr ) == NULL )
 	{
-		return( AUCR_ERR_FAILED );
+		return;
 	}
 	
-	//free character
-	AUCR_CHARACTER_Release( &( io_alphabet_ptr->characters_ptr_ptr[i_character_number] ) );
+	AUCR_WORKSPACE_Release( &( ( *io_progressive_ptr_ptr )->workspace_ptr ) );
+	free( *io_progressive_ptr_ptr );
+	( *io_progressive_ptr_ptr ) = NULL;
 	
-	//if not getting ride of the last charcter, then move last character
-	//into the spot formerly held by character that has been deleted
-	if( i_character_number < ( io_alphabet_ptr->num_characters - 1 ) )
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_PROGRESSIVE_Begin()
+ *	Description:
+ *		starts a new stroke, forgetting the shortlist of the last one.
+ *	Parameters:
+ *		io_progressive_ptr <-> pointer to the progressive recognizer
+ *	Preconditions:
+ *		io_progressive_ptr is a valid progressive recognizer
+ *	Postconditions:
+ *		the shortlist is empty
+ *	Returns:
+ *		none
+ */
+void AUCR_PROGRESSIVE_Begin(
+							AUCR_Progressive_Ptr io_progressive_ptr )
+{
+	if( io_progressive_ptr == NULL )
 	{
-		io_alphabet_ptr->characters_ptr_ptr[i_character_number] = 
-		io_alphabet_ptr->characters_ptr_ptr[io_alphabet_ptr->num_characters - 1];
+		return;
 	}
 	
-	//decrement number of characters in the alphabet
-	( io_alphabet_ptr->num_characters )--;
-	
-	//resize character array if there are still characters in it
-	//avoid resizeing character if there are no characters, as this
-	//will free array memory and complicate adding a character later
-	//or releasing the alphabet later.
-	if( io_alphabet_ptr->num_characters > 0 )
-	{
-		( io_alphabet_ptr->characters_ptr_ptr ) = 
-		(AUCR_Character_Ptr *)realloc( ( io_alphabet_ptr->characters_ptr_ptr ),
-									  ( ( io_alphabet_ptr->num_characters ) * sizeof( AUCR_Character_Ptr ) ) );
-	}
+	io_progressive_ptr->speculated_coordinates = 0;
+	io_progressive_ptr->shortlisted_coordinates = 0;
+	io_progressive_ptr->num_shortlisted = 0;
+	io_progressive_ptr->shortlist_size = AUCR_PROGRESSIVE_SHORTLIST;
 	
-	return( AUCR_ERR_SUCCESS );
+	return;
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Recognize_From_Interpolated()
+ *		AUCR_PROGRESSIVE_Update()
  *	Description:
- *		finds the character in the alphabet that is closest to the
- *		interpolated character given as an argument and return the
- *		unicode of this found character
+ *		recognizes the stroke drawn so far once it has grown by the interval since it
+ *		was last recognized, to keep a shortlist of the characters closest to it.  the
+ *		first recognition of a stroke, and the first after the stroke has doubled in
+ *		coordinates, shortlists the AUCR_PROGRESSIVE_SHORTLIST closest characters of
+ *		the whole alphabet.  each other recognition ranks only the shortlist against
+ *		the longer stroke and keeps the closer half, down to AUCR_PROGRESSIVE_KEEP
+ *		characters.  a stroke that has not grown by the interval is left alone, so
+ *		this can be called after every coordinate is added.
  *	Parameters:
- *			i_interpolated_character_ptr -> interpolated character that we will look
- *														for a match for
- *			io_alphabet_ptr <-> address of the alphabet to find the character in
- *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *		i_stroke_ptr -> the stroke being drawn
+ *		io_progressive_ptr <-> pointer to the progressive recognizer
  *	Preconditions:
- *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
- *		io_alphabet_ptr is a valid pointer to a valid pointer to a valid alphabet,
- *		num_directional_codes between the alphabet and the character is in agreement
+ *		i_stroke_ptr is a valid stroke, io_progressive_ptr is a valid progressive
+ *		recognizer, and the alphabet has not changed since AUCR_PROGRESSIVE_Begin()
  *	Postconditions:
- *		the closest character in the alphabet has been found, and its unicode value
- *		is stored in the variable pointed to by o_unicode_ptr
+ *		the shortlist holds the characters closest to the stroke so far, and the
+ *		time taken has been added to the latency
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
- *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
- *													num_directional_codes are met
  */
-AUCR_Error AUCR_ALPHABET_Recognize_From_Interpolated(
-													 AUCR_Interpolated_Character_Ptr i_interpolated_character_ptr,
-													 AUCR_Alphabet_Ptr i_alphabet_ptr,
-													 wchar_t * o_unicode_ptr )
+AUCR_Error AUCR_PROGRESSIVE_Update(
+								   const AUCR_Stroke * i_stroke_ptr,
+								   AUCR_Progressive_Ptr io_progressive_ptr )
 {
 	//local variables
-	AUCR_Character_Ptr tempchar = NULL;
+	AUCR_Candidate tempshortlist[AUCR_PROGRESSIVE_SHORTLIST];
 	AUCR_Error temperror;
-	int i, j;
-	unsigned int minindex = 0, tempmin, tempmax;
-	unsigned long int difference, mindifference = 0;
+	unsigned long int start;
+	int i, num_kept;
 	
 	//check for valid input
-	if( i_interpolated_character_ptr == NULL || i_alphabet_ptr == NULL )
+	if( i_stroke_ptr == NULL || io_progressive_ptr == NULL )
 	{
 		return( AUCR_ERR_FAILED );
 	}
-	else if( i_interpolated_character_ptr->num_directional_codes !=
-			i_alphabet_ptr->num_directional_codes )
+	
+	//wait until the stroke has grown by the interval
+	if( i_stroke_ptr->num_coordinates <
+	   io_progressive_ptr->speculated_coordinates + io_progressive_ptr->interval )
 	{
-		return( AUCR_ERR_CONFLICTING_PARAMETERS );
+		return( AUCR_ERR_SUCCESS );
 	}
+	start = AUCR_Microseconds();
+	io_progressive_ptr->speculated_coordinates = i_stroke_ptr->num_coordinates;
 	
-	//create character
-	temperror = AUCR_CHARACTER_Init(
-									i_interpolated_character_ptr->unicode, i_alphabet_ptr->num_directional_codes,
-									i_alphabet_ptr->num_activity_regions, &tempchar );
+	//find the character of the stroke so far
+	temperror = AUCR_Progressive_Character( i_stroke_ptr, io_progressive_ptr );
 	if( temperror != AUCR_ERR_SUCCESS )
 	{
-		//if creation returns an error, throw it up
 		return( temperror );
 	}
 	
-	//convert interpolated character into character
-	temperror = AUCR_CHARACTER_From_Interpolated(
-												 i_interpolated_character_ptr, i_alphabet_ptr, tempchar );
-	if( temperror != AUCR_ERR_SUCCESS )
+	if( io_progressive_ptr->num_shortlisted == 0 ||
+	   i_stroke_ptr->num_coordinates >= 2 * io_progressive_ptr->shortlisted_coordinates )
 	{
-		//if conversion returns an error, throw it up
-		AUCR_CHARACTER_Release( &tempchar );
-		return( temperror );
+		//shortlist the closest characters of the whole alphabet again whenever
+		//the stroke has doubled, as its start says little about its end
+		io_progressive_ptr->shortlisted_coordinates = i_stroke_ptr->num_coordinates;
+		io_progressive_ptr->shortlist_size = AUCR_PROGRESSIVE_SHORTLIST;
+		io_progressive_ptr->num_shortlisted = 0;
+		AUCR_Alphabet_Scan( io_progressive_ptr->alphabet_ptr,
+						   &( io_progressive_ptr->workspace_ptr->character ),
+						   io_progressive_ptr->shortlist_size, io_progressive_ptr->shortlist,
+						   &( io_progressive_ptr->num_shortlisted ) );
 	}
-	
-	//check new character against each character in the alphabet
-	for( i = 0; i < i_alphabet_ptr->num_characters; i++ )
+	else
 	{
-		//zero out difference for newest character
-		difference = 0;
-		
-		//check all activity measure differences
-		for( j = 0; j < i_alphabet_ptr->num_activity_regions; j++ )
-		{
-			if( tempchar->activity_measures[j] <
-			   i_alphabet_ptr->characters_ptr_ptr[i]->activity_measures[j] )
-			{
-				difference += AUCR_Rounding_Divide( 
-												   ( i_alphabet_ptr->characters_ptr_ptr[i]->activity_measures[j]
-													- tempchar->activity_measures[j] )
-												   * ( i_alphabet_ptr->characters_ptr_ptr[i]->activity_measures[j]
-													  - tempchar->activity_measures[j] ) * i_alphabet_ptr->bias[j],
-												   AUCR_SCALE * AUCR_SCALE );
-			}
-			else
-			{
-				difference += AUCR_Rounding_Divide( 
-												   i_alphabet_ptr->bias[j] * ( tempchar->activity_measures[j] - 
-																			  i_alphabet_ptr->characters_ptr_ptr[i]->activity_measures[j] )
-												   * ( tempchar->activity_measures[j] -
-													  i_alphabet_ptr->characters_ptr_ptr[i]->activity_measures[j] ),
-												   AUCR_SCALE * AUCR_SCALE );
-			}
-		}
-		
-		//skip remainder of this checking this character if
-		//we are already sure that this character is not the
-		//closest
-		if( ( difference > mindifference ) && ( i != 0 ) )
+		//rank the shortlist against the longer stroke and keep the closer half
+		if( io_progressive_ptr->shortlist_size / 2 > AUCR_PROGRESSIVE_KEEP )
 		{
-			continue;
+			io_progressive_ptr->shortlist_size /= 2;
 		}
-		
-		//check all directional code differences
-		for( j = 0; j < i_alphabet_ptr->num_directional_codes; j++ )
+		else if( io_progressive_ptr->shortlist_size > AUCR_PROGRESSIVE_KEEP )
 		{
-			if( tempchar->directional_codes[j] <
-			   i_alphabet_ptr->characters_ptr_ptr[i]->directional_codes[j] )
-			{
-				tempmax = i_alphabet_ptr->characters_ptr_ptr[i]->directional_codes[j];
-				tempmin = tempchar->directional_codes[j];
-			}
-			else
-			{
-				tempmin = i_alphabet_ptr->characters_ptr_ptr[i]->directional_codes[j];
-				tempmax = tempchar->directional_codes[j];
-			}
-			if( ( tempmax - tempmin ) <
-			   ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
-				+ tempmin - tempmax ) )
-			{
-				difference += ( ( tempmax - tempmin ) 
-							   * ( tempmax - tempmin ) * AUCR_SCALE );
-			}
-			else
-			{
-				difference +=
-				( ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
-				   + tempmin - tempmax )
-				 * ( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes
-					+ tempmin - tempmax ) * AUCR_SCALE );
-			}
+			io_progressive_ptr->shortlist_size = AUCR_PROGRESSIVE_KEEP;
 		}
-		
-		//check to see if this character is closer than previous
-		//closest character
-		if( ( difference < mindifference ) || ( i == 0 ) )
+		num_kept = 0;
+		for( i = 0; i < io_progressive_ptr->num_shortlisted; i++ )
 		{
-			mindifference = difference;
-			minindex = i;
+			AUCR_Candidates_Offer( tempshortlist, &num_kept, io_progressive_ptr->shortlist_size,
+								  io_progressive_ptr->shortlist[i].unicode,
+								  io_progressive_ptr->shortlist[i].index,
+								  AUCR_Alphabet_Difference( io_progressive_ptr->alphabet_ptr,
+														   &( io_progressive_ptr->workspace_ptr->character ),
+														   io_progressive_ptr->shortlist[i].index ) );
 		}
-		
+		memcpy( io_progressive_ptr->shortlist, tempshortlist, num_kept * sizeof( AUCR_Candidate ) );
+		io_progressive_ptr->num_shortlisted = num_kept;
 	}
-	//index of closest character now stored in minindex
-	
-	//retrieve unicode value of closest character and place in o_unicode_ptr
-	( *o_unicode_ptr ) = i_alphabet_ptr->characters_ptr_ptr[minindex]->unicode;
 	
-	//free character memory
-	AUCR_CHARACTER_Release( &tempchar );
+	io_progressive_ptr->latency.speculations++;
+	io_progressive_ptr->latency.speculation_microseconds += AUCR_Microseconds() - start;
 	
-	//return success
 	return( AUCR_ERR_SUCCESS );
-	
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Recognize_From_Raw()
+ *		AUCR_PROGRESSIVE_Finalize()
  *	Description:
- *		finds the character in the alphabet that is closest to the
- *		interpolated character that is created from the raw data that is given,
- *		then return the unicode of this found character
+ *		finds the character in the alphabet that is closest to the finished stroke
+ *		and returns its unicode.  the shortlist is ranked against the finished
+ *		stroke, and the closest of it bounds a scan of the alphabet that gives up on
+ *		nearly every other character at its first check, so the character found is
+ *		the one AUCR_ALPHABET_Recognize_From_Stroke() finds.  the time from the call
+ *		to the result is added to the latency.
  *	Parameters:
- *			i_num_coordinates -> number of raw coordinates supplied
- *			i_coordinates -> array of raw coordinates of length i_num_coordinate
- *			io_alphabet_ptr <-> pointer to alphabet to search against
- *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *		i_stroke_ptr -> the finished stroke
+ *		io_progressive_ptr <-> pointer to the progressive recognizer
+ *		o_unicode_ptr <- address of wchar_t variable to store unicode in
  *	Preconditions:
- *		i_num coordinates is positive integer
- *		i_coordinates is non NULL and points to a valid array of
- *							of i_num_coordinates coordinates
- *		io_alphabet_ptr is a valid pointer to a valid pointer to a valid alphabet,
+ *		i_stroke_ptr is a valid stroke of at least one coordinate, io_progressive_ptr
+ *		is a valid progressive recognizer whose alphabet has at least one character
+ *		and has not changed since AUCR_PROGRESSIVE_Begin()
  *	Postconditions:
  *		the closest character in the alphabet has been found, and its unicode value
  *		is stored in the variable pointed to by o_unicode_ptr
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  */
-AUCR_Error AUCR_ALPHABET_Recognize_From_Raw(
-											int i_num_coordinates,
-											AUCR_Coordinate * i_coordinates,
-											AUCR_Alphabet_Ptr i_alphabet_ptr,
-											wchar_t * o_unicode_ptr )
+AUCR_Error AUCR_PROGRESSIVE_Finalize(
+									 const AUCR_Stroke * i_stroke_ptr,
+									 AUCR_Progressive_Ptr io_progressive_ptr,
+									 wchar_t * o_unicode_ptr )
 {
 	//local variables
-	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
+	AUCR_Candidate tempcandidate;
 	AUCR_Error temperror;
+	unsigned long int start, microseconds, difference;
+	int i, num_candidates, seedindex;
 	
 	//check for valid input
-	if( i_num_coordinates < 1 || i_coordinates == NULL || i_alphabet_ptr == NULL )
+	if( i_stroke_ptr == NULL || i_stroke_ptr->num_coordinates < 1 ||
+	   io_progressive_ptr == NULL || o_unicode_ptr == NULL ||
+	   io_progressive_ptr->alphabet_ptr->num_characters < 1 )
 	{
 		return( AUCR_ERR_FAILED );
 	}
+	start = AUCR_Microseconds();
 	
-	//create interpolated character
-	temperror = AUCR_INTERPOLATED_CHARACTER_Init( 0x0001,
-												 i_alphabet_ptr->num_directional_codes, &tempinterpchar );
+	//find the character of the finished stroke
+	temperror = AUCR_Progressive_Character( i_stroke_ptr, io_progressive_ptr );
 	if( temperror != AUCR_ERR_SUCCESS )
 	{
-		//if creation returns an error, throw it up
 		return( temperror );
 	}
 	
-	//convert raw coordinates to interpolated character
-	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
-													 i_num_coordinates, i_coordinates, tempinterpchar );
-	if( temperror != AUCR_ERR_SUCCESS )
+	//start from the closest of the first character and the shortlist, as the
+	//scan always checks the first character
+	num_candidates = 0;
+	difference = AUCR_Alphabet_Difference( io_progressive_ptr->alphabet_ptr,
+										  &( io_progressive_ptr->workspace_ptr->character ), 0 );
+	AUCR_Candidates_Offer( &tempcandidate, &num_candidates, 1,
+						  io_progressive_ptr->alphabet_ptr->characters_ptr_ptr[0]->unicode, 0,
+						  difference );
+	for( i = 0; i < io_progressive_ptr->num_shortlisted; i++ )
 	{
-		//if conversion returns an error, throw it up
-		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
-		return( temperror );
+		if( io_progressive_ptr->shortlist[i].index < io_progressive_ptr->alphabet_ptr->num_characters )
+		{
+			difference = AUCR_Alphabet_Difference( io_progressive_ptr->alphabet_ptr,
+												  &( io_progressive_ptr->workspace_ptr->character ),
+												  io_progressive_ptr->shortlist[i].index );
+			AUCR_Candidates_Offer( &tempcandidate, &num_candidates, 1,
+								  io_progressive_ptr->shortlist[i].unicode,
+								  io_progressive_ptr->shortlist[i].index, difference );
+		}
+	}
+	seedindex = tempcandidate.index;
+	
+	//check it against the rest of the alphabet, which it bounds from the start
+	AUCR_Alphabet_Scan( io_progressive_ptr->alphabet_ptr,
+					   &( io_progressive_ptr->workspace_ptr->character ),
+					   1, &tempcandidate, &num_candidates );
+	( *o_unicode_ptr ) = tempcandidate.unicode;
+	
+	//count the time from pen up to result
+	microseconds = AUCR_Microseconds() - start;
+	io_progressive_ptr->latency.strokes++;
+	if( tempcandidate.index == seedindex )
+	{
+		io_progressive_ptr->latency.shortlist_hits++;
+	}
+	io_progressive_ptr->latency.finalize_microseconds += microseconds;
+	if( microseconds > io_progressive_ptr->latency.finalize_max_microseconds )
+	{
+		io_progressive_ptr->latency.finalize_max_microseconds = microseconds;
 	}
 	
-	//call interpolated_recognize
-	temperror = AUCR_ALPHABET_Recognize_From_Interpolated(
-														  tempinterpchar, i_alphabet_ptr, o_unicode_ptr ); 
-	
-	//free interpolated character memory
-	AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
-	
-	//return value returned by interpolated_recognize
-	return( temperror );
+	return( AUCR_ERR_SUCCESS );
 }
 
-
 /*
  *	Name:
- *		AUCR_ALPHABET_Save_To_File()
+ *		AUCR_Character_Share()
  *	Description:
- *		takes the alphabet given as a parameter, and saves all the data contained
- *		in the alphabet as an ascii file that is given by the file pointer given as
- *		an argument.  
+ *		gives the character of a snapshot for a character of an alphabet, which is
+ *		the copy its slot was last published with, with one more reference, or
+ *		else a new copy that the slot keeps a reference to as well.  every change
+ *		to a character puts it in a slot with no copy, so a slot with one has not
+ *		changed since it was last published.
  *	Parameters:
- *		i_alphabet_ptr -> pointer to alphabet that will be saved
- *		io_file_path -> pointer to a string that gives the full path of the file
+ *		io_character_ptr <-> character of the alphabet being published
  *	Preconditions:
- *		i_alphabet_ptr is a non-NULL, valid pointer to a valid alphabet structure,
- *		and i_file_ptr is a valid pointer to a valid string that gives the full pathname
- *		for a file that can be written without causing an error.
+ *		io_character_ptr is a character of an alphabet, in its slot
  *	Postconditions:
- *		the alphabet has been written to the file, and the alphabet itself is
- *		unchanged.
+ *		the character given has a reference for the new snapshot, and the slot
+ *		holds it as its published copy
  *	Returns:
- *		AUCR_ERR_SUCCESS
- *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		the shared character, or NULL if a copy could not be allocated
  */
-AUCR_Error AUCR_ALPHABET_Save_To_File( 
-									  const char * io_file_path,
-									  AUCR_Alphabet_Ptr i_alphabet_ptr )
+static AUCR_Character_Ptr AUCR_Character_Share(
+											   AUCR_Character_Ptr io_character_ptr )
 {
 	//local variables
-	FILE * tempfp;
-	int i;
+	AUCR_Slot * tempslot;
+	AUCR_Shared_Character * tempshared;
+	unsigned long headersize;
 	
-	//check for valid input
-	if( io_file_path == NULL || i_alphabet_ptr == NULL )
+	//share the copy the slot was last published with, if it has one
+	tempslot = (AUCR_Slot *)io_character_ptr;
+	if( tempslot->published != NULL )
 	{
-		return( AUCR_ERR_FAILED );
+		AUCR_ATOMIC_ADD( ( (AUCR_Shared_Character *)tempslot->published )->references, 1 );
+		return( tempslot->published );
 	}
 	
-	//open file
-	tempfp = fopen( io_file_path, "wb" );
-	if( tempfp == NULL )
+	//otherwise copy it, with its directional codes and activity measures after it
+	headersize = AUCR_Round_Up( sizeof( AUCR_Shared_Character ), sizeof( int ) );
+	tempshared = (AUCR_Shared_Character *)malloc( headersize +
+												 ( io_character_ptr->num_directional_codes +
+												  io_character_ptr->num_activity_regions ) * sizeof( int ) );
+	if( tempshared == NULL )
 	{
-		return( AUCR_ERR_FAILED );
+		return( NULL );
 	}
-	
-	//write number of characters 
-	fwrite( &( i_alphabet_ptr->num_characters ), sizeof( int ), 1, tempfp );
-	
-	//write number of activity regions
-	fwrite( &( i_alphabet_ptr->num_activity_regions ),
-		   sizeof( int ), 1, tempfp );
-	
-	//write number of directional codes
-	fwrite( &( i_alphabet_ptr->num_directional_codes ),
-		   sizeof( int ), 1, tempfp );
-	
-	//write mappable directional codes
-	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes ),
-		   
-		   sizeof( int ), 1, tempfp );
-	
-	//write directional code map structure arrays
-	fwrite( i_alphabet_ptr->directional_code_map_ptr->x, sizeof( int ), 
-		   i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes, tempfp );
-	fwrite( i_alphabet_ptr->directional_code_map_ptr->y, sizeof( int ), 
-		   i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes, tempfp );
-	
-	//write setup info for directional code map 
-	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->positive_begin ), 
-		   sizeof( int ), 1, tempfp );
-	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->negative_begin ), 
-		   sizeof( int ), 1, tempfp );
-	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->positive_end ), 
-		   sizeof( int ), 1, tempfp );
-	fwrite( &( i_alphabet_ptr->directional_code_map_ptr->negative_end ), 
-		   sizeof( int ), 1, tempfp ); 
-	
-	//write all character structures
-	for( i = 0; i < i_alphabet_ptr->num_characters; i++ )
+	tempshared->character.unicode = io_character_ptr->unicode;
+	tempshared->character.num_directional_codes = io_character_ptr->num_directional_codes;
+	tempshared->character.num_activity_regions = io_character_ptr->num_activity_regions;
+	tempshared->character.directional_codes = (int *)( (unsigned char *)tempshared + headersize );
+	tempshared->character.activity_measures =
+	tempshared->character.directional_codes + io_character_ptr->num_directional_codes;
+	memcpy( tempshared->character.directional_codes, io_character_ptr->directional_codes,
+		   io_character_ptr->num_directional_codes * sizeof( int ) );
+	memcpy( tempshared->character.activity_measures, io_character_ptr->activity_measures,
+		   io_character_ptr->num_activity_regions * sizeof( int ) );
+	
+	//one reference for the slot and one for the snapshot
+	tempshared->references = 2;
+	tempslot->published = &( tempshared->character );
+	
+	return( &( tempshared->character ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Character_Unshare()
+ *	Description:
+ *		gives up a snapshot's or a slot's reference to a shared character, freeing
+ *		the character if nothing else has it
+ *	Parameters:
+ *		io_character_ptr <-> character given by AUCR_Character_Share()
+ *	Preconditions:
+ *		io_character_ptr is a character of a snapshot being freed, or the
+ *		published copy of a slot that is giving it up
+ *	Postconditions:
+ *		the reference is given up
+ *	Returns:
+ *		none
+ */
+static void AUCR_Character_Unshare(
+								   AUCR_Character_Ptr io_character_ptr )
+{
+	if( AUCR_ATOMIC_ADD( ( (AUCR_Shared_Character *)io_character_ptr )->references, -1 ) == 0 )
 	{
-		fwrite( &( i_alphabet_ptr->characters_ptr_ptr[i]->unicode ), 
-			   
-			   sizeof( wchar_t ), 1, tempfp );
-		fwrite( &( i_alphabet_ptr->characters_ptr_ptr[i]->num_directional_codes ), 
-			   sizeof( int ), 1, tempfp );
-		fwrite( &( i_alphabet_ptr->characters_ptr_ptr[i]->num_activity_regions ), 
-			   sizeof( int ), 1, tempfp );
-		
-		//write directional code array
-		fwrite( i_alphabet_ptr->characters_ptr_ptr[i]->directional_codes, sizeof( int ),
-			   i_alphabet_ptr->characters_ptr_ptr[i]->num_directional_codes, tempfp );
-		
-		//write activity measures array
-		fwrite( i_alphabet_ptr->characters_ptr_ptr[i]->activity_measures, sizeof( int ),
-			   i_alphabet_ptr->characters_ptr_ptr[i]->num_activity_regions, tempfp );
+		free( io_character_ptr );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_PUBLISHER_Init()
+ *	Description:
+ *		Initializes a new AUCR_Publisher with nothing published.
+ *	Parameters:
+ *		o_publisher_ptr_ptr <- address of the AUCR_Publisher_Ptr to be populated
+ *							with the new AUCR_Publisher
+ *	Preconditions:
+ *		The AUCR_Publisher_Ptr at o_publisher_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_publisher_ptr_ptr points to a newly allocated publisher whose current
+ *		snapshot is NULL and whose version is zero.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure memory could not be allocated
+ */
+AUCR_Error AUCR_PUBLISHER_Init(
+							   AUCR_Publisher_Ptr * o_publisher_ptr_ptr )
+{
+	//check for valid input
+	if( o_publisher_ptr_ptr == NULL || ( *o_publisher_ptr_ptr ) != NULL )
+	{
+		return( AUCR_ERR_FAILED );
 	}
 	
-	//write all activity region structures
-	fwrite( i_alphabet_ptr->activity_regions, sizeof( AUCR_Activity_Region ),
-		   i_alphabet_ptr->num_activity_regions, tempfp );
+	//malloc memory for publisher struct
+	( *o_publisher_ptr_ptr ) = (AUCR_Publisher_Ptr)malloc( sizeof( AUCR_Publisher ) );
+	if( ( *o_publisher_ptr_ptr ) == NULL )
+	{
+		return( AUCR_ERR_NO_MEMORY );
+	}
 	
-	//write all biases
-	fwrite( i_alphabet_ptr->bias, sizeof( int ),
-		   i_alphabet_ptr->num_activity_regions, tempfp ); 
+	//now fill in fields
+	( *o_publisher_ptr_ptr )->current_ptr = NULL;
+	( *o_publisher_ptr_ptr )->pinning[0] = 0;
+	( *o_publisher_ptr_ptr )->pinning[1] = 0;
+	( *o_publisher_ptr_ptr )->version = 0;
 	
-	if( fclose( tempfp ) != 0 )
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_PUBLISHER_Release()
+ *	Description:
+ *		Unpins the current snapshot of the AUCR_Publisher, frees the structure and
+ *		NULLs the AUCR_Publisher_Ptr.  snapshots still pinned by readers stay valid
+ *		until they are unpinned.
+ *	Parameters:
+ *		io_publisher_ptr_ptr <-> address of the AUCR_Publisher to be freed.
+ *	Preconditions:
+ *		The AUCR_Publisher_Ptr at io_publisher_ptr_ptr is NULL or the address of an
+ *		AUCR_Publisher created by AUCR_PUBLISHER_Init(), which nothing is pinning
+ *		from or publishing to.
+ *	Postconditions:
+ *		the publisher is freed and the AUCR_Publisher_Ptr at io_publisher_ptr_ptr
+ *		is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_PUBLISHER_Release(
+							AUCR_Publisher_Ptr * io_publisher_ptr_ptr )
+{
+	//local variables
+	AUCR_Snapshot_Ptr tempsnapshot;
+	
+	if( io_publisher_ptr_ptr == NULL || ( *io_publisher_ptr_ptr ) == NULL )
 	{
-		return( AUCR_ERR_FAILED );
+		return;
 	}
 	
-	return( AUCR_ERR_SUCCESS );
+	tempsnapshot = ( *io_publisher_ptr_ptr )->current_ptr;
+	AUCR_SNAPSHOT_Unpin( &tempsnapshot );
+	free( *io_publisher_ptr_ptr );
+	( *io_publisher_ptr_ptr ) = NULL;
+	
+	return;
 }
 
 
 /*
  *	Name:
- *		AUCR_ALPHABET_Open_From_File()
+ *		AUCR_PUBLISHER_Publish()
  *	Description:
- *		takes the alphabet given as a pointer to a pointer parameter, and fills it with the
- *		information contained in the file that is given as a parameter.
+ *		makes a read-only snapshot of an alphabet and makes it the publisher's
+ *		current snapshot, the one readers pin from then on.  each slot of the
+ *		alphabet keeps the copy of its character it was last published with, and
+ *		adding, changing or removing a character leaves its slot without one, so
+ *		each character that has not changed since it was last published is shared
+ *		rather than copied, wherever its index has moved to.  the snapshot before is
+ *		unpinned once every reader that pinned before the publish has taken its
+ *		reference, and is freed when its last reader unpins it.  readers that pin
+ *		meanwhile are not waited for, as they get the new snapshot; the wait spins
+ *		briefly and then yields the processor.
  *	Parameters:
- *		io_alphabet_ptr_ptr -> pointer to pointer to alphabet that will be filled in
- *		i_file_path -> pointer to a string that gives the full path of
- *							the file
+ *		io_alphabet_ptr <-> alphabet to publish a snapshot of, whose slots keep the
+ *							copies published
+ *		io_publisher_ptr <-> publisher to make it current in
  *	Preconditions:
- *		io_alphabet_ptr_ptr is a a valid pointer to a NULL alphabet pointer
- *		and i_file_path is a valid pointer to a valid string that is the
- *		path name of a valid file that was previously created by a call to the 
- *		AUCR_ALPHABET_Save_To_File() function.
+ *		io_alphabet_ptr is a valid alphabet, whose characters have been changed only
+ *		through the AUCR_ALPHABET functions, that nothing changes or publishes
+ *		during the call, and io_publisher_ptr is a valid publisher that nothing
+ *		else publishes to during the call
  *	Postconditions:
- *		the alphabet has been filled in with the information from the file, and the
- *		file itself remains unchanged.
+ *		the current snapshot of the publisher is a copy of the alphabet, with the
+ *		next version, or the publisher is unchanged if memory could not be allocated.
+ *		each slot of the alphabet holds a reference to its published copy until the
+ *		character is removed or the alphabet released.
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_NO_MEMORY if the snapshot or its characters could not be allocated
  */
-AUCR_Error AUCR_ALPHABET_Open_From_File(
-										const char * i_file_path,
-										AUCR_Alphabet_Ptr * io_alphabet_ptr_ptr )
+AUCR_Error AUCR_PUBLISHER_Publish(
+								  AUCR_Alphabet_Ptr io_alphabet_ptr,
+								  AUCR_Publisher_Ptr io_publisher_ptr )
 {
 	//local variables
-	FILE * tempfp;
-	int temp_num_characters, temp_num_activity_regions;
-	int temp_num_directional_codes, temp_mappable_directional_codes;
-	int i;
-	wchar_t temp_unicode;
-	AUCR_Error temperr;
-	AUCR_Directional_Code_Map_Ptr tempdircode = NULL;
+	AUCR_Snapshot_Ptr tempsnapshot, oldsnapshot;
+	AUCR_Alphabet_Ptr tempalphabet = NULL;
+	AUCR_Error temperror;
+	unsigned long int epoch;
+	int i, spins;
 	
 	//check for valid input
-	if( i_file_path == NULL || io_alphabet_ptr_ptr == NULL
-	   || ( *io_alphabet_ptr_ptr ) != NULL )
+	if( io_alphabet_ptr == NULL || io_publisher_ptr == NULL ||
+	   io_alphabet_ptr->directional_code_map_ptr == NULL ||
+	   io_alphabet_ptr->num_characters < 0 ||
+	   ( io_alphabet_ptr->num_characters > 0 && io_alphabet_ptr->characters_ptr_ptr == NULL ) )
 	{
 		return( AUCR_ERR_FAILED );
 	}
 	
-	//open file
-	tempfp = fopen( i_file_path, "rb" );
-	if( tempfp == NULL )
+	//copy the directional code map, activity regions and biases into an alphabet
+	//of the snapshot's own
+	temperror = AUCR_ALPHABET_Init( io_alphabet_ptr->directional_code_map_ptr,
+								   io_alphabet_ptr->num_activity_regions,
+								   io_alphabet_ptr->num_directional_codes, &tempalphabet );
+	if( temperror != AUCR_ERR_SUCCESS )
 	{
-		return( AUCR_ERR_FAILED );
+		//if creation returns an error, throw it up
+		return( temperror );
 	}
-	
-	//read number of characters 
-	fread( &temp_num_characters, sizeof( int ), 1, tempfp );
-	
-	//read number of activity regions
-	fread( &temp_num_activity_regions,
-		  sizeof( int ), 1, tempfp );
-	
-	//read number of directional codes
-	fread( &temp_num_directional_codes,
-		  sizeof( int ), 1, tempfp );
-	
-	//read mappable directional codes
-	fread( &temp_mappable_directional_codes,
-		  sizeof( int ), 1, tempfp );
-	
-	//create directional code map structure
-	temperr = AUCR_DIRECTIONAL_CODE_MAP_Init(
-											 temp_mappable_directional_codes, &tempdircode );
-	if( temperr != AUCR_ERR_SUCCESS )
+	memcpy( tempalphabet->activity_regions, io_alphabet_ptr->activity_regions,
+		   io_alphabet_ptr->num_activity_regions * sizeof( AUCR_Activity_Region ) );
+	memcpy( tempalphabet->bias, io_alphabet_ptr->bias,
+		   io_alphabet_ptr->num_activity_regions * sizeof( int ) );
+	
+	//malloc memory for the snapshot and its character array
+	tempsnapshot = (AUCR_Snapshot_Ptr)malloc( sizeof( AUCR_Snapshot ) );
+	if( tempsnapshot == NULL )
 	{
-		fclose( tempfp );
-		return( temperr );
+		AUCR_ALPHABET_Release( &tempalphabet );
+		return( AUCR_ERR_NO_MEMORY );
+	}
+	if( io_alphabet_ptr->num_characters > 0 )
+	{
+		tempalphabet->characters_ptr_ptr = (AUCR_Character_Ptr *)malloc(
+			io_alphabet_ptr->num_characters * sizeof( AUCR_Character_Ptr ) );
+		if( tempalphabet->characters_ptr_ptr == NULL )
+		{
+			free( tempsnapshot );
+			AUCR_ALPHABET_Release( &tempalphabet );
+			return( AUCR_ERR_NO_MEMORY );
+		}
 	}
+	tempsnapshot->version = io_publisher_ptr->version + 1;
+	tempsnapshot->references = 1;
+	tempsnapshot->alphabet_ptr = tempalphabet;
 	
-	//fill in directional code map structure
-	fread( tempdircode->x, sizeof( int ), 
-		  temp_mappable_directional_codes, tempfp );
-	fread( tempdircode->y, sizeof( int ), 
-		  temp_mappable_directional_codes, tempfp );
+	//share each character its slot has published since it last changed, and copy
+	//the rest
+	for( i = 0; i < io_alphabet_ptr->num_characters; i++ )
+	{
+		tempalphabet->characters_ptr_ptr[i] =
+		AUCR_Character_Share( io_alphabet_ptr->characters_ptr_ptr[i] );
+		if( tempalphabet->characters_ptr_ptr[i] == NULL )
+		{
+			//unpinning the snapshot gives up the characters it has so far
+			AUCR_SNAPSHOT_Unpin( &tempsnapshot );
+			return( AUCR_ERR_NO_MEMORY );
+		}
+		tempalphabet->num_characters = i + 1;
+	}
 	
-	//create alphabet
-	temperr = AUCR_ALPHABET_Init( tempdircode, temp_num_activity_regions,
-								 temp_num_directional_codes, io_alphabet_ptr_ptr );
-	if( temperr != AUCR_ERR_SUCCESS )
+	//make the snapshot current once it is filled in, then move readers on to the
+	//next epoch, which only ever loads the new snapshot
+	oldsnapshot = io_publisher_ptr->current_ptr;
+	epoch = io_publisher_ptr->version;
+	AUCR_ATOMIC_BARRIER();
+	io_publisher_ptr->current_ptr = tempsnapshot;
+	AUCR_ATOMIC_BARRIER();
+	io_publisher_ptr->version = epoch + 1;
+	AUCR_ATOMIC_BARRIER();
+	
+	//wait out the readers of the epoch before, which may have loaded the snapshot
+	//before but not yet taken a reference to it.  no reader joins them now, so
+	//the wait ends however often readers pin.
+	for( spins = 0; io_publisher_ptr->pinning[epoch & 1] != 0; spins++ )
 	{
-		fclose( tempfp );
-		AUCR_DIRECTIONAL_CODE_MAP_Release( &tempdircode );
-		return( temperr );
+		if( spins < AUCR_PUBLISH_SPINS )
+		{
+			AUCR_ATOMIC_BARRIER();
+		}
+		else
+		{
+			AUCR_YIELD();
+		}
 	}
 	
-	//release temporary directional code map
-	AUCR_DIRECTIONAL_CODE_MAP_Release( &tempdircode );
+	//give up the publisher's reference to the snapshot before
+	AUCR_SNAPSHOT_Unpin( &oldsnapshot );
 	
-	//fill dir code mapping
-	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->positive_begin ), 
-		  sizeof( int ), 1, tempfp );
-	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->negative_begin ), 
-		  sizeof( int ), 1, tempfp );
-	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->positive_end ), 
-		  sizeof( int ), 1, tempfp );
-	fread( &( ( *io_alphabet_ptr_ptr )->directional_code_map_ptr->negative_end ), 
-		  sizeof( int ), 1, tempfp );  
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_PUBLISHER_Pin()
+ *	Description:
+ *		takes a reference to the current snapshot of a publisher, without a lock, so
+ *		that it stays as it is until it is unpinned however many times the
+ *		publisher publishes meanwhile.  any number of threads may pin at once, and
+ *		while one thread publishes.
+ *	Parameters:
+ *		io_publisher_ptr <-> publisher to pin the current snapshot of
+ *		o_snapshot_ptr_ptr <- address of the AUCR_Snapshot_Ptr to store the
+ *							snapshot in
+ *	Preconditions:
+ *		io_publisher_ptr is a valid publisher.  The AUCR_Snapshot_Ptr at
+ *		o_snapshot_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_snapshot_ptr_ptr points to the current snapshot, which must be unpinned
+ *		with AUCR_SNAPSHOT_Unpin(), or to NULL if nothing has been published
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_PUBLISHER_Pin(
+							  AUCR_Publisher_Ptr io_publisher_ptr,
+							  AUCR_Snapshot_Ptr * o_snapshot_ptr_ptr )
+{
+	//local variables
+	AUCR_Snapshot_Ptr tempsnapshot;
+	unsigned long int epoch;
 	
-	//create room in the character array
-	( *io_alphabet_ptr_ptr )->num_characters = 0;
-	( *io_alphabet_ptr_ptr )->characters_ptr_ptr = ( AUCR_Character_Ptr * )
-	malloc( sizeof( AUCR_Character_Ptr ) * temp_num_characters );
-	if( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr == NULL )
-	{
-		fclose( tempfp );
-		AUCR_ALPHABET_Release( io_alphabet_ptr_ptr );
-		return( temperr );
-	}
-	//null all pointers
-	for( i = 0; i < temp_num_characters; i++ )
+	//check for valid input
+	if( io_publisher_ptr == NULL || o_snapshot_ptr_ptr == NULL ||
+	   ( *o_snapshot_ptr_ptr ) != NULL )
 	{
-		( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i] = NULL;
+		return( AUCR_ERR_FAILED );
 	}
 	
-	//create all character structures
-	for( i = 0; i < temp_num_characters; i++ )
+	//count this reader in the current epoch, starting again if a publish moved
+	//on to the next one meanwhile, as it may not have waited for this reader
+	for( ;; )
 	{
-		fread( &temp_unicode, sizeof( wchar_t ), 1, tempfp );
-		fread( &temp_num_directional_codes, sizeof( int ), 1, tempfp );
-		fread( &temp_num_activity_regions, sizeof( int ), 1, tempfp );
-		
-		temperr = AUCR_CHARACTER_Init( temp_unicode, temp_num_directional_codes,
-									  temp_num_activity_regions, &( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i] ) );
-		if( temperr != AUCR_ERR_SUCCESS )
+		epoch = io_publisher_ptr->version;
+		AUCR_ATOMIC_ADD( io_publisher_ptr->pinning[epoch & 1], 1 );
+		if( io_publisher_ptr->version == epoch )
 		{
-			fclose( tempfp );
-			AUCR_ALPHABET_Release( io_alphabet_ptr_ptr );
-			return( temperr );
+			break;
 		}
-		
-		//fill in directional code array
-		fread( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i]->directional_codes,
-			  sizeof( int ), temp_num_directional_codes, tempfp );
-		
-		//fill in activity measures array
-		fread( ( *io_alphabet_ptr_ptr )->characters_ptr_ptr[i]->activity_measures, 
-			  sizeof( int ), temp_num_activity_regions, tempfp );
-		
-		//character added, increment num_characters
-		( ( *io_alphabet_ptr_ptr )->num_characters )++;
+		AUCR_ATOMIC_ADD( io_publisher_ptr->pinning[epoch & 1], -1 );
 	}
 	
-	//fill in all activity region structures
-	fread( ( *io_alphabet_ptr_ptr )->activity_regions, sizeof( AUCR_Activity_Region ),
-		  ( *io_alphabet_ptr_ptr )->num_activity_regions, tempfp );
+	//a publish does not give up the snapshot loaded here until the reference to
+	//it has been taken
+	tempsnapshot = io_publisher_ptr->current_ptr;
+	if( tempsnapshot != NULL )
+	{
+		AUCR_ATOMIC_ADD( tempsnapshot->references, 1 );
+	}
+	AUCR_ATOMIC_ADD( io_publisher_ptr->pinning[epoch & 1], -1 );
 	
-	//fill in all biases
-	fwrite( ( *io_alphabet_ptr_ptr )->bias, sizeof( int ),
-		   ( *io_alphabet_ptr_ptr )->num_activity_regions, tempfp ); 
+	( *o_snapshot_ptr_ptr ) = tempsnapshot;
 	
-	//close file
-	if( fclose( tempfp ) != 0 )
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_SNAPSHOT_Unpin()
+ *	Description:
+ *		gives up a reference to a snapshot, freeing it if it was the last, along with
+ *		each of its characters no other snapshot shares, and NULLs the
+ *		AUCR_Snapshot_Ptr.
+ *	Parameters:
+ *		io_snapshot_ptr_ptr <-> address of the AUCR_Snapshot_Ptr to unpin
+ *	Preconditions:
+ *		The AUCR_Snapshot_Ptr at io_snapshot_ptr_ptr is NULL or a snapshot pinned
+ *		by AUCR_PUBLISHER_Pin() and not yet unpinned.
+ *	Postconditions:
+ *		the AUCR_Snapshot_Ptr at io_snapshot_ptr_ptr is NULL
+ *	Returns:
+ *		none
+ */
+void AUCR_SNAPSHOT_Unpin(
+						 AUCR_Snapshot_Ptr * io_snapshot_ptr_ptr )
+{
+	//local variables
+	AUCR_Alphabet_Ptr tempalphabet;
+	int i;
+	
+	if( io_snapshot_ptr_ptr == NULL || ( *io_snapshot_ptr_ptr ) == NULL )
 	{
-		return( AUCR_ERR_FAILED );
+		return;
 	}
 	
-	return( AUCR_ERR_SUCCESS );
+	//the last holder frees the snapshot, whose alphabet is read-only only to its
+	//readers
+	if( AUCR_ATOMIC_ADD( ( *io_snapshot_ptr_ptr )->references, -1 ) == 0 )
+	{
+		tempalphabet = (AUCR_Alphabet_Ptr)( *io_snapshot_ptr_ptr )->alphabet_ptr;
+		for( i = 0; i < tempalphabet->num_characters; i++ )
+		{
+			AUCR_Character_Unshare( tempalphabet->characters_ptr_ptr[i] );
+		}
+		//the snapshot's alphabet has no slots, so this frees only its arrays
+		AUCR_ALPHABET_Release( &tempalphabet );
+		free( *io_snapshot_ptr_ptr );
+	}
+	( *io_snapshot_ptr_ptr ) = NULL;
+	
+	return;
 }
 
 
@@ -1954,15 +9999,11 @@ int AUCR_Rounding_Divide( int i_dividend, int i_divisor )
  *		AUCR_Integer_Square_Root()
  *	Description:
  *		function that takes an integer argument, multiplies it
- *		by (AUCR_SCALE)^2, then finds the integer approximation
- *		of the square root of this number, using only integer
- *		operations and the newton-raphson method. checks for
- *		overflow along the way and calls AUCR_Un_Scaled_Integer_Square_Root()
- *		on the original problem if overflow is detected, and returns
- *		the value it returns multiplied times the scale factor,
- *		such that the function will work numbers of any size
- *		representable by an int type, although larger numbers
- *		will have less accuracy
+ *		by (AUCR_SCALE)^2, then finds the square root of this number
+ *		rounded to the nearest integer, using only integer operations.
+ *		the root is found one bit at a time from the highest, with a
+ *		fixed number of shifts, adds and compares and no divisions, so
+ *		every int takes the same time and gets the exact answer
  *	Parameters:
  *		i_number -> the number to scale and take the square root of
  *	Preconditions:
@@ -1976,11 +10017,11 @@ int AUCR_Rounding_Divide( int i_dividend, int i_divisor )
 int AUCR_Integer_Square_Root( int i_number )
 {
 	//declare variables
-	unsigned long int square, tempguess, tempdiv;
-	long int difference = 10, olddifference = 11, guess = AUCR_SCALE;
-	signed char sign;
-	//using "long" int essentially does nothing on 32 bit machines, but
-	//on 16 bit processors, this makes sure 32 bit integers are used
+	unsigned long long int square;
+	unsigned long int root, remainder, trial;
+	int shift;
+	//the scaled number needs 64 bits, but its root and the remainder
+	//left under it fit in 32, so only the pairs of bits are read from it
 	
 	//check for valid input
 	if( i_number < 0 )
@@ -1988,77 +10029,31 @@ int AUCR_Integer_Square_Root( int i_number )
 		return( -1 );
 	}
 	
-	//check for obvious case
-	if( i_number == 0 )
-	{
-		return( 0 );
-	}
-	
-	tempguess = (unsigned long int)( i_number * AUCR_SCALE );
+	square = (unsigned long long int)i_number * AUCR_SCALE * AUCR_SCALE;
 	
-	//check for overflow
-	if( ( tempguess / AUCR_SCALE ) != (unsigned long int)i_number )
+	//bring down the bits of the square two at a time, from the highest,
+	//and decide one bit of the root from each pair
+	root = 0;
+	remainder = 0;
+	for( shift = 62; shift >= 0; shift -= 2 )
 	{
-		//call AUCR_Un_Scaled_Integer_Square_Root for smaller value
-		return( AUCR_SCALE * AUCR_Un_Scaled_Integer_Square_Root( i_number ) );
+		remainder = ( remainder << 2 ) | (unsigned long int)( ( square >> shift ) & 3 );
+		trial = ( root << 2 ) | 1;
+		root <<= 1;
+		if( remainder >= trial )
+		{
+			remainder -= trial;
+			root |= 1;
+		}
 	}
 	
-	square = tempguess * AUCR_SCALE;
-	//check for overflow
-	if( ( square / AUCR_SCALE ) != tempguess )
+	//round up when the square is past ( root + 1/2 )^2 = root^2 + root + 1/4
+	if( remainder > root )
 	{
-		//call AUCR_Un_Scaled_Integer_Square_Root for smaller value
-		return( AUCR_SCALE * AUCR_Un_Scaled_Integer_Square_Root( i_number ) );
+		root++;
 	}
 	
-	//integer based, so difference of +/- 1
-	//is the best we can do.
-	while( ( difference != 0 ) && ( difference != olddifference ) 
-		  && ( difference != ( -1 * olddifference ) ) )
-	{ 
-		tempguess = (unsigned long int)( guess * guess );
-		//check for overflow
-		if( tempguess / (unsigned long int)( ( guess < 0 ) ? ( guess * -1 ) : guess )
-		   != (unsigned long int)( ( guess < 0 ) ? ( guess * -1 ) : guess ) )
-		{ 
-			//call AUCR_Un_Scaled_Integer_Square_Root for smaller value
-			return( AUCR_SCALE * AUCR_Un_Scaled_Integer_Square_Root( i_number ) );
-		}
-		
-		//difference is the error of the current guess
-		//tempguess can only hold an unsigned value
-		if( tempguess > square )
-		{
-			tempguess = tempguess - square;
-			tempdiv = 2 * ( ( guess < 0 ) ? ( guess * -1 ) : guess );
-			sign = ( ( guess < 0 ) ? -1 : 1 );
-		}
-		//so we put the sign in sign if there is one
-		else
-		{ 
-			tempguess = square - tempguess;
-			tempdiv = 2 * ( ( guess < 0 ) ? ( guess * -1 ) : guess );
-			sign = ( ( guess < 0 ) ? 1 : -1 );
-		}
-		
-		//save old difference
-		olddifference = difference;
-		
-		//difference = tempguess / tempdiv
-		//but make sure and round appropriately
-		if( ( ( tempguess % tempdiv ) * AUCR_SCALE ) >= ( ( tempdiv * AUCR_SCALE ) / 2 ) )
-		{
-			difference = ( ( (long int)( tempguess / tempdiv ) * sign ) + sign );
-		}
-		else
-		{
-			difference = ( (long int)( tempguess / tempdiv ) * sign );
-		}
-		
-		//for new guess, subtract difference from old guess
-		guess -= difference;    
-	}
-	return( (int)guess );
+	return( (int)root );
 }
 
 
@@ -2067,13 +10062,8 @@ int AUCR_Integer_Square_Root( int i_number )
  *		AUCR_Un_Scaled_Integer_Square_Root()
  *	Description:
  *		function that takes an integer argument, the finds the
- *		integer approximation of the square root of this number,
- *		using only integer operations and the newton-raphson method.
- *		checks for overflow along the way and recursively calls itself on
- *		a reduced version of the problem if overflow is detected,
- *		such that the function will work numbers of any size
- *		representable by an int type, although larger numbers
- *		will have less accuracy
+ *		square root of this number rounded to the nearest integer,
+ *		using only integer operations, one bit of the root at a time
  *	Parameters:
  *		i_number -> the number to scale and take the square root of
  *	Preconditions:
@@ -2087,11 +10077,7 @@ int AUCR_Integer_Square_Root( int i_number )
 int AUCR_Un_Scaled_Integer_Square_Root( int i_number )
 {
 	//declare variables
-	unsigned long int square, tempguess, tempdiv;
-	long int difference = 10, olddifference = 11, guess = AUCR_SCALE;
-	signed char sign;
-	//using "long" int essentially does nothing on 32 bit machines, but
-	//on 16 bit processors, this makes sure 32 bit integers are used
+	unsigned long int root;
 	
 	//check for valid input
 	if( i_number < 0 )
@@ -2099,63 +10085,13 @@ int AUCR_Un_Scaled_Integer_Square_Root( int i_number )
 		return( -1 );
 	}
 	
-	//check for obvious case
-	if( i_number == 0 )
+	root = AUCR_Square_Root_Floor( (unsigned long int)i_number );
+	
+	//round up when the number is past ( root + 1/2 )^2 = root^2 + root + 1/4
+	if( (unsigned long int)i_number - root * root > root )
 	{
-		return( 0 );
+		root++;
 	}
 	
-	square = (unsigned long int) i_number;
-	
-	//integer based, so difference of +/- 1 is
-	//the best we can do.
-	while( ( difference != 0 ) && ( difference != olddifference )
-		  && ( difference != ( -1 * olddifference ) ) )
-	{ 
-		tempguess = (unsigned long int)( guess * guess );
-		//check for overflow
-		if( tempguess / (unsigned long int)( ( guess < 0 ) ? ( guess * -1 ) : guess )
-		   != (unsigned long int)( ( guess < 0 ) ? ( guess * -1 ) : guess ) )
-		{
-			//call AUCR_Un_Scaled_Integer_Square_Root for smaller value
-			return( AUCR_Un_Scaled_Integer_Square_Root( AUCR_SCALE ) * 
-				   AUCR_Un_Scaled_Integer_Square_Root( 
-													  AUCR_Rounding_Divide( i_number, AUCR_SCALE ) ) );
-		}
-		
-		//difference is the error of the current guess
-		//tempguess can only hold an unsigned value
-		if( tempguess > square )
-		{
-			tempguess = tempguess - square;
-			tempdiv = 2 * ( ( guess < 0 ) ? ( guess * -1 ) : guess );
-			sign = ( ( guess < 0 ) ? -1 : 1 );
-		}
-		//so we put the sign in guess if there is one
-		else
-		{
-			tempguess = square - tempguess;
-			tempdiv = 2 * ( ( guess < 0 ) ? ( guess * -1 ) : guess );
-			sign = ( ( guess < 0 ) ? 1 : -1 );
-		}
-		
-		//save old difference
-		olddifference = difference;
-		
-		//difference = tempguess / tempdiv
-		//but make sure and round appropriately
-		if( ( ( tempguess % tempdiv ) * AUCR_SCALE ) >= ( ( tempdiv * AUCR_SCALE ) / 2 ) )
-		{
-			difference = ( ( (long int)( tempguess / tempdiv ) * sign ) + sign );
-		}
-		else
-		{
-			difference = ( (long int)( tempguess / tempdiv ) * sign );
-		}
-		
-		//for new guess, subtract difference from old guess
-		guess -= difference;
-		
-	}
-	return( (int)guess );
+	return( (int)root );
 }
@@ -5,6 +5,13 @@
 #include <wchar.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+
+/* the engine is C, so keep its names unmangled when C++ includes it */
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /* ==============================================
 	MACRO / CONSTANT DEFINITIONS
@@ -13,6 +20,72 @@
 /* Set the scale here, appropriately */
 #define AUCR_SCALE 1000
 
+/* byte alignment of every section of a compiled alphabet's memory block */
+#define AUCR_CACHE_LINE 64
+
+/* byte alignment of the directional code rows of a compiled alphabet */
+#define AUCR_CODE_ROW_ALIGNMENT 32
+
+/* number of strokes the batch recognizers check against the alphabet together */
+#define AUCR_BATCH_QUERIES 8
+
+/* number of compiled rows each tile of strokes is checked against at once */
+#define AUCR_BATCH_ROWS 128
+
+/* number of consecutive directional codes summed together for the coarse bound
+	that the compiled recognizers check before the directional codes themselves,
+	on processors without vector kernels */
+#define AUCR_BLOCK_CODES 8
+
+/* most segments in the coarse rows of a compiled alphabet, each made from a run of
+	consecutive directional codes, that the coarse recognizers shortlist with */
+#define AUCR_COARSE_SEGMENTS 16
+
+/* most candidates the coarse recognizers may shortlist before checking them
+	at full resolution */
+#define AUCR_COARSE_SHORTLIST 64
+
+/* number of steps the slope of a segment is quantized to within each octant when
+	a finalized directional code map looks up the segment's directional code */
+#define AUCR_CODE_TABLE_SLOPES 256
+
+/* number of character slots in the first block an alphabet allocates; each block
+	after it has as many slots as all of the blocks before it */
+#define AUCR_ALPHABET_BLOCK 64
+
+/* fewest entries in an alphabet's table of unicode values, which is never more than
+	half full */
+#define AUCR_ALPHABET_CLASSES 64
+
+/* number of raw coordinates a new workspace has room for */
+#define AUCR_WORKSPACE_COORDINATES 1024
+
+/* number of raw coordinates a new stroke has room for */
+#define AUCR_STROKE_COORDINATES 256
+
+/* most raw coordinates a stroke with a tolerance lets one segment stand for */
+#define AUCR_STROKE_RUN 32
+
+/* tolerance, in raw units, suggested for callers that choose to decimate their
+	strokes.  a new stroke has a tolerance of 0, and the editors keep it so. */
+#define AUCR_STROKE_TOLERANCE 1
+
+/* most that one activity measure difference may add to a character's difference,
+	so that the differences of up to 256 activity regions still leave half of an
+	unsigned long for the directional code differences, and no sum wraps around */
+#define AUCR_ACTIVITY_DIFFERENCE_LIMIT ( ULONG_MAX / 512 )
+
+/* steps per unit of directional code distance that an index keeps its bounds in */
+#define AUCR_INDEX_RESOLUTION 16
+
+/* number of characters a progressive recognizer shortlists at its first speculative
+	recognition of a stroke, and fewest it shrinks the shortlist to after that */
+#define AUCR_PROGRESSIVE_SHORTLIST 32
+#define AUCR_PROGRESSIVE_KEEP 4
+
+/* number of coordinates aucrEdit lets a stroke grow by between speculative recognitions */
+#define AUCR_PROGRESSIVE_INTERVAL 8
+
 /* ==============================================
 	TYPE DEFINITIONS
    ============================================== */
@@ -47,6 +120,26 @@ typedef struct _AUCR_Interpolated_Character
 } AUCR_Interpolated_Character;
 typedef AUCR_Interpolated_Character * AUCR_Interpolated_Character_Ptr;
 
+typedef struct _AUCR_Stroke
+{
+	/* coordinates kept so far, and how many there is room for */
+	int num_coordinates;
+	int max_coordinates;
+	/* raw coordinates, without repeats of the coordinate before or those dropped
+		within the tolerance */
+	AUCR_Coordinate * coordinates;
+	/* arc length from the first coordinate to each coordinate */
+	unsigned int * distances;
+	/* most distance, in raw units, that a dropped coordinate may be from the
+		segment standing for it, or 0 to keep every coordinate.  set directly.
+		it bounds the raw coordinates only, not the character recognized. */
+	int tolerance;
+	/* coordinates the last segment stands for, dropped since the one before it */
+	AUCR_Coordinate dropped[AUCR_STROKE_RUN];
+	int num_dropped;
+} AUCR_Stroke;
+typedef AUCR_Stroke * AUCR_Stroke_Ptr;
+
 typedef struct _AUCR_Character
 {
 	wchar_t unicode;
@@ -75,13 +168,51 @@ typedef struct _AUCR_Directional_Code_Map
 	int negative_begin;
 	int positive_end;
 	int negative_end;
+	/* directional codes of the segments in each of 8 octants, by quantized slope,
+		or -1 where a slope step straddles a code boundary; NULL until finalized */
+	short * code_table;
 } AUCR_Directional_Code_Map;
 typedef AUCR_Directional_Code_Map * AUCR_Directional_Code_Map_Ptr;
 
+typedef struct _AUCR_Class
+{
+	/* unicode value of the class, or 0x0000 if the entry is empty */
+	wchar_t unicode;
+	/* number of characters in the alphabet with this unicode value, and the first and
+		last of them in the order they were added */
+	int num_prototypes;
+	AUCR_Character_Ptr first_prototype;
+	AUCR_Character_Ptr last_prototype;
+} AUCR_Class;
+typedef AUCR_Class * AUCR_Class_Ptr;
+
+typedef struct _AUCR_Class_Filter
+{
+	/* unicode values a filtered recognition may give, increasing and without repeats */
+	int num_unicodes;
+	wchar_t * unicodes;
+} AUCR_Class_Filter;
+typedef AUCR_Class_Filter * AUCR_Class_Filter_Ptr;
+
 typedef struct _AUCR_Alphabet
 {
 	int num_characters;
 	AUCR_Character_Ptr * characters_ptr_ptr; /* array of character ptrs */
+	/* room in characters_ptr_ptr; the ptrs past num_characters are free slots */
+	int max_characters;
+	/* last block of character slots, which starts with the address of the block
+		before it.  each slot holds a character and its directional codes and
+		activity measures, and never moves, so a character's ptr stays valid while
+		it is in the alphabet.  these characters are not released one by one. */
+	void * blocks;
+	/* open addressing table of the unicode values of the characters, with
+		max_classes entries, a power of two, of which num_classes are taken.  a class
+		left with no characters keeps its entry until the table next grows.  the
+		unicode value of a character in the alphabet must not be set directly, or it
+		would be in the wrong class; AUCR_ALPHABET_Replace_Class() relabels instead. */
+	AUCR_Class * classes;
+	int max_classes;
+	int num_classes;
 	AUCR_Directional_Code_Map_Ptr directional_code_map_ptr;
 	int num_activity_regions;
 	AUCR_Activity_Region * activity_regions;
@@ -90,6 +221,216 @@ typedef struct _AUCR_Alphabet
 } AUCR_Alphabet;
 typedef AUCR_Alphabet * AUCR_Alphabet_Ptr;
 
+typedef struct _AUCR_Compiled_Alphabet
+{
+	int num_characters;
+	int num_directional_codes;
+	int num_activity_regions;
+	/* bytes between the starts of consecutive rows of directional_codes */
+	int directional_code_stride;
+	/* ints between the starts of consecutive rows of activity_measures */
+	int activity_measure_stride;
+	/* ints between the starts of consecutive rows of block_sums */
+	int block_sum_stride;
+	/* codes in each row of coarse_codes, the directional codes per coarse code
+		rounded down, and bytes between the starts of consecutive rows */
+	int num_coarse_codes;
+	int coarse_code_weight;
+	int coarse_code_stride;
+	/* x and y point into block */
+	AUCR_Directional_Code_Map directional_code_map;
+	AUCR_Activity_Region * activity_regions;
+	int * bias;
+	/* num_characters rows of directional codes, one byte per code */
+	unsigned char * directional_codes;
+	/* num_characters rows of activity measures */
+	int * activity_measures;
+	/* num_characters rows of, for each block of AUCR_BLOCK_CODES directional codes,
+		the sum of their circular distances from code 0, followed by, for each block,
+		the sum of their circular distances from code mappable_directional_codes / 4 */
+	int * block_sums;
+	/* num_characters rows of coarse codes, each the mean direction of a run of
+		consecutive directional codes, one byte per code */
+	unsigned char * coarse_codes;
+	/* unicode value of each row */
+	wchar_t * unicodes;
+	/* index of each row's character in the alphabet it was compiled from */
+	int * indices;
+	/* the single allocation every array above lives in, or NULL if they live in
+		mapping instead, the read-only map of the file the compiled alphabet was
+		opened from, of mapping_size bytes */
+	void * block;
+	void * mapping;
+	unsigned long mapping_size;
+} AUCR_Compiled_Alphabet;
+typedef AUCR_Compiled_Alphabet * AUCR_Compiled_Alphabet_Ptr;
+
+typedef struct _AUCR_Candidate
+{
+	wchar_t unicode;
+	/* index of the character in the alphabet it was found in */
+	int index;
+	/* difference from the character being recognized, smaller is closer */
+	unsigned long int difference;
+} AUCR_Candidate;
+typedef AUCR_Candidate * AUCR_Candidate_Ptr;
+
+typedef struct _AUCR_Statistics
+{
+	/* rows checked by the compiled recognizers */
+	unsigned long int rows;
+	/* rows skipped because their activity measure difference was too far */
+	unsigned long int activity_skips;
+	/* rows skipped because the bound from their block sums, or their coarse code
+		difference when shortlisting, was too far */
+	unsigned long int bound_skips;
+	/* rows given up on part way through their directional codes */
+	unsigned long int direction_abandons;
+} AUCR_Statistics;
+typedef AUCR_Statistics * AUCR_Statistics_Ptr;
+
+typedef struct _AUCR_Workspace
+{
+	int num_directional_codes;
+	int num_activity_regions;
+	int mappable_directional_codes;
+	/* bytes in row and in each row of batch_rows */
+	int directional_code_stride;
+	/* ints in block_sums and in each row of batch_block_sums */
+	int block_sum_stride;
+	/* interpolated character raw coordinates are resampled into */
+	AUCR_Interpolated_Character interpolated_character;
+	/* character interpolated characters are converted into */
+	AUCR_Character character;
+	/* count of each directional code before each start and after each end of an
+		activity region, (num_directional_codes + 2) rows of mappable_directional_codes
+		ints, used to find activity measures */
+	int * hits;
+	/* directional codes packed like a row of a compiled alphabet, and their block sums */
+	unsigned char * row;
+	int * block_sums;
+	/* coarse codes packed like a row of a compiled alphabet's coarse codes */
+	unsigned char * coarse_row;
+	/* AUCR_COARSE_SHORTLIST candidates found by the coarse recognizers */
+	AUCR_Candidate * shortlist;
+	/* AUCR_BATCH_QUERIES rows of activity measures, block sums and packed directional codes */
+	int * batch_activity_measures;
+	int * batch_block_sums;
+	unsigned char * batch_rows;
+	/* cumulative distances along raw coordinates, with room for num_distances */
+	unsigned int * distances;
+	int num_distances;
+	/* the single allocation every array above except distances lives in */
+	void * block;
+	/* how many rows each check of the compiled recognizers has skipped, counted
+		over every recognition the workspace is used for until they are zeroed */
+	AUCR_Statistics statistics;
+} AUCR_Workspace;
+typedef AUCR_Workspace * AUCR_Workspace_Ptr;
+
+typedef struct _AUCR_Index_Node
+{
+	/* row of the compiled alphabet the node is centred on */
+	int row;
+	/* nodes of the rows nearer to and farther from row than the split, or -1 */
+	int inside;
+	int outside;
+	/* least and most distance from row to the rows below inside and below outside,
+		in AUCR_INDEX_RESOLUTION steps per unit, rounded outwards */
+	int inside_low;
+	int inside_high;
+	int outside_low;
+	int outside_high;
+} AUCR_Index_Node;
+typedef AUCR_Index_Node * AUCR_Index_Node_Ptr;
+
+typedef struct _AUCR_Index
+{
+	/* the compiled alphabet the index was built over, which must outlive it */
+	const AUCR_Compiled_Alphabet * compiled_alphabet_ptr;
+	/* one node per row, node 0 is the root */
+	int num_nodes;
+	AUCR_Index_Node * nodes;
+} AUCR_Index;
+typedef AUCR_Index * AUCR_Index_Ptr;
+
+typedef struct _AUCR_Latency
+{
+	/* strokes finalized, and speculative recognitions made while they were drawn */
+	unsigned long int strokes;
+	unsigned long int speculations;
+	/* strokes whose closest shortlisted character was the character recognized */
+	unsigned long int shortlist_hits;
+	/* microseconds of wall clock time spent recognizing while strokes were drawn,
+		and from pen up to result, in total and at most for one stroke.  they are
+		read from a monotonic clock where there is one, and are processor time
+		from clock() where there is not. */
+	unsigned long int speculation_microseconds;
+	unsigned long int finalize_microseconds;
+	unsigned long int finalize_max_microseconds;
+} AUCR_Latency;
+typedef AUCR_Latency * AUCR_Latency_Ptr;
+
+typedef struct _AUCR_Progressive
+{
+	/* the alphabet recognized against, which must outlive the progressive recognizer */
+	const AUCR_Alphabet * alphabet_ptr;
+	/* coordinates a stroke grows by between speculative recognitions, the number of
+		coordinates it had at the last one, and the number it had when the shortlist
+		was last taken from the whole alphabet */
+	int interval;
+	int speculated_coordinates;
+	int shortlisted_coordinates;
+	/* characters closest to the stroke so far, kept as a max-heap of up to
+		shortlist_size candidates */
+	AUCR_Candidate shortlist[AUCR_PROGRESSIVE_SHORTLIST];
+	int num_shortlisted;
+	int shortlist_size;
+	/* workspace every recognition takes scratch memory from */
+	AUCR_Workspace_Ptr workspace_ptr;
+	/* how long recognition took, counted over every stroke until it is zeroed */
+	AUCR_Latency latency;
+} AUCR_Progressive;
+typedef AUCR_Progressive * AUCR_Progressive_Ptr;
+
+typedef struct _AUCR_Snapshot
+{
+	/* number of the publish that made the snapshot, counting from 1 */
+	unsigned long int version;
+	/* holders of the snapshot; the publisher holds one while it is current */
+	volatile int references;
+	/* read-only copy of an alphabet, which recognition may be run against.  each
+		character is shared with the snapshots before and after it that publish
+		the same unchanged character, and it has no table of classes, so filtered
+		recognition against it fails. */
+	const AUCR_Alphabet * alphabet_ptr;
+} AUCR_Snapshot;
+typedef AUCR_Snapshot * AUCR_Snapshot_Ptr;
+
+typedef struct _AUCR_Publisher
+{
+	/* the last snapshot published, or NULL before the first */
+	AUCR_Snapshot * volatile current_ptr;
+	/* readers that may have loaded current_ptr but not yet taken a reference to
+		it, counted apart for odd and even versions, so a publish waits only for
+		the readers of the version before it */
+	volatile int pinning[2];
+	/* version of the last snapshot published, which is also the epoch readers pin
+		in */
+	volatile unsigned long int version;
+} AUCR_Publisher;
+typedef AUCR_Publisher * AUCR_Publisher_Ptr;
+
+/*
+ *	recognition only reads the alphabet, compiled alphabet, interpolated character and
+ *	raw coordinates it is given, and keeps everything it changes in its workspace or in
+ *	memory of its own.  any number of threads may recognize against one alphabet or
+ *	compiled alphabet at the same time, as long as each passes its own workspace, or NULL,
+ *	and nothing adds to, removes from or releases the alphabet while they do.  an alphabet
+ *	that is changed while it is recognized against can be published instead, and each
+ *	recognition run against a snapshot pinned from its publisher.
+ */
+
 
 /* ==============================================
 	FUNCTION DEFINITIONS
@@ -109,7 +450,7 @@ typedef AUCR_Alphabet * AUCR_Alphabet_Ptr;
  *		io_alphabet_ptr_ptr is a a valid pointer to a NULL alphabet pointer
  *		and i_file_path is a valid pointer to a valid string that is the
  *		path name of a valid file that was previously created by a call to the 
- *		AUCR_ALPHABET_Save_To_File() function.
+ *		AUCR_ALPHABET_Save_To_File() or AUCR_COMPILED_ALPHABET_Save_To_File() function.
  *	Postconditions:
  *		the alphabet has been filled in with the information from the file, and the
  *		file itself remains unchanged.
@@ -117,6 +458,10 @@ typedef AUCR_Alphabet * AUCR_Alphabet_Ptr;
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
  *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if a character in the file does not agree with
+ *													the alphabet in its numbers of codes or regions,
+ *													or a compiled alphabet file cannot be opened
+ *													by this build
  */
 AUCR_Error AUCR_ALPHABET_Open_From_File(
  	const char * i_file_path,
@@ -268,11 +613,13 @@ void AUCR_INTERPOLATED_CHARACTER_Release(
  *		i_coordinates -> array of raw pen coordinates
  *		io_interpolated_character_ptr <-> address of the AUCR_Interpolated_Character
  *								to be populated from the raw data
+ *		io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *								allocate it for this call only
  *	Preconditions:
  *		io_interpolated_character_ptr is a valid address of an initialized AUCR_Interpolated_Character.
  *	Postconditions:
  *		io_interpolated_character_ptr is populated with the interpolated version if the raw
- *		coordinates.
+ *		coordinates.  i_coordinates is unchanged, short strokes are scaled up as they are read.
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
@@ -280,7 +627,149 @@ void AUCR_INTERPOLATED_CHARACTER_Release(
  */
 AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Raw(
 	int i_num_coordinates,
-	AUCR_Coordinate * i_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Init()
+ *	Description:
+ *		Initializes a new, empty AUCR_Stroke with room for AUCR_STROKE_COORDINATES
+ *		coordinates.
+ *	Parameters:
+ *		o_stroke_ptr_ptr <- address of the AUCR_Stroke_Ptr to be populated with the
+ *							new AUCR_Stroke.
+ *	Preconditions:
+ *		The AUCR_Stroke_Ptr at o_stroke_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_stroke_ptr_ptr is the address of a newly allocated AUCR_Stroke with no
+ *		coordinates and a tolerance of 0, so that it keeps every coordinate.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_STROKE_Init(
+	AUCR_Stroke_Ptr * o_stroke_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Release()
+ *	Description:
+ *		Frees all memories of the AUCR_Stroke and the structure itself, and NULLs
+ *		the AUCR_Stroke_Ptr.
+ *	Parameters:
+ *		io_stroke_ptr_ptr <-> address of the AUCR_Stroke to be freed.
+ *	Preconditions:
+ *		The AUCR_Stroke_Ptr at io_stroke_ptr_ptr is NULL or the address of an
+ *		AUCR_Stroke created by AUCR_STROKE_Init().
+ *	Postconditions:
+ *		all memory of the stroke is freed and the AUCR_Stroke_Ptr at
+ *		io_stroke_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_STROKE_Release(
+	AUCR_Stroke_Ptr * io_stroke_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Clear()
+ *	Description:
+ *		empties a stroke so that a new one can be drawn into it, keeping its memory
+ *		and its tolerance.
+ *	Parameters:
+ *		io_stroke_ptr <-> pointer to the stroke to empty
+ *	Preconditions:
+ *		io_stroke_ptr is a valid stroke
+ *	Postconditions:
+ *		the stroke has no coordinates
+ *	Returns:
+ *		none
+ */
+void AUCR_STROKE_Clear(
+	AUCR_Stroke_Ptr io_stroke_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_STROKE_Add_Coordinate()
+ *	Description:
+ *		adds the next raw pen coordinate to a stroke as it is drawn, and adds the
+ *		length of the segment to it to the stroke's arc length, so that nothing but
+ *		the resampling is left to do once the stroke is finished.  a coordinate
+ *		that repeats the last one adds no length and could not change the
+ *		interpolated character, so it is dropped.  the stroke at least doubles its
+ *		room whenever it must grow.
+ *
+ *		a stroke with a tolerance also decimates the coordinates as they come: the
+ *		last coordinate is dropped, and the new one ends the last segment in its
+ *		place, whenever it and every coordinate already dropped for that segment are
+ *		within the tolerance of the longer segment.  no coordinate drawn is then
+ *		farther than the tolerance from the stroke kept, and one segment stands for
+ *		at most AUCR_STROKE_RUN coordinates, so a slow stroke from a fast digitizer
+ *		keeps only the coordinates that change its shape.
+ *
+ *		the tolerance bounds only how far the raw coordinates kept are from those
+ *		drawn.  it does not bound the resampled character: the stroke kept is
+ *		shorter than the one drawn, so the interpolated coordinates may move by
+ *		more than the tolerance, and the directional codes, activity measures and
+ *		unicode recognized may differ from those the stroke would give with every
+ *		coordinate kept.  a tolerance is therefore opt-in, and a new stroke has a
+ *		tolerance of 0.
+ *	Parameters:
+ *		i_x -> x of the raw coordinate
+ *		i_y -> y of the raw coordinate
+ *		io_stroke_ptr <-> pointer to the stroke to add to
+ *	Preconditions:
+ *		io_stroke_ptr is a valid stroke
+ *	Postconditions:
+ *		the coordinate ends the stroke, either added after the last coordinate or in
+ *		its place, and the stroke is unchanged if it could not be grown
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the array memories could not be grown
+ */
+AUCR_Error AUCR_STROKE_Add_Coordinate(
+	int i_x,
+	int i_y,
+	AUCR_Stroke_Ptr io_stroke_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INTERPOLATED_CHARACTER_From_Stroke()
+ *	Description:
+ *		Converts a stroke built up by AUCR_STROKE_Add_Coordinate() to an
+ *		AUCR_Interpolated_Character.  the arc length was kept as the stroke was
+ *		drawn, so only the resampling is done here, and the interpolated character
+ *		is the one AUCR_INTERPOLATED_CHARACTER_From_Raw() makes from the same
+ *		raw coordinates.
+ *	Parameters:
+ *		i_stroke_ptr -> pointer to the stroke to convert
+ *		io_interpolated_character_ptr <-> address of the AUCR_Interpolated_Character
+ *								to be populated from the stroke
+ *	Preconditions:
+ *		i_stroke_ptr is a valid stroke of at least one coordinate.
+ *		io_interpolated_character_ptr is a valid address of an initialized AUCR_Interpolated_Character.
+ *	Postconditions:
+ *		io_interpolated_character_ptr is populated with the interpolated version of the
+ *		stroke.  the stroke is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Stroke(
+	const AUCR_Stroke * i_stroke_ptr,
 	AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr
 );
 
@@ -302,7 +791,8 @@ AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Raw(
  *	Postconditions:
  *		o_directional_code_map_ptr_ptr is the address of a newly allocated and initialized
  *		AUCR_Directional_Code_Map_Ptr.  Its "x" and "y" variables are newly allocated arrays
- *		of (mappable_directional_codes) elements... each element set to zero.
+ *		of (mappable_directional_codes) elements... each element set to zero.  Its
+ *		"code_table" is NULL until it is finalized.
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
@@ -331,10 +821,12 @@ AUCR_Error AUCR_DIRECTIONAL_CODE_MAP_Init(
  *		counterclockwise order, starting from the zeroeth direcional code
  *	Postconditions:
  *		positive_begin, positive_end, negative_begin, and negative_end have all been set
- *		to their appropriate values.
+ *		to their appropriate values, and code_table has been filled in so that most
+ *		segments find their directional code with one load instead of a search.
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the code table could not be allocated
  */
 AUCR_Error AUCR_DIRECTIONAL_CODE_MAP_Finalize(
 	AUCR_Directional_Code_Map_Ptr io_directional_code_map_ptr
@@ -353,7 +845,7 @@ AUCR_Error AUCR_DIRECTIONAL_CODE_MAP_Finalize(
  *		The AUCR_Directional_Code_Map_Ptr at io_directional_code_map_ptr_ptr
  *		is a valid address of an AUCR_Directional_Code_Map.
  *	Postconditions:
- *		The AUCR_Directional_Code_Map's "x" and "y" arrays are freed
+ *		The AUCR_Directional_Code_Map's "x", "y" and "code_table" arrays are freed
  *		followed by the memory for the AUCR_Directional_Code_Map as well.
  *		The AUCR_Directional_Code_Map_Ptr at io_directional_code_map_ptr_ptr
  *		is NULL.
@@ -393,8 +885,8 @@ void AUCR_DIRECTIONAL_CODE_MAP_Release(
  *		the values held by i_num_activity_regions and i_num_directional_codes
  *		have been stored, bias is new array of biases(length i_num_activity_regions),
  *		activity_regions is a new array of activity regions (length i_num_activity_regions),
- *		characters_ptr_ptr is set to NULL (to prepare it for realloc), num_characters
- *		is set to zero, and o_alphabet_ptr_ptr points to an AUCR_Alphabet_Ptr which in turn points
+ *		characters_ptr_ptr, blocks and classes are set to NULL, num_characters,
+ *		max_characters, max_classes and num_classes are set to zero, and o_alphabet_ptr_ptr points to an AUCR_Alphabet_Ptr which in turn points
  *		to a newly created AUCR_Alphabet structure which contains all the previous information.
  *	Returns:
  *		AUCR_ERR_SUCCESS
@@ -421,8 +913,8 @@ AUCR_Error AUCR_ALPHABET_Init(
  *		The AUCR_Alphabet_Ptr at io_alphabet_ptr_ptr
  *		is a valid address of an AUCR_Alphabet.
  *	Postconditions:
- *		num_characters AUCR_Characters have been freed, the characters_ptr_ptr array
- *		has been freed, the biases array has been freed, the activity_regions array
+ *		every block of character slots has been freed, the characters_ptr_ptr array
+ *		and the table of classes have been freed, the biases array has been freed, the activity_regions array
  *		has been freed, the AUCR_Directional_Code_Map has been freed, the AUCR_Alphabet
  *		structure has been freed and the AUCR_Alphabet_Ptr at io_alphabet_ptr_ptr has
  *		been set to NULL.
@@ -443,16 +935,19 @@ void AUCR_ALPHABET_Release(
  *		i_interpolated_character_ptr -> address of an interpolated character
  *		io_alphabet_ptr -> address of the alphabet to add the character to
  *	Preconditions:
- *		i_interpolated_character_ptr is the address of a valid AUCR_Interpolated_Character,
+ *		i_interpolated_character_ptr is the address of a valid AUCR_Interpolated_Character
+ *		whose unicode is not 0x0000, which is reserved as an error character,
  *		io_alphabet_ptr is the address of a valid AUCR_Alphabet, and the num_directional_codes
  *		for the alphabet is in agreement with the num_directional_codes for the character
  *	Postconditions:
- *		interpolated character has been converted to character, characters_ptr_ptr is
- *		reallocated to have room for new character, which is stored in character array
- *		of the alphabet, num_characters has been incremented by 1,
+ *		interpolated character has been converted to character in the next free slot
+ *		of the alphabet, which is stored in character array of the alphabet and last
+ *		in its class, num_characters has been incremented by 1.  if there was no free slot, the
+ *		character array and the slots have first grown to twice their number.
  *	Returns:
  *		AUCR_ERR_SUCCESS
- *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_FAILED if preconditions are unmet, which includes a character whose
+ *						unicode is 0x0000.  the alphabet is then unchanged.
  *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
  *													num_directional_codes are met
@@ -482,7 +977,9 @@ AUCR_Error AUCR_ALPHABET_Add_Interpolated_Character(
  *	Postconditions:
  *		raw coordinates have been converted to an interpolated character, which is then
  *		converted to character, stored in character array of the alphabet, num_characters
- *		has been incremented by 1, characters_ptr_ptr is reallocated to have room for new character
+ *		has been incremented by 1, characters_ptr_ptr and the slots grow as
+ *		AUCR_ALPHABET_Add_Interpolated_Character() grows them,
+ *		i_coordinates is unchanged, short strokes are scaled up as they are read
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
@@ -491,7 +988,7 @@ AUCR_Error AUCR_ALPHABET_Add_Interpolated_Character(
 AUCR_Error AUCR_ALPHABET_Add_Raw(
 	wchar_t i_unicode,
 	int i_num_coordinates,
-	AUCR_Coordinate * i_coordinates,
+	const AUCR_Coordinate * i_coordinates,
 	AUCR_Alphabet_Ptr io_alphabet_ptr
 );
 
@@ -511,9 +1008,17 @@ AUCR_Error AUCR_ALPHABET_Add_Raw(
  *		AUCR_Alphabet structure
  *	Postconditions:
  *		the character at characters_ptr_ptr[i_character_number] is removed from this
- *		array, and the memory reserved for the character structure is freed, the memory
- *		reserved for the the characters_ptr_ptr array is reallocated and num_characters
- *		is decremented by one
+ *		array by swapping it with the last character, and from its class.  its slot is
+ *		kept free for the next character added, and num_characters is decremented by
+ *		one.  no memory is freed or moved, so the pointers to the other characters are
+ *		still valid.
+ *
+ *		the swap reorders the character array: the last character takes the index of
+ *		the one removed.  the recognizers give the lower index of two equally close
+ *		characters, so removing a character can change which of two ties is
+ *		recognized, and anything that lists the characters by index sees the last
+ *		moved forward.  the order of each class is kept, so alfEdit, which shows a
+ *		class through AUCR_ALPHABET_Get_Class(), still shows it in the order added.
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
@@ -525,6 +1030,77 @@ AUCR_Error AUCR_ALPHABET_Remove_Character(
 );
 
 
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Get_Class()
+ *	Description:
+ *		looks up the characters of the alphabet with a unicode value in the alphabet's
+ *		table of classes, without scanning the characters
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet to look in
+ *		i_unicode -> unicode value of the class
+ *		i_max_prototypes -> most characters to store in o_prototypes
+ *		o_prototypes <- array of i_max_prototypes character ptrs to fill in
+ *		o_num_prototypes_ptr <- address of int variable to store the number of
+ *								characters in the class in
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet, i_max_prototypes is not negative, and
+ *		o_prototypes holds that many ptrs, or may be NULL if it is zero
+ *	Postconditions:
+ *		the first i_max_prototypes characters of the class, or all of them if there
+ *		are fewer, are stored in o_prototypes in the order they were added, and the
+ *		number of characters in the class is stored in the variable pointed to by
+ *		o_num_prototypes_ptr.  it is 0 if no character has i_unicode.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_ALPHABET_Get_Class(
+	const AUCR_Alphabet * i_alphabet_ptr,
+	wchar_t i_unicode,
+	int i_max_prototypes,
+	AUCR_Character_Ptr * o_prototypes,
+	int * o_num_prototypes_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Replace_Class()
+ *	Description:
+ *		replaces every character of the alphabet with a unicode value by characters
+ *		converted from interpolated characters
+ *	Parameters:
+ *		i_unicode -> unicode value of the class to replace
+ *		i_num_interpolated_characters -> number of interpolated characters given
+ *		i_interpolated_characters -> array of i_num_interpolated_characters
+ *										interpolated character ptrs
+ *		io_alphabet_ptr <-> alphabet to replace the class in
+ *	Preconditions:
+ *		i_unicode is not 0x0000, i_num_interpolated_characters is not negative,
+ *		i_interpolated_characters holds that many valid interpolated characters, or
+ *		may be NULL if it is zero, io_alphabet_ptr is a valid alphabet, and the
+ *		num_directional_codes of every interpolated character agrees with the alphabet
+ *	Postconditions:
+ *		the characters of the class have been removed as
+ *		AUCR_ALPHABET_Remove_Character() removes them, and the interpolated characters
+ *		have been converted to characters with the unicode value i_unicode and added
+ *		to the class in their order.  if an error is returned, the class is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the slots or the table of classes could not be grown
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_ALPHABET_Replace_Class(
+	wchar_t i_unicode,
+	int i_num_interpolated_characters,
+	AUCR_Interpolated_Character_Ptr * i_interpolated_characters,
+	AUCR_Alphabet_Ptr io_alphabet_ptr
+);
+
+
 /*
  *	Name:
  *		AUCR_ALPHABET_Recognize_From_Interpolated()
@@ -537,6 +1113,8 @@ AUCR_Error AUCR_ALPHABET_Remove_Character(
  *														for a match for
  *			io_alphabet_ptr <-> address of the alphabet to find the character in
  *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
  *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
  *		io_alphabet_ptr is a valid pointer to a valid pointer to a valid alphabet,
@@ -552,9 +1130,10 @@ AUCR_Error AUCR_ALPHABET_Remove_Character(
  *													num_directional_codes are met
  */
 AUCR_Error AUCR_ALPHABET_Recognize_From_Interpolated(
-	AUCR_Interpolated_Character_Ptr i_interpolated_character_ptr,
-	AUCR_Alphabet_Ptr i_alphabet_ptr,
-	wchar_t * o_unicode_ptr
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
 );
 
 
@@ -564,12 +1143,16 @@ AUCR_Error AUCR_ALPHABET_Recognize_From_Interpolated(
  *	Description:
  *		finds the character in the alphabet that is closest to the
  *		interpolated character that is created from the raw data that is given,
- *		then return the unicode of this found character
+ *		then return the unicode of this found character.  the features are found
+ *		in one pass along the raw coordinates, without building the interpolated
+ *		character, and are the same as AUCR_CHARACTER_From_Interpolated() gives
  *	Parameters:
  *			i_num_coordinates -> number of raw coordinates supplied
  *			i_coordinates -> array of raw coordinates of length i_num_coordinate
  *			io_alphabet_ptr <-> pointer to alphabet to search against
  *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
  *		i_num coordinates is positive integer
  *		i_coordinates is non NULL and points to a valid array of
@@ -585,163 +1168,1492 @@ AUCR_Error AUCR_ALPHABET_Recognize_From_Interpolated(
  */
 AUCR_Error AUCR_ALPHABET_Recognize_From_Raw(
 	int i_num_coordinates,
-	AUCR_Coordinate * i_coordinates,
-	AUCR_Alphabet_Ptr i_alphabet_ptr,
-	wchar_t * o_unicode_ptr
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
 );
 
-
 /*
  *	Name:
- *		AUCR_CHARACTER_From_Interpolated()
+ *		AUCR_ALPHABET_Recognize_From_Stroke()
  *	Description:
- *		takes in an interpolated character and an alphabet and forms the character
- *		representation of the interpolated character based on the alphabet.
+ *		finds the character in the alphabet that is closest to the
+ *		interpolated character that is created from the stroke that is given,
+ *		then return the unicode of this found character.  the features are found
+ *		in one pass along the raw coordinates, without building the interpolated
+ *		character, and are the same as AUCR_CHARACTER_From_Interpolated() gives
  *	Parameters:
- *		i_interpolated_character_ptr -> a pointer to an interpolated character
- *		i_alphabet_ptr -> a pointer to an alphabet
- *		io_character_ptr <-> a pointer to a character that we will fill in
+ *			i_stroke_ptr -> pointer to the stroke to recognize
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
- *		i_interpolated_character_ptr is non NULL and is a pointer to a valid
- *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
- *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
- *		character, num_directional_codes between the alphabet and the interpolated
- *		are in agreement
+ *		i_stroke_ptr is a valid stroke of at least one coordinate,
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet
  *	Postconditions:
- *		io_character_ptr is populated with the character version of the
- *		interpolated character
+ *		the closest character in the alphabet has been found, and its unicode value
+ *		is stored in the variable pointed to by o_unicode_ptr
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
- *													num_directional_codes are met
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  */
-AUCR_Error AUCR_CHARACTER_From_Interpolated(
-	AUCR_Interpolated_Character_Ptr i_interpolated_character_ptr,
-	AUCR_Alphabet_Ptr i_alphabet_ptr,
-	AUCR_Character_Ptr io_character_ptr
+AUCR_Error AUCR_ALPHABET_Recognize_From_Stroke(
+	const AUCR_Stroke * i_stroke_ptr,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
 );
 
 
 /*
  *	Name:
- *		AUCR_INTERPOLATED_CHARACTER_From_Character()
+ *		AUCR_CLASS_FILTER_Init()
  *	Description:
- *		takes in a character and the alphabet that formed the character, as
- *		well as a rectangle (in pixels) and the border inside the rectangle
- *		and returns an interpolated character whose coordinates fill a
- *		rectangle of the given size while always staying a distance of
- *		border pixels from the edge of the rectangle.
- *		note: this function is primarily intended to be used as a mechanism
- *		to get points that can be written to screen, such that a character
- *		may be displayed.  it does not return an interpolated character
- *		that is identical to the interpolated character that was used to
- *		create the character in the alphabet.
+ *		Initializes a new AUCR_Class_Filter of the unicode values that
+ *		AUCR_ALPHABET_Recognize_Filtered() may give, such as the digits of a field
+ *		that only takes numbers.  the unicode values are sorted and repeats dropped.
  *	Parameters:
- *		i_character_ptr -> a pointer to a character
- *		i_alphabet_ptr -> a pointer to the alphabet that was used to create the character
- *		i_rectangle_width -> the width in pixels of the bounding rectangle for the points
- *										in the interpolated character
- *		i_rectangle_height -> the height in pixels of the bounding rectangle for the points
- *										in the interpolated character
- *		i_rectangle_border -> the closest distance in pixels that any point in the
- *										interpolated character can come to the edge of the
- *										bounding rectangle
- *		io_interpolated charactercharacter_ptr <-> a pointer to an interpolated character
- *				that will be filled in by extrapolating information from the character
+ *		i_num_unicodes -> number of unicode values given
+ *		i_unicodes -> array of i_num_unicodes unicode values
+ *		o_filter_ptr_ptr <- address of the AUCR_Class_Filter_Ptr to be populated
+ *							with the new AUCR_Class_Filter
  *	Preconditions:
- *		io_interpolated_character_ptr is non NULL and is a pointer to a valid
- *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
- *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
- *		character, i_rectangle_width is positive, i_rectangle_height is positive,
- *		i_rectangle_border is non negative, and num_directional_codes between
- *		the alphabet, character, and the interpolated character are in agreement
+ *		i_num_unicodes is positive, i_unicodes holds that many unicode values, none
+ *		of them 0x0000, and the AUCR_Class_Filter_Ptr at o_filter_ptr_ptr is NULL
  *	Postconditions:
- *		io_interpolated_character_ptr is populated with the interpolated version of the
- *		character in i_character_ptr
+ *		o_filter_ptr_ptr points to a new filter holding each unicode value once, in
+ *		increasing order, and i_unicodes is unchanged
  *	Returns:
  *		AUCR_ERR_SUCCESS
  *		AUCR_ERR_FAILED if preconditions are unmet.
- *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
- *													num_directional_codes are met
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
  */
-AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Character(
-	AUCR_Character_Ptr i_character_ptr,
-	AUCR_Alphabet_Ptr i_alphabet_ptr,
-	int i_rectangle_width,
-	int i_rectangle_height,
-	int i_rectangle_border,
-	AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr
+AUCR_Error AUCR_CLASS_FILTER_Init(
+	int i_num_unicodes,
+	const wchar_t * i_unicodes,
+	AUCR_Class_Filter_Ptr * o_filter_ptr_ptr
 );
 
 
 /*
  *	Name:
- *		AUCR_Rounding_Divide()
+ *		AUCR_CLASS_FILTER_Release()
  *	Description:
- *		performs division on two integers, but instead of truncating
- *		the remainder, rounds up or down to the nearest integer
+ *		Frees all dynamically allocated memories for the AUCR_Class_Filter and NULLs
+ *		the AUCR_Class_Filter_Ptr.
  *	Parameters:
- *		i_dividend -> the integer to be divided
- *		i_divisor -> the integer to divide by
+ *		io_filter_ptr_ptr <-> address of the AUCR_Class_Filter_Ptr to be freed
  *	Preconditions:
- *		i_dividend and i_divisor are valid integers
+ *		The AUCR_Class_Filter_Ptr at io_filter_ptr_ptr is a valid filter or NULL
  *	Postconditions:
- *		nothing has changed
+ *		the filter's memories have been freed and the AUCR_Class_Filter_Ptr at
+ *		io_filter_ptr_ptr is NULL
  *	Returns:
- *		integer result of the rounded divide
+ *		none
  */
-int AUCR_Rounding_Divide(
-	int i_dividend,
-	int i_divisor
+void AUCR_CLASS_FILTER_Release(
+	AUCR_Class_Filter_Ptr * io_filter_ptr_ptr
 );
 
 
 /*
  *	Name:
- *		AUCR_Integer_Square_Root()
+ *		AUCR_ALPHABET_Recognize_Filtered()
  *	Description:
- *		function that takes an integer argument, multiplies it
- *		by (AUCR_SCALE)^2, then finds the integer approximation
- *		of the square root of this number, using only integer
- *		operations and the newton-raphson method. checks for
- *		overflow along the way and calls AUCR_Un_Scaled_Integer_Square_Root()
- *		on the original problem if overflow is detected, and returns
- *		the value it returns multiplied times the scale factor,
- *		such that the function will work numbers of any size
- *		representable by an int type, although larger numbers
- *		will have less accuracy
+ *		finds the character closest to raw coordinates among only the classes of
+ *		a filter, and returns its unicode value.  the classes are followed from the
+ *		alphabet's table of classes, so the characters of every other class are
+ *		skipped without being read, and the time taken grows with the characters
+ *		of the filter's classes rather than with the alphabet.  the features are
+ *		found as AUCR_ALPHABET_Recognize_From_Raw() finds them, and the result is
+ *		what it would give for an alphabet of only the filter's classes.
  *	Parameters:
- *		i_number -> the number to scale and take the square root of
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinates
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			i_filter_ptr -> filter of the unicode values that may be given
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
- *		i_number is a valid (nonnegative), unscaled integer
+ *		i_num_coordinates is positive, i_coordinates points to a valid array of
+ *		i_num_coordinates coordinates, i_alphabet_ptr is a valid alphabet with a
+ *		table of classes, which the alphabet of a snapshot does not have, and
+ *		i_filter_ptr is a valid filter
  *	Postconditions:
- *		nothing has changed
+ *		the closest character of the filter's classes has been found, and its
+ *		unicode value is stored in the variable pointed to by o_unicode_ptr, or
+ *		0x0000 if no character of the alphabet is in the filter
  *	Returns:
- *		integer result of the square root of the scaled input if
- *		no error, -1 on error
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet, or the alphabet has characters
+ *		but no table of classes
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if the workspace was made for another geometry
  */
-int AUCR_Integer_Square_Root( 
-	int i_number
+AUCR_Error AUCR_ALPHABET_Recognize_Filtered(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	const AUCR_Class_Filter * i_filter_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
 );
 
 
 /*
  *	Name:
- *		AUCR_Un_Scaled_Integer_Square_Root()
+ *		AUCR_ALPHABET_Recognize_Candidates_From_Interpolated()
  *	Description:
- *		function that takes an integer argument, the finds the
- *		integer approximation of the square root of this number,
- *		using only integer operations and the newton-raphson method.
- *		checks for overflow along the way and recursively calls itself on
- *		a reduced version of the problem if overflow is detected,
- *		such that the function will work numbers of any size
- *		representable by an int type, although larger numbers
- *		will have less accuracy
+ *		finds the characters in the alphabet that are closest to the
+ *		interpolated character given as an argument, and returns up to
+ *		i_max_candidates of them, closest first, with their unicode values,
+ *		their indices in the alphabet and their differences.  characters are
+ *		skipped once their activity measure difference is farther than the farthest
+ *		of the closest candidates found so far, so with one candidate the result is
+ *		the character that AUCR_ALPHABET_Recognize_From_Interpolated() would find.
  *	Parameters:
- *		i_number -> the number to scale and take the square root of
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_alphabet_ptr -> address of the alphabet to find the characters in
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
  *	Preconditions:
- *		i_number is a valid (nonnegative), unscaled integer
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		num_directional_codes between the alphabet and the character is in agreement
+ *	Postconditions:
+ *		the closest characters in the alphabet have been found and are stored closest
+ *		first in o_candidates, and their number, the smaller of i_max_candidates and
+ *		the number of characters in the alphabet, is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_Candidates_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_Candidates_From_Raw()
+ *	Description:
+ *		finds the characters in the alphabet that are closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then returns up to i_max_candidates of them, closest first
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates
+ *	Postconditions:
+ *		the closest characters in the alphabet have been found and are stored closest
+ *		first in o_candidates, and their number is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_Candidates_From_Raw(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Recognize_Batch()
+ *	Description:
+ *		finds the character in the alphabet that is closest to each of many
+ *		strokes of raw data, storing the unicode of each found character.  the
+ *		alphabet is compiled once for the batch, and the strokes are recognized
+ *		by AUCR_COMPILED_ALPHABET_Recognize_Batch().  each result is the same as
+ *		AUCR_ALPHABET_Recognize_From_Raw() gives for its stroke.
+ *	Parameters:
+ *			i_num_strokes -> number of strokes supplied
+ *			i_stroke_offsets -> array of (i_num_strokes + 1) offsets into i_coordinates,
+ *							stroke s is made of the coordinates from i_stroke_offsets[s]
+ *							up to but not including i_stroke_offsets[s + 1]
+ *			i_coordinates -> array of the raw coordinates of every stroke
+ *			i_alphabet_ptr -> pointer to alphabet to search against
+ *			o_unicodes <- array of i_num_strokes wchar_t variables to store unicodes in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num_strokes is non negative, i_stroke_offsets is non NULL, starts at zero or
+ *		more and never decreases, i_coordinates is non NULL and holds all of the
+ *		coordinates the offsets refer to, and i_alphabet_ptr is a valid pointer to a
+ *		valid alphabet with at least one character
+ *	Postconditions:
+ *		the closest character to each stroke has been found, and its unicode value
+ *		is stored in o_unicodes.  strokes with no coordinates are given 0x0000.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if the alphabet's characters do not agree with it
+ */
+AUCR_Error AUCR_ALPHABET_Recognize_Batch(
+	int i_num_strokes,
+	const int * i_stroke_offsets,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	wchar_t * o_unicodes,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_CHARACTER_From_Interpolated()
+ *	Description:
+ *		takes in an interpolated character and an alphabet and forms the character
+ *		representation of the interpolated character based on the alphabet.
+ *	Parameters:
+ *		i_interpolated_character_ptr -> a pointer to an interpolated character
+ *		i_alphabet_ptr -> a pointer to an alphabet
+ *		io_character_ptr <-> a pointer to a character that we will fill in
+ *		io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *								allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is non NULL and is a pointer to a valid
+ *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
+ *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
+ *		character, num_directional_codes between the alphabet and the interpolated
+ *		are in agreement
+ *	Postconditions:
+ *		io_character_ptr is populated with the character version of the
+ *		interpolated character
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_CHARACTER_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	AUCR_Character_Ptr io_character_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INTERPOLATED_CHARACTER_From_Character()
+ *	Description:
+ *		takes in a character and the alphabet that formed the character, as
+ *		well as a rectangle (in pixels) and the border inside the rectangle
+ *		and returns an interpolated character whose coordinates fill a
+ *		rectangle of the given size while always staying a distance of
+ *		border pixels from the edge of the rectangle.
+ *		note: this function is primarily intended to be used as a mechanism
+ *		to get points that can be written to screen, such that a character
+ *		may be displayed.  it does not return an interpolated character
+ *		that is identical to the interpolated character that was used to
+ *		create the character in the alphabet.
+ *	Parameters:
+ *		i_character_ptr -> a pointer to a character
+ *		i_alphabet_ptr -> a pointer to the alphabet that was used to create the character
+ *		i_rectangle_width -> the width in pixels of the bounding rectangle for the points
+ *										in the interpolated character
+ *		i_rectangle_height -> the height in pixels of the bounding rectangle for the points
+ *										in the interpolated character
+ *		i_rectangle_border -> the closest distance in pixels that any point in the
+ *										interpolated character can come to the edge of the
+ *										bounding rectangle
+ *		io_interpolated charactercharacter_ptr <-> a pointer to an interpolated character
+ *				that will be filled in by extrapolating information from the character
+ *	Preconditions:
+ *		io_interpolated_character_ptr is non NULL and is a pointer to a valid
+ *		interpolated character, i_alphabet_ptr is non NULL and is a pointer to
+ *		a valid alphabet, io_character_ptr is non NULL and is a pointer to a valid
+ *		character, i_rectangle_width is positive, i_rectangle_height is positive,
+ *		i_rectangle_border is non negative, and num_directional_codes between
+ *		the alphabet, character, and the interpolated character are in agreement
+ *	Postconditions:
+ *		io_interpolated_character_ptr is populated with the interpolated version of the
+ *		character in i_character_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_INTERPOLATED_CHARACTER_From_Character(
+	const AUCR_Character * i_character_ptr,
+	const AUCR_Alphabet * i_alphabet_ptr,
+	int i_rectangle_width,
+	int i_rectangle_height,
+	int i_rectangle_border,
+	AUCR_Interpolated_Character_Ptr io_interpolated_character_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_ALPHABET_Compile()
+ *	Description:
+ *		builds a read-only snapshot of an alphabet that is laid out for fast
+ *		recognition.  all of the directional codes are packed one byte per code
+ *		into rows of one matrix, all of the activity measures into rows of a second
+ *		matrix, and all of the unicode values into a third array, all inside of a
+ *		single cache line aligned block of memory.  each row also keeps the block
+ *		sums of its directional codes, which let recognition drop far rows before
+ *		checking their codes one by one, and up to AUCR_COARSE_SEGMENTS coarse
+ *		codes, which the coarse recognizers shortlist rows with.  the snapshot does
+ *		not refer back to the alphabet, so the alphabet may be changed or released
+ *		afterwards.
+ *	Parameters:
+ *		i_alphabet_ptr -> pointer to the alphabet to compile
+ *		o_compiled_alphabet_ptr_ptr <- address of the AUCR_Compiled_Alphabet_Ptr to be
+ *							populated with the new AUCR_Compiled_Alphabet
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet whose characters all
+ *		agree with it on num_directional_codes and num_activity_regions, and whose
+ *		mappable_directional_codes is no more than 256.  The AUCR_Compiled_Alphabet_Ptr
+ *		at o_compiled_alphabet_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_compiled_alphabet_ptr_ptr points to a newly allocated compiled copy of the
+ *		alphabet, and the alphabet itself is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													the characters with the alphabet are met
+ */
+AUCR_Error AUCR_ALPHABET_Compile(
+	const AUCR_Alphabet * i_alphabet_ptr,
+	AUCR_Compiled_Alphabet_Ptr * o_compiled_alphabet_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Release()
+ *	Description:
+ *		Frees the memory block of the AUCR_Compiled_Alphabet, or unmaps the file it was
+ *		opened from, and the structure itself, and NULLs the AUCR_Compiled_Alphabet_Ptr.
+ *	Parameters:
+ *		io_compiled_alphabet_ptr_ptr <-> address of the AUCR_Compiled_Alphabet to be freed.
+ *	Preconditions:
+ *		The AUCR_Compiled_Alphabet_Ptr at io_compiled_alphabet_ptr_ptr is NULL or
+ *		the address of an AUCR_Compiled_Alphabet created by AUCR_ALPHABET_Compile() or
+ *		AUCR_COMPILED_ALPHABET_Open_From_File().
+ *	Postconditions:
+ *		all memory of the compiled alphabet is freed and the AUCR_Compiled_Alphabet_Ptr
+ *		at io_compiled_alphabet_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_COMPILED_ALPHABET_Release(
+	AUCR_Compiled_Alphabet_Ptr * io_compiled_alphabet_ptr_ptr
+);
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Save_To_File()
+ *	Description:
+ *		writes a compiled alphabet to a file that AUCR_COMPILED_ALPHABET_Open_From_File()
+ *		can map and recognize against without parsing it.  the file is a versioned
+ *		header followed by the compiled alphabet's block, every section of it cache
+ *		line aligned, with every value a fixed width little-endian integer, so the
+ *		file is the same whatever host writes it.  the header and the block each
+ *		carry a checksum.
+ *	Parameters:
+ *		i_file_path -> pointer to a string that gives the full path of the file
+ *		i_compiled_alphabet_ptr -> compiled alphabet to write
+ *	Preconditions:
+ *		i_file_path is a valid path to a file that may be written, and
+ *		i_compiled_alphabet_ptr is a valid compiled alphabet
+ *	Postconditions:
+ *		the file holds the compiled alphabet, which is unchanged
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet or the file could not be written
+ *		AUCR_ERR_NO_MEMORY if the file's block could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Save_To_File(
+	const char * i_file_path,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Open_From_File()
+ *	Description:
+ *		opens a compiled alphabet written by AUCR_COMPILED_ALPHABET_Save_To_File().
+ *		on a little-endian host with 32 bit ints and unicode values, which lays out
+ *		a compiled alphabet just as the file does, the file is mapped read-only and
+ *		recognized against in place, so only the pages recognition touches are ever
+ *		read.  any other host, or one without mmap(), reads the block in one go and
+ *		converts it if it must.  the header is always checked, and so are the values
+ *		recognition indexes arrays with; the block's checksum is checked when asked,
+ *		which reads every page of a mapped file, and always when the block is read.
+ *	Parameters:
+ *		i_file_path -> pointer to a string that gives the full path of the file
+ *		i_verify -> nonzero to check the block's checksum even if the file is mapped
+ *		o_compiled_alphabet_ptr_ptr <- address of the AUCR_Compiled_Alphabet_Ptr to be
+ *							populated with the compiled alphabet
+ *	Preconditions:
+ *		i_file_path is a valid path to a file written by
+ *		AUCR_COMPILED_ALPHABET_Save_To_File().  The AUCR_Compiled_Alphabet_Ptr at
+ *		o_compiled_alphabet_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_compiled_alphabet_ptr_ptr points to the compiled alphabet, which is released
+ *		with AUCR_COMPILED_ALPHABET_Release() as any other, and the file itself is
+ *		unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet, or the file is not a compiled
+ *							alphabet file of this version, fails a checksum or
+ *							holds a value out of range
+ *		AUCR_ERR_NO_MEMORY if the structure or block memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if the file was written with other values of
+ *													AUCR_CODE_ROW_ALIGNMENT, AUCR_BLOCK_CODES,
+ *													AUCR_COARSE_SEGMENTS or AUCR_CODE_TABLE_SLOPES
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Open_From_File(
+	const char * i_file_path,
+	int i_verify,
+	AUCR_Compiled_Alphabet_Ptr * o_compiled_alphabet_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character given as an argument and return the
+ *		unicode of this found character.  the result is always the same as
+ *		AUCR_ALPHABET_Recognize_From_Interpolated() gives for the alphabet
+ *		the compiled alphabet was compiled from.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the character in
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at least
+ *		one character, num_directional_codes between the compiled alphabet and the
+ *		character is in agreement
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Raw()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then return the unicode of this found character
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at least
+ *		one character
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_From_Raw(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated()
+ *	Description:
+ *		finds the characters in the compiled alphabet that are closest to the
+ *		interpolated character given as an argument, and returns up to
+ *		i_max_candidates of them, closest first.  the candidates are always the
+ *		same as AUCR_ALPHABET_Recognize_Candidates_From_Interpolated() gives for
+ *		the alphabet the compiled alphabet was compiled from.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the characters in
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
+ *	Postconditions:
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number, the smaller of i_max_candidates
+ *		and the number of characters in the compiled alphabet, is stored at
+ *		o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Raw()
+ *	Description:
+ *		finds the characters in the compiled alphabet that are closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then returns up to i_max_candidates of them, closest first
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates
+ *	Postconditions:
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Raw(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Batch()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to each of
+ *		many strokes of raw data, storing the unicode of each found character.
+ *		the strokes are recognized AUCR_BATCH_QUERIES at a time, and each tile of
+ *		strokes is checked against AUCR_BATCH_ROWS rows of the compiled alphabet at
+ *		a time, so that every block of rows is read from memory once per tile rather
+ *		than once per stroke.  one workspace is used for the whole batch.  each
+ *		result is the same as
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Raw() gives for its stroke.
+ *	Parameters:
+ *			i_num_strokes -> number of strokes supplied
+ *			i_stroke_offsets -> array of (i_num_strokes + 1) offsets into i_coordinates,
+ *							stroke s is made of the coordinates from i_stroke_offsets[s]
+ *							up to but not including i_stroke_offsets[s + 1]
+ *			i_coordinates -> array of the raw coordinates of every stroke
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			o_unicodes <- array of i_num_strokes wchar_t variables to store unicodes in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num_strokes is non negative, i_stroke_offsets is non NULL, starts at zero or
+ *		more and never decreases, i_coordinates is non NULL and holds all of the
+ *		coordinates the offsets refer to, and i_compiled_alphabet_ptr is a valid
+ *		pointer to a compiled alphabet with at least one character
+ *	Postconditions:
+ *		the closest character to each stroke has been found, and its unicode value
+ *		is stored in o_unicodes.  strokes with no coordinates are given 0x0000.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Batch(
+	int i_num_strokes,
+	const int * i_stroke_offsets,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	wchar_t * o_unicodes,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Interpolated()
+ *	Description:
+ *		finds characters in the compiled alphabet that are close to the interpolated
+ *		character given as an argument, first at the coarse resolution and then at
+ *		full resolution.  every row is checked by its coarse codes and activity
+ *		measures, which takes a fraction of the work of checking its directional
+ *		codes, and only the i_shortlist_size closest rows are checked by their
+ *		directional codes to choose up to i_max_candidates of them, closest first.
+ *		the candidates are the closest of the shortlist, so a larger shortlist
+ *		trades speed for agreement with
+ *		AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated(), and a
+ *		shortlist as large as the compiled alphabet gives exactly its candidates.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the characters in
+ *			i_shortlist_size -> most rows to check at full resolution
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		i_shortlist_size is from i_max_candidates to AUCR_COARSE_SHORTLIST,
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
+ *	Postconditions:
+ *		the closest characters of the shortlist have been found and are stored closest
+ *		first in o_candidates, and their number, the smaller of i_max_candidates and
+ *		the number of characters in the compiled alphabet, is stored at
+ *		o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	int i_shortlist_size,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Raw()
+ *	Description:
+ *		finds characters in the compiled alphabet that are close to the interpolated
+ *		character that is created from the raw data that is given, first at the
+ *		coarse resolution and then at full resolution, then returns up to
+ *		i_max_candidates of them, closest first
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			i_shortlist_size -> most rows to check at full resolution
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		i_shortlist_size is from i_max_candidates to AUCR_COARSE_SHORTLIST
+ *	Postconditions:
+ *		the closest characters of the shortlist have been found and are stored closest
+ *		first in o_candidates, and their number is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Raw(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	int i_shortlist_size,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_COMPILED_ALPHABET_Query_From_Interpolated()
+ *	Description:
+ *		finds the features of an interpolated character for a compiled alphabet, the
+ *		same way its recognizers do, and leaves them in the workspace: the directional
+ *		codes and activity measures in its character, and the directional codes packed
+ *		like a row of the compiled alphabet in its row.  this lets recognizers outside
+ *		of this file, such as the fixed geometry ones of AUCRTemplate.h, score the rows
+ *		of a compiled alphabet themselves.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character to find the features of
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find them for
+ *			io_workspace_ptr <-> workspace to leave the features in
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet,
+ *		io_workspace_ptr is a valid workspace sized for the compiled alphabet, and
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
+ *	Postconditions:
+ *		the features of the interpolated character are in the workspace
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *							num_directional_codes, or of the workspace with the compiled
+ *							alphabet, are met
+ */
+AUCR_Error AUCR_COMPILED_ALPHABET_Query_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_WORKSPACE_Init()
+ *	Description:
+ *		Initializes a new AUCR_Workspace sized for an alphabet, so that recognizing
+ *		against the alphabet, or any compiled alphabet compiled from it, needs no
+ *		further memory as long as strokes are no longer than the workspace has room for.
+ *		A workspace may only be used by one recognition at a time.
+ *	Parameters:
+ *		i_alphabet_ptr -> pointer to the alphabet the workspace will be used with
+ *		o_workspace_ptr_ptr <- address of the AUCR_Workspace_Ptr to be populated
+ *							with the new AUCR_Workspace
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid pointer to a valid alphabet.  The AUCR_Workspace_Ptr
+ *		at o_workspace_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_workspace_ptr_ptr points to a newly allocated workspace with room for
+ *		AUCR_WORKSPACE_COORDINATES raw coordinates
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_WORKSPACE_Init(
+	const AUCR_Alphabet * i_alphabet_ptr,
+	AUCR_Workspace_Ptr * o_workspace_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_WORKSPACE_Init_From_Compiled()
+ *	Description:
+ *		Initializes a new AUCR_Workspace sized for a compiled alphabet, exactly as
+ *		AUCR_WORKSPACE_Init() does for the alphabet it was compiled from.
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> pointer to the compiled alphabet the workspace will be used with
+ *		o_workspace_ptr_ptr <- address of the AUCR_Workspace_Ptr to be populated
+ *							with the new AUCR_Workspace
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet.  The
+ *		AUCR_Workspace_Ptr at o_workspace_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_workspace_ptr_ptr points to a newly allocated workspace with room for
+ *		AUCR_WORKSPACE_COORDINATES raw coordinates
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_WORKSPACE_Init_From_Compiled(
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	AUCR_Workspace_Ptr * o_workspace_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_WORKSPACE_Reserve()
+ *	Description:
+ *		makes sure a workspace has room for the distances of a stroke of the given
+ *		number of raw coordinates, at least doubling its room whenever it must grow.
+ *		calling this once with the longest expected stroke keeps every later
+ *		recognition free of memory allocation.
+ *	Parameters:
+ *		i_num_coordinates -> number of raw coordinates to make room for
+ *		io_workspace_ptr <-> pointer to the workspace to grow
+ *	Preconditions:
+ *		i_num_coordinates is positive and io_workspace_ptr is a valid workspace
+ *	Postconditions:
+ *		the workspace has room for at least i_num_coordinates raw coordinates, and
+ *		is unchanged if it could not be grown
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the array memory could not be allocated
+ */
+AUCR_Error AUCR_WORKSPACE_Reserve(
+	int i_num_coordinates,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_WORKSPACE_Release()
+ *	Description:
+ *		Frees all memories of the AUCR_Workspace and the structure itself,
+ *		and NULLs the AUCR_Workspace_Ptr.
+ *	Parameters:
+ *		io_workspace_ptr_ptr <-> address of the AUCR_Workspace to be freed.
+ *	Preconditions:
+ *		The AUCR_Workspace_Ptr at io_workspace_ptr_ptr is NULL or the address of an
+ *		AUCR_Workspace created by AUCR_WORKSPACE_Init() or AUCR_WORKSPACE_Init_From_Compiled().
+ *	Postconditions:
+ *		all memory of the workspace is freed and the AUCR_Workspace_Ptr at
+ *		io_workspace_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_WORKSPACE_Release(
+	AUCR_Workspace_Ptr * io_workspace_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Init()
+ *	Description:
+ *		builds a vantage point tree over the rows of a compiled alphabet, so that the
+ *		closest rows to a character can be found without checking every row.  the
+ *		distance the tree is built on is the square root of the sum of the squared
+ *		circular directional code distances, which is a true metric, so the triangle
+ *		inequality bounds the directional code difference of every row below a node.
+ *		the activity measure differences are never less than zero, so the candidates
+ *		found with the tree are those the linear recognizers find.
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to index
+ *		o_index_ptr_ptr <- address of the AUCR_Index_Ptr to be populated with the new
+ *							AUCR_Index
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet that will
+ *		outlive the index.  The AUCR_Index_Ptr at o_index_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_index_ptr_ptr points to a newly allocated index over the compiled alphabet,
+ *		and the compiled alphabet is unchanged.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet, or if the directional code
+ *							distances of the compiled alphabet are too large to index
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_INDEX_Init(
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	AUCR_Index_Ptr * o_index_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Release()
+ *	Description:
+ *		Frees the nodes of the AUCR_Index and the structure itself, and NULLs the
+ *		AUCR_Index_Ptr.  the compiled alphabet the index was built over is not freed.
+ *	Parameters:
+ *		io_index_ptr_ptr <-> address of the AUCR_Index to be freed.
+ *	Preconditions:
+ *		The AUCR_Index_Ptr at io_index_ptr_ptr is NULL or the address of an
+ *		AUCR_Index created by AUCR_INDEX_Init().
+ *	Postconditions:
+ *		all memory of the index is freed and the AUCR_Index_Ptr at io_index_ptr_ptr
+ *		is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_INDEX_Release(
+	AUCR_Index_Ptr * io_index_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Recognize_From_Interpolated()
+ *	Description:
+ *		finds the character in the indexed compiled alphabet that is closest to the
+ *		interpolated character given as an argument and return the unicode of this
+ *		found character
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_index_ptr -> address of the index to find the character with
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_index_ptr is a valid pointer to an index over a compiled alphabet with at least
+ *		one character, num_directional_codes between the compiled alphabet and the
+ *		character is in agreement
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_INDEX_Recognize_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Index * i_index_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Recognize_From_Raw()
+ *	Description:
+ *		finds the character in the indexed compiled alphabet that is closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then return the unicode of this found character
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_index_ptr -> pointer to index to search with
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_index_ptr is a valid pointer to an index over a compiled alphabet with at
+ *		least one character
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_INDEX_Recognize_From_Raw(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Index * i_index_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Recognize_Candidates_From_Interpolated()
+ *	Description:
+ *		finds the characters in the indexed compiled alphabet that are closest to the
+ *		interpolated character given as an argument, and returns up to
+ *		i_max_candidates of them, closest first.  a node's rows are skipped once the
+ *		bound on their difference is farther than the farthest of the closest
+ *		candidates found so far.  each row's difference is the whole sum of its
+ *		activity measure and directional code differences, ties going to the lowest
+ *		index, so the candidates are exactly the closest rows by that sum.  these are
+ *		the candidates AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated()
+ *		gives.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_index_ptr -> address of the index to find the characters with
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_index_ptr is a valid pointer to a valid index,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates,
+ *		num_directional_codes between the compiled alphabet and the character is in agreement
+ *	Postconditions:
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number, the smaller of i_max_candidates
+ *		and the number of characters in the compiled alphabet, is stored at
+ *		o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_INDEX_Recognize_Candidates_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Index * i_index_ptr,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_INDEX_Recognize_Candidates_From_Raw()
+ *	Description:
+ *		finds the characters in the indexed compiled alphabet that are closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		then returns up to i_max_candidates of them, closest first
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_index_ptr -> pointer to index to search with
+ *			i_max_candidates -> most candidates to return
+ *			o_candidates <- array of i_max_candidates candidates to fill in
+ *			o_num_candidates_ptr <- address of int variable to store the number of
+ *														candidates returned in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_index_ptr is a valid pointer to a valid index,
+ *		i_max_candidates is positive and o_candidates has room for that many candidates
+ *	Postconditions:
+ *		the closest characters in the compiled alphabet have been found and are stored
+ *		closest first in o_candidates, and their number is stored at o_num_candidates_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_INDEX_Recognize_Candidates_From_Raw(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Index * i_index_ptr,
+	int i_max_candidates,
+	AUCR_Candidate * o_candidates,
+	int * o_num_candidates_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PROGRESSIVE_Init()
+ *	Description:
+ *		Initializes a new AUCR_Progressive that recognizes strokes against the given
+ *		alphabet while they are drawn, with a workspace of its own.
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet to recognize against
+ *		i_interval -> number of coordinates a stroke must grow by between
+ *							speculative recognitions
+ *		o_progressive_ptr_ptr <- address of the AUCR_Progressive_Ptr to be populated
+ *							with the new AUCR_Progressive
+ *	Preconditions:
+ *		i_alphabet_ptr is a valid alphabet that will outlive the progressive recognizer,
+ *		i_interval is positive.  The AUCR_Progressive_Ptr at o_progressive_ptr_ptr must
+ *		be NULL.
+ *	Postconditions:
+ *		o_progressive_ptr_ptr points to a newly allocated progressive recognizer with no
+ *		shortlist and zeroed latency.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_PROGRESSIVE_Init(
+	const AUCR_Alphabet * i_alphabet_ptr,
+	int i_interval,
+	AUCR_Progressive_Ptr * o_progressive_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PROGRESSIVE_Release()
+ *	Description:
+ *		Frees all memories of the AUCR_Progressive and the structure itself, and
+ *		NULLs the AUCR_Progressive_Ptr.
+ *	Parameters:
+ *		io_progressive_ptr_ptr <-> address of the AUCR_Progressive to be freed.
+ *	Preconditions:
+ *		The AUCR_Progressive_Ptr at io_progressive_ptr_ptr is NULL or the address of
+ *		an AUCR_Progressive created by AUCR_PROGRESSIVE_Init().
+ *	Postconditions:
+ *		all memory of the progressive recognizer is freed and the AUCR_Progressive_Ptr
+ *		at io_progressive_ptr_ptr is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_PROGRESSIVE_Release(
+	AUCR_Progressive_Ptr * io_progressive_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PROGRESSIVE_Begin()
+ *	Description:
+ *		starts a new stroke, forgetting the shortlist of the last one.
+ *	Parameters:
+ *		io_progressive_ptr <-> pointer to the progressive recognizer
+ *	Preconditions:
+ *		io_progressive_ptr is a valid progressive recognizer
+ *	Postconditions:
+ *		the shortlist is empty
+ *	Returns:
+ *		none
+ */
+void AUCR_PROGRESSIVE_Begin(
+	AUCR_Progressive_Ptr io_progressive_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PROGRESSIVE_Update()
+ *	Description:
+ *		recognizes the stroke drawn so far once it has grown by the interval since it
+ *		was last recognized, to keep a shortlist of the characters closest to it.  the
+ *		first recognition of a stroke, and the first after the stroke has doubled in
+ *		coordinates, shortlists the AUCR_PROGRESSIVE_SHORTLIST closest characters of
+ *		the whole alphabet.  each other recognition ranks only the shortlist against
+ *		the longer stroke and keeps the closer half, down to AUCR_PROGRESSIVE_KEEP
+ *		characters.  a stroke that has not grown by the interval is left alone, so
+ *		this can be called after every coordinate is added.
+ *	Parameters:
+ *		i_stroke_ptr -> the stroke being drawn
+ *		io_progressive_ptr <-> pointer to the progressive recognizer
+ *	Preconditions:
+ *		i_stroke_ptr is a valid stroke, io_progressive_ptr is a valid progressive
+ *		recognizer, and the alphabet has not changed since AUCR_PROGRESSIVE_Begin()
+ *	Postconditions:
+ *		the shortlist holds the characters closest to the stroke so far, and the
+ *		time taken has been added to the latency
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_PROGRESSIVE_Update(
+	const AUCR_Stroke * i_stroke_ptr,
+	AUCR_Progressive_Ptr io_progressive_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PROGRESSIVE_Finalize()
+ *	Description:
+ *		finds the character in the alphabet that is closest to the finished stroke
+ *		and returns its unicode.  the shortlist is ranked against the finished
+ *		stroke, and the closest of it bounds a scan of the alphabet that gives up on
+ *		nearly every other character at its first check, so the character found is
+ *		the one AUCR_ALPHABET_Recognize_From_Stroke() finds.  the time from the call
+ *		to the result is added to the latency.
+ *	Parameters:
+ *		i_stroke_ptr -> the finished stroke
+ *		io_progressive_ptr <-> pointer to the progressive recognizer
+ *		o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *	Preconditions:
+ *		i_stroke_ptr is a valid stroke of at least one coordinate, io_progressive_ptr
+ *		is a valid progressive recognizer whose alphabet has at least one character
+ *		and has not changed since AUCR_PROGRESSIVE_Begin()
+ *	Postconditions:
+ *		the closest character in the alphabet has been found, and its unicode value
+ *		is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_PROGRESSIVE_Finalize(
+	const AUCR_Stroke * i_stroke_ptr,
+	AUCR_Progressive_Ptr io_progressive_ptr,
+	wchar_t * o_unicode_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PUBLISHER_Init()
+ *	Description:
+ *		Initializes a new AUCR_Publisher with nothing published.
+ *	Parameters:
+ *		o_publisher_ptr_ptr <- address of the AUCR_Publisher_Ptr to be populated
+ *							with the new AUCR_Publisher
+ *	Preconditions:
+ *		The AUCR_Publisher_Ptr at o_publisher_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_publisher_ptr_ptr points to a newly allocated publisher whose current
+ *		snapshot is NULL and whose version is zero.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure memory could not be allocated
+ */
+AUCR_Error AUCR_PUBLISHER_Init(
+	AUCR_Publisher_Ptr * o_publisher_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PUBLISHER_Release()
+ *	Description:
+ *		Unpins the current snapshot of the AUCR_Publisher, frees the structure and
+ *		NULLs the AUCR_Publisher_Ptr.  snapshots still pinned by readers stay valid
+ *		until they are unpinned.
+ *	Parameters:
+ *		io_publisher_ptr_ptr <-> address of the AUCR_Publisher to be freed.
+ *	Preconditions:
+ *		The AUCR_Publisher_Ptr at io_publisher_ptr_ptr is NULL or the address of an
+ *		AUCR_Publisher created by AUCR_PUBLISHER_Init(), which nothing is pinning
+ *		from or publishing to.
+ *	Postconditions:
+ *		the publisher is freed and the AUCR_Publisher_Ptr at io_publisher_ptr_ptr
+ *		is NULL.
+ *	Returns:
+ *		none
+ */
+void AUCR_PUBLISHER_Release(
+	AUCR_Publisher_Ptr * io_publisher_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PUBLISHER_Publish()
+ *	Description:
+ *		makes a read-only snapshot of an alphabet and makes it the publisher's
+ *		current snapshot, the one readers pin from then on.  each slot of the
+ *		alphabet keeps the copy of its character it was last published with, and
+ *		adding, changing or removing a character leaves its slot without one, so
+ *		each character that has not changed since it was last published is shared
+ *		rather than copied, wherever its index has moved to.  the snapshot before is
+ *		unpinned once every reader that pinned before the publish has taken its
+ *		reference, and is freed when its last reader unpins it.  readers that pin
+ *		meanwhile are not waited for, as they get the new snapshot; the wait spins
+ *		briefly and then yields the processor.
+ *	Parameters:
+ *		io_alphabet_ptr <-> alphabet to publish a snapshot of, whose slots keep the
+ *							copies published
+ *		io_publisher_ptr <-> publisher to make it current in
+ *	Preconditions:
+ *		io_alphabet_ptr is a valid alphabet, whose characters have been changed only
+ *		through the AUCR_ALPHABET functions, that nothing changes or publishes
+ *		during the call, and io_publisher_ptr is a valid publisher that nothing
+ *		else publishes to during the call
+ *	Postconditions:
+ *		the current snapshot of the publisher is a copy of the alphabet, with the
+ *		next version, or the publisher is unchanged if memory could not be allocated.
+ *		each slot of the alphabet holds a reference to its published copy until the
+ *		character is removed or the alphabet released.
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the snapshot or its characters could not be allocated
+ */
+AUCR_Error AUCR_PUBLISHER_Publish(
+	AUCR_Alphabet_Ptr io_alphabet_ptr,
+	AUCR_Publisher_Ptr io_publisher_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_PUBLISHER_Pin()
+ *	Description:
+ *		takes a reference to the current snapshot of a publisher, without a lock, so
+ *		that it stays as it is until it is unpinned however many times the
+ *		publisher publishes meanwhile.  any number of threads may pin at once, and
+ *		while one thread publishes.
+ *	Parameters:
+ *		io_publisher_ptr <-> publisher to pin the current snapshot of
+ *		o_snapshot_ptr_ptr <- address of the AUCR_Snapshot_Ptr to store the
+ *							snapshot in
+ *	Preconditions:
+ *		io_publisher_ptr is a valid publisher.  The AUCR_Snapshot_Ptr at
+ *		o_snapshot_ptr_ptr must be NULL.
+ *	Postconditions:
+ *		o_snapshot_ptr_ptr points to the current snapshot, which must be unpinned
+ *		with AUCR_SNAPSHOT_Unpin(), or to NULL if nothing has been published
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ */
+AUCR_Error AUCR_PUBLISHER_Pin(
+	AUCR_Publisher_Ptr io_publisher_ptr,
+	AUCR_Snapshot_Ptr * o_snapshot_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_SNAPSHOT_Unpin()
+ *	Description:
+ *		gives up a reference to a snapshot, freeing it if it was the last, along with
+ *		each of its characters no other snapshot shares, and NULLs the
+ *		AUCR_Snapshot_Ptr.
+ *	Parameters:
+ *		io_snapshot_ptr_ptr <-> address of the AUCR_Snapshot_Ptr to unpin
+ *	Preconditions:
+ *		The AUCR_Snapshot_Ptr at io_snapshot_ptr_ptr is NULL or a snapshot pinned
+ *		by AUCR_PUBLISHER_Pin() and not yet unpinned.
+ *	Postconditions:
+ *		the AUCR_Snapshot_Ptr at io_snapshot_ptr_ptr is NULL
+ *	Returns:
+ *		none
+ */
+void AUCR_SNAPSHOT_Unpin(
+	AUCR_Snapshot_Ptr * io_snapshot_ptr_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_Rounding_Divide()
+ *	Description:
+ *		performs division on two integers, but instead of truncating
+ *		the remainder, rounds up or down to the nearest integer
+ *	Parameters:
+ *		i_dividend -> the integer to be divided
+ *		i_divisor -> the integer to divide by
+ *	Preconditions:
+ *		i_dividend and i_divisor are valid integers
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		integer result of the rounded divide
+ */
+int AUCR_Rounding_Divide(
+	int i_dividend,
+	int i_divisor
+);
+
+
+/*
+ *	Name:
+ *		AUCR_Integer_Square_Root()
+ *	Description:
+ *		function that takes an integer argument, multiplies it
+ *		by (AUCR_SCALE)^2, then finds the square root of this number
+ *		rounded to the nearest integer, using only integer operations.
+ *		the root is found one bit at a time from the highest, with a
+ *		fixed number of shifts, adds and compares and no divisions, so
+ *		every int takes the same time and gets the exact answer
+ *	Parameters:
+ *		i_number -> the number to scale and take the square root of
+ *	Preconditions:
+ *		i_number is a valid (nonnegative), unscaled integer
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		integer result of the square root of the scaled input if
+ *		no error, -1 on error
+ */
+int AUCR_Integer_Square_Root( 
+	int i_number
+);
+
+
+/*
+ *	Name:
+ *		AUCR_Un_Scaled_Integer_Square_Root()
+ *	Description:
+ *		function that takes an integer argument, the finds the
+ *		square root of this number rounded to the nearest integer,
+ *		using only integer operations, one bit of the root at a time
+ *	Parameters:
+ *		i_number -> the number to scale and take the square root of
+ *	Preconditions:
+ *		i_number is a valid (nonnegative), unscaled integer
  *	Postconditions:
  *		nothing has changed
  *	Returns:
@@ -753,4 +2665,8 @@ int AUCR_Un_Scaled_Integer_Square_Root(
 );
 
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // AUCR_H
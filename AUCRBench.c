@@ -0,0 +1,610 @@
+//AUCRBench.c
+
+/*
+ *	measures how recognition throughput scales with threads that all recognize
+ *	against one shared alphabet and compiled alphabet, each with its own
+ *	workspace, as AUCR.h allows.  the compiled alphabet is recognized both by
+ *	the generic recognizer and by the fixed geometry one of AUCRTemplate.h.
+ *	it also draws every query through the progressive recognizer, as recogArea
+ *	does, and prints the latency it counted, and times AUCR_Integer_Square_Root()
+ *	against the floating point root it stands in for, over the squared lengths
+ *	of pen strokes.  every thread checks that it gets the unicodes a
+ *	single thread got.  run by "make bench", which builds it for the host; it
+ *	takes the most threads to run as its argument, defaulting to the number of
+ *	processors online, and exits non-zero if any thread got a different unicode.
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "AUCR.h"
+#include "AUCRTemplate.h"
+
+/* ==============================================
+	MACRO / CONSTANT DEFINITIONS
+   ============================================== */
+
+/* the geometry of the alphabets aucrEdit::newAlphabet creates */
+#define AUCR_BENCH_DIRECTIONAL_CODES AUCR_FIXED_DIRECTIONAL_CODES
+#define AUCR_BENCH_ACTIVITY_REGIONS AUCR_FIXED_ACTIVITY_REGIONS
+#define AUCR_BENCH_MAPPABLE_DIRECTIONAL_CODES AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES
+
+/* the recognizers measured */
+#define AUCR_BENCH_ALPHABET 0
+#define AUCR_BENCH_COMPILED 1
+#define AUCR_BENCH_FIXED 2
+#define AUCR_BENCH_RECOGNIZERS 3
+
+/* characters in the shared alphabet, distinct queries, and how many times
+	every thread recognizes each query */
+#define AUCR_BENCH_CHARACTERS 200
+#define AUCR_BENCH_QUERIES 100
+#define AUCR_BENCH_ROUNDS 20
+
+/* most raw coordinates in a random stroke, and the size of the square they are in */
+#define AUCR_BENCH_COORDINATES 40
+#define AUCR_BENCH_EXTENT 200
+
+/* most threads run, whatever is asked for */
+#define AUCR_BENCH_MAX_THREADS 64
+
+/* squared lengths whose roots are timed, how many times each is rooted, and
+	the largest change in x or y of the vectors they are the lengths of */
+#define AUCR_BENCH_ROOTS 4096
+#define AUCR_BENCH_ROOT_ROUNDS 1000
+#define AUCR_BENCH_PEN_EXTENT 1024
+
+
+/* ==============================================
+	TYPE DEFINITIONS
+   ============================================== */
+
+/* the shared alphabets and queries every thread recognizes, and the unicodes
+	a single thread got for them */
+typedef struct _AUCR_Bench_Shared
+{
+	const AUCR_Alphabet * alphabet_ptr;
+	const AUCR_Compiled_Alphabet * compiled_alphabet_ptr;
+	/* one of AUCR_BENCH_ALPHABET, AUCR_BENCH_COMPILED and AUCR_BENCH_FIXED */
+	int recognizer;
+	int num_coordinates[AUCR_BENCH_QUERIES];
+	AUCR_Coordinate coordinates[AUCR_BENCH_QUERIES][AUCR_BENCH_COORDINATES];
+	wchar_t expected[AUCR_BENCH_QUERIES];
+} AUCR_Bench_Shared;
+	
+/* what one thread is given, and what it reports */
+typedef struct _AUCR_Bench_Thread
+{
+	pthread_t thread;
+	const AUCR_Bench_Shared * shared_ptr;
+	/* number of recognitions that failed or gave a unicode other than expected */
+	int mismatches;
+} AUCR_Bench_Thread;
+	
+/* ==============================================
+	STATIC FUNCTION DEFINITIONS
+   ============================================== */
+	
+/*
+ *	Name:
+ *		AUCR_Bench_Random()
+ *	Description:
+ *		steps a linear congruential generator, so that every run recognizes the
+ *		same strokes on every host
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		i_range -> number of values to pick from
+ *	Preconditions:
+ *		i_range is positive
+ *	Postconditions:
+ *		the state has stepped
+ *	Returns:
+ *		a value from 0 up to but not including i_range
+ */
+static int AUCR_Bench_Random( unsigned long * io_state_ptr, int i_range )
+{
+	( *io_state_ptr ) = ( ( ( *io_state_ptr ) * 1103515245UL ) + 12345UL ) & 0xFFFFFFFFUL;
+	
+	return( (int)( ( ( *io_state_ptr ) >> 8 ) % (unsigned long)i_range ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Stroke()
+ *	Description:
+ *		makes a stroke of random raw coordinates
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		o_coordinates <- array of AUCR_BENCH_COORDINATES coordinates to fill in
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the stroke's coordinates are filled in
+ *	Returns:
+ *		the number of coordinates in the stroke
+ */
+static int AUCR_Bench_Stroke( unsigned long * io_state_ptr, AUCR_Coordinate * o_coordinates )
+{
+	//local variables
+	int i, num_coordinates;
+	
+	num_coordinates = 2 + AUCR_Bench_Random( io_state_ptr, AUCR_BENCH_COORDINATES - 1 );
+	for( i = 0; i < num_coordinates; i++ )
+	{
+		o_coordinates[i].x = AUCR_Bench_Random( io_state_ptr, AUCR_BENCH_EXTENT );
+		o_coordinates[i].y = AUCR_Bench_Random( io_state_ptr, AUCR_BENCH_EXTENT );
+	}
+	
+	return( num_coordinates );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Alphabet()
+ *	Description:
+ *		makes an alphabet in the geometry aucrEdit::newAlphabet creates, of
+ *		random strokes spread over the lower case letters
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		o_alphabet_ptr_ptr <- address of the AUCR_Alphabet_Ptr to be populated
+ *	Preconditions:
+ *		the AUCR_Alphabet_Ptr at o_alphabet_ptr_ptr is NULL
+ *	Postconditions:
+ *		o_alphabet_ptr_ptr points to the new alphabet
+ *	Returns:
+ *		AUCR_ERR_SUCCESS, or the error that stopped the alphabet being made
+ */
+static AUCR_Error AUCR_Bench_Alphabet(
+									  unsigned long * io_state_ptr,
+									  AUCR_Alphabet_Ptr * o_alphabet_ptr_ptr )
+{
+	//local variables
+	static const int x[AUCR_BENCH_MAPPABLE_DIRECTIONAL_CODES] =
+	{ 490, 490, 415, 278, 98, -98, -278, -415, -490, -490, -415, -278, -98, 98, 278, 415 };
+	static const int y[AUCR_BENCH_MAPPABLE_DIRECTIONAL_CODES] =
+	{ -98, 98, 278, 415, 490, 490, 415, 278, 98, -98, -278, -415, -490, -490, -415, -278 };
+	static const int start[AUCR_BENCH_ACTIVITY_REGIONS] = { 0, 0, 32, 0, 16, 32, 48 };
+	static const int stop[AUCR_BENCH_ACTIVITY_REGIONS] = { 63, 31, 63, 15, 31, 47, 63 };
+	AUCR_Directional_Code_Map_Ptr tempmap = NULL;
+	AUCR_Coordinate coordinates[AUCR_BENCH_COORDINATES];
+	AUCR_Error temperror;
+	int i, num_coordinates;
+	
+	temperror = AUCR_DIRECTIONAL_CODE_MAP_Init( AUCR_BENCH_MAPPABLE_DIRECTIONAL_CODES, &tempmap );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	for( i = 0; i < AUCR_BENCH_MAPPABLE_DIRECTIONAL_CODES; i++ )
+	{
+		tempmap->x[i] = x[i];
+		tempmap->y[i] = y[i];
+	}
+	temperror = AUCR_ALPHABET_Init( tempmap, AUCR_BENCH_ACTIVITY_REGIONS,
+								   AUCR_BENCH_DIRECTIONAL_CODES, o_alphabet_ptr_ptr );
+	AUCR_DIRECTIONAL_CODE_MAP_Release( &tempmap );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	for( i = 0; i < AUCR_BENCH_ACTIVITY_REGIONS; i++ )
+	{
+		( *o_alphabet_ptr_ptr )->activity_regions[i].start = start[i];
+		( *o_alphabet_ptr_ptr )->activity_regions[i].stop = stop[i];
+	}
+	
+	for( i = 0; i < AUCR_BENCH_CHARACTERS; i++ )
+	{
+		num_coordinates = AUCR_Bench_Stroke( io_state_ptr, coordinates );
+		temperror = AUCR_ALPHABET_Add_Raw( (wchar_t)( 'a' + AUCR_Bench_Random( io_state_ptr, 26 ) ),
+										  num_coordinates, coordinates, ( *o_alphabet_ptr_ptr ) );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			return( temperror );
+		}
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Recognize()
+ *	Description:
+ *		recognizes one query of the shared queries with the recognizer the shared
+ *		data asks for
+ *	Parameters:
+ *		i_shared_ptr -> the shared alphabets and queries
+ *		i_query -> number of the query to recognize
+ *		o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *		io_workspace_ptr <-> this thread's workspace
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the unicode recognized is stored at o_unicode_ptr
+ *	Returns:
+ *		the error the recognizer returned
+ */
+static AUCR_Error AUCR_Bench_Recognize(
+									   const AUCR_Bench_Shared * i_shared_ptr,
+									   int i_query,
+									   wchar_t * o_unicode_ptr,
+									   AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	if( i_shared_ptr->recognizer == AUCR_BENCH_COMPILED )
+	{
+		return( AUCR_COMPILED_ALPHABET_Recognize_From_Raw( i_shared_ptr->num_coordinates[i_query],
+														  i_shared_ptr->coordinates[i_query],
+														  i_shared_ptr->compiled_alphabet_ptr,
+														  o_unicode_ptr, io_workspace_ptr ) );
+	}
+	if( i_shared_ptr->recognizer == AUCR_BENCH_FIXED )
+	{
+		return( AUCR_FIXED_Recognize_From_Raw( i_shared_ptr->num_coordinates[i_query],
+											  i_shared_ptr->coordinates[i_query],
+											  i_shared_ptr->compiled_alphabet_ptr,
+											  o_unicode_ptr, io_workspace_ptr ) );
+	}
+	
+	return( AUCR_ALPHABET_Recognize_From_Raw( i_shared_ptr->num_coordinates[i_query],
+											 i_shared_ptr->coordinates[i_query],
+											 i_shared_ptr->alphabet_ptr,
+											 o_unicode_ptr, io_workspace_ptr ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Run()
+ *	Description:
+ *		the body of each thread: recognizes every shared query
+ *		AUCR_BENCH_ROUNDS times with a workspace of its own, counting the
+ *		unicodes that are not the ones a single thread got
+ *	Parameters:
+ *		io_thread_ptr <-> address of the thread's AUCR_Bench_Thread
+ *	Preconditions:
+ *		the thread's shared data is filled in
+ *	Postconditions:
+ *		the thread's mismatches are counted
+ *	Returns:
+ *		NULL
+ */
+static void * AUCR_Bench_Run( void * io_thread_ptr )
+{
+	//local variables
+	AUCR_Bench_Thread * tempthread = (AUCR_Bench_Thread *)io_thread_ptr;
+	const AUCR_Bench_Shared * tempshared = tempthread->shared_ptr;
+	AUCR_Workspace_Ptr tempworkspace = NULL;
+	wchar_t unicode;
+	int r, q;
+	
+	tempthread->mismatches = 0;
+	if( AUCR_WORKSPACE_Init( tempshared->alphabet_ptr, &tempworkspace ) != AUCR_ERR_SUCCESS ||
+	   AUCR_WORKSPACE_Reserve( AUCR_BENCH_COORDINATES, tempworkspace ) != AUCR_ERR_SUCCESS )
+	{
+		tempthread->mismatches = AUCR_BENCH_ROUNDS * AUCR_BENCH_QUERIES;
+	}
+	else
+	{
+		for( r = 0; r < AUCR_BENCH_ROUNDS; r++ )
+		{
+			for( q = 0; q < AUCR_BENCH_QUERIES; q++ )
+			{
+				if( AUCR_Bench_Recognize( tempshared, q, &unicode, tempworkspace ) != AUCR_ERR_SUCCESS ||
+				   unicode != tempshared->expected[q] )
+				{
+					tempthread->mismatches++;
+				}
+			}
+		}
+	}
+	
+	if( tempworkspace != NULL )
+	{
+		AUCR_WORKSPACE_Release( &tempworkspace );
+	}
+	
+	return( NULL );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Seconds()
+ *	Description:
+ *		reads a clock that only moves forward
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the clock's time in seconds
+ */
+static double AUCR_Bench_Seconds( void )
+{
+	//local variables
+	struct timespec now;
+	
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	
+	return( (double)now.tv_sec + ( (double)now.tv_nsec / 1e9 ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Threads()
+ *	Description:
+ *		runs a number of threads against the shared data at once and times them
+ *	Parameters:
+ *		i_shared_ptr -> the shared alphabets and queries
+ *		i_num_threads -> number of threads to run, no more than AUCR_BENCH_MAX_THREADS
+ *		o_seconds_ptr <- address to store the seconds the threads took in
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		every thread has finished
+ *	Returns:
+ *		the number of recognitions that did not give the expected unicode, or
+ *		-1 if a thread could not be started
+ */
+static int AUCR_Bench_Threads(
+							  const AUCR_Bench_Shared * i_shared_ptr,
+							  int i_num_threads,
+							  double * o_seconds_ptr )
+{
+	//local variables
+	AUCR_Bench_Thread threads[AUCR_BENCH_MAX_THREADS];
+	double start;
+	int i, started, mismatches = 0;
+	
+	start = AUCR_Bench_Seconds();
+	for( started = 0; started < i_num_threads; started++ )
+	{
+		threads[started].shared_ptr = i_shared_ptr;
+		if( pthread_create( &( threads[started].thread ), NULL, AUCR_Bench_Run, &( threads[started] ) ) != 0 )
+		{
+			mismatches = -1;
+			break;
+		}
+	}
+	for( i = 0; i < started; i++ )
+	{
+		pthread_join( threads[i].thread, NULL );
+		if( mismatches >= 0 )
+		{
+			mismatches += threads[i].mismatches;
+		}
+	}
+	( *o_seconds_ptr ) = AUCR_Bench_Seconds() - start;
+	
+	return( mismatches );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Progressive()
+ *	Description:
+ *		draws every shared query AUCR_BENCH_ROUNDS times, a coordinate at a
+ *		time, through a progressive recognizer of the shared alphabet, as
+ *		recogArea does, and prints the latency it counted.  every stroke is
+ *		checked to get the unicode AUCR_ALPHABET_Recognize_From_Stroke() gets.
+ *	Parameters:
+ *		i_shared_ptr -> the shared alphabets and queries
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the latency has been printed
+ *	Returns:
+ *		the number of strokes that failed or gave another unicode
+ */
+static int AUCR_Bench_Progressive( const AUCR_Bench_Shared * i_shared_ptr )
+{
+	//local variables
+	AUCR_Progressive_Ptr tempprogressive = NULL;
+	AUCR_Stroke_Ptr tempstroke = NULL;
+	const AUCR_Latency * templatency;
+	wchar_t unicode, expected;
+	int r, q, i, mismatches = 0;
+	
+	if( AUCR_PROGRESSIVE_Init( i_shared_ptr->alphabet_ptr, AUCR_PROGRESSIVE_INTERVAL,
+							  &tempprogressive ) != AUCR_ERR_SUCCESS ||
+	   AUCR_STROKE_Init( &tempstroke ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "progressive: could not set up\n" );
+		AUCR_PROGRESSIVE_Release( &tempprogressive );
+		return( 1 );
+	}
+	
+	for( r = 0; r < AUCR_BENCH_ROUNDS; r++ )
+	{
+		for( q = 0; q < AUCR_BENCH_QUERIES; q++ )
+		{
+			AUCR_STROKE_Clear( tempstroke );
+			AUCR_PROGRESSIVE_Begin( tempprogressive );
+			for( i = 0; i < i_shared_ptr->num_coordinates[q]; i++ )
+			{
+				AUCR_STROKE_Add_Coordinate( i_shared_ptr->coordinates[q][i].x,
+										   i_shared_ptr->coordinates[q][i].y, tempstroke );
+				AUCR_PROGRESSIVE_Update( tempstroke, tempprogressive );
+			}
+			if( AUCR_PROGRESSIVE_Finalize( tempstroke, tempprogressive, &unicode ) != AUCR_ERR_SUCCESS ||
+			   AUCR_ALPHABET_Recognize_From_Stroke( tempstroke, i_shared_ptr->alphabet_ptr,
+												   &expected, NULL ) != AUCR_ERR_SUCCESS ||
+			   unicode != expected )
+			{
+				mismatches++;
+			}
+		}
+	}
+	
+	templatency = &( tempprogressive->latency );
+	printf( "progressive, %d characters, %lu strokes:\n", AUCR_BENCH_CHARACTERS, templatency->strokes );
+	printf( "  while drawing: %5.2f speculations, %7.1f us per stroke\n",
+		   (double)templatency->speculations / templatency->strokes,
+		   (double)templatency->speculation_microseconds / templatency->strokes );
+	printf( "  pen up to result: %7.1f us mean, %lu us most, %d%% from the shortlist",
+		   (double)templatency->finalize_microseconds / templatency->strokes,
+		   templatency->finalize_max_microseconds,
+		   (int)( ( 100 * templatency->shortlist_hits ) / templatency->strokes ) );
+	if( mismatches != 0 )
+	{
+		printf( ", %d wrong", mismatches );
+	}
+	printf( "\n" );
+	
+	AUCR_STROKE_Release( &tempstroke );
+	AUCR_PROGRESSIVE_Release( &tempprogressive );
+	
+	return( mismatches );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Bench_Square_Root()
+ *	Description:
+ *		times AUCR_Integer_Square_Root() and the floating point root it stands
+ *		in for, rounded the same way, over random squared lengths of vectors of
+ *		up to AUCR_BENCH_PEN_EXTENT in x and y, and prints the time per root
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the times have been printed
+ *	Returns:
+ *		zero if both roots summed to the same, one otherwise
+ */
+static int AUCR_Bench_Square_Root( unsigned long * io_state_ptr )
+{
+	//local variables
+	static int squares[AUCR_BENCH_ROOTS];
+	double start, integer, floating;
+	long long int integersum = 0, floatingsum = 0;
+	int i, r, dx, dy;
+	
+	for( i = 0; i < AUCR_BENCH_ROOTS; i++ )
+	{
+		dx = AUCR_Bench_Random( io_state_ptr, 2 * AUCR_BENCH_PEN_EXTENT + 1 ) - AUCR_BENCH_PEN_EXTENT;
+		dy = AUCR_Bench_Random( io_state_ptr, 2 * AUCR_BENCH_PEN_EXTENT + 1 ) - AUCR_BENCH_PEN_EXTENT;
+		squares[i] = ( dx * dx ) + ( dy * dy );
+	}
+	
+	start = AUCR_Bench_Seconds();
+	for( r = 0; r < AUCR_BENCH_ROOT_ROUNDS; r++ )
+	{
+		for( i = 0; i < AUCR_BENCH_ROOTS; i++ )
+		{
+			integersum += AUCR_Integer_Square_Root( squares[i] );
+		}
+	}
+	integer = AUCR_Bench_Seconds() - start;
+	
+	start = AUCR_Bench_Seconds();
+	for( r = 0; r < AUCR_BENCH_ROOT_ROUNDS; r++ )
+	{
+		for( i = 0; i < AUCR_BENCH_ROOTS; i++ )
+		{
+			floatingsum += (long long int)floor( sqrt( (double)squares[i] * AUCR_SCALE * AUCR_SCALE ) + 0.5 );
+		}
+	}
+	floating = AUCR_Bench_Seconds() - start;
+	
+	printf( "square roots of pen squared lengths:\n" );
+	printf( "  integer: %6.1f ns/root\n", ( integer * 1e9 ) / ( (double)AUCR_BENCH_ROOT_ROUNDS * AUCR_BENCH_ROOTS ) );
+	printf( "  double:  %6.1f ns/root", ( floating * 1e9 ) / ( (double)AUCR_BENCH_ROOT_ROUNDS * AUCR_BENCH_ROOTS ) );
+	if( integersum != floatingsum )
+	{
+		printf( ", roots differ\n" );
+		return( 1 );
+	}
+	printf( "\n" );
+	
+	return( 0 );
+}
+
+
+/* ==============================================
+	FUNCTION DEFINITIONS
+   ============================================== */
+
+int main( int argc, char * argv[] )
+{
+	//local variables
+	static AUCR_Bench_Shared shared;
+	static const char * names[AUCR_BENCH_RECOGNIZERS] = { "alphabet", "compiled", "fixed" };
+	unsigned long state = 1;
+	AUCR_Alphabet_Ptr tempalphabet = NULL;
+	AUCR_Compiled_Alphabet_Ptr tempcompiled = NULL;
+	double seconds, single = 0.0;
+	int max_threads, t, q, mismatches, failures = 0;
+	
+	max_threads = ( argc > 1 ) ? atoi( argv[1] ) : (int)sysconf( _SC_NPROCESSORS_ONLN );
+	max_threads = ( max_threads < 1 ) ? 1 : max_threads;
+	max_threads = ( max_threads > AUCR_BENCH_MAX_THREADS ) ? AUCR_BENCH_MAX_THREADS : max_threads;
+	
+	if( AUCR_Bench_Alphabet( &state, &tempalphabet ) != AUCR_ERR_SUCCESS ||
+	   AUCR_ALPHABET_Compile( tempalphabet, &tempcompiled ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "could not set up\n" );
+		if( tempalphabet != NULL )
+		{
+			AUCR_ALPHABET_Release( &tempalphabet );
+		}
+		return( 1 );
+	}
+	shared.alphabet_ptr = tempalphabet;
+	shared.compiled_alphabet_ptr = tempcompiled;
+	for( q = 0; q < AUCR_BENCH_QUERIES; q++ )
+	{
+		shared.num_coordinates[q] = AUCR_Bench_Stroke( &state, shared.coordinates[q] );
+	}
+	
+	for( shared.recognizer = 0; shared.recognizer < AUCR_BENCH_RECOGNIZERS; shared.recognizer++ )
+	{
+		//find the unicodes every thread should get on this thread alone
+		for( q = 0; q < AUCR_BENCH_QUERIES; q++ )
+		{
+			AUCR_Bench_Recognize( &shared, q, &( shared.expected[q] ), NULL );
+		}
+	
+		printf( "%s, %d characters:\n", names[shared.recognizer], AUCR_BENCH_CHARACTERS );
+		for( t = 1; t <= max_threads; t++ )
+		{
+			mismatches = AUCR_Bench_Threads( &shared, t, &seconds );
+			if( t == 1 )
+			{
+				single = seconds;
+			}
+			printf( "  %2d threads: %10.0f recognitions/s, %5.2fx one thread",
+				   t, ( (double)t * AUCR_BENCH_ROUNDS * AUCR_BENCH_QUERIES ) / seconds,
+				   ( (double)t * single ) / seconds );
+			if( mismatches != 0 )
+			{
+				printf( ", %d wrong", mismatches );
+				failures++;
+			}
+			printf( "\n" );
+		}
+	}
+	
+	if( AUCR_Bench_Progressive( &shared ) != 0 )
+	{
+		failures++;
+	}
+	
+	AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+	AUCR_ALPHABET_Release( &tempalphabet );
+	
+	failures += AUCR_Bench_Square_Root( &state );
+	
+	return( ( failures == 0 ) ? 0 : 1 );
+}
@@ -0,0 +1,1338 @@
+//AUCRCheck.c
+
+/*
+ *	checks that the fast recognizers agree with a plain, full sort of every
+ *	character's difference, over alphabets and queries made from random strokes
+ *	in the geometry aucrEdit::newAlphabet creates, and that the directional code
+ *	table gives the codes of the search it stands in for, that compiled
+ *	alphabet files with values out of range are refused, that the integer
+ *	square roots are those of floating point, and that the divisions by
+ *	reciprocals and by AUCR_SCALE round as AUCR_Rounding_Divide() does.  run by
+ *	"make check", which builds it for the host; it prints each check and exits
+ *	non-zero if any fail.  it includes AUCR.c itself rather than linking it, so
+ *	that the static helpers there can be checked too.
+ */
+
+#include "AUCR.c"
+#include <math.h>
+#include <stddef.h>
+
+/* ==============================================
+	MACRO / CONSTANT DEFINITIONS
+   ============================================== */
+
+/* the geometry of the alphabets aucrEdit::newAlphabet creates */
+#define AUCR_CHECK_DIRECTIONAL_CODES 64
+#define AUCR_CHECK_ACTIVITY_REGIONS 7
+#define AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES 16
+
+/* most characters in an alphabet checked, and queries checked against it */
+#define AUCR_CHECK_CHARACTERS 200
+#define AUCR_CHECK_QUERIES 300
+
+/* most raw coordinates in a random stroke, and the size of the square they are in */
+#define AUCR_CHECK_COORDINATES 40
+#define AUCR_CHECK_EXTENT 200
+
+/* largest change in x or y of the segments whose directional codes are checked,
+	enough to cross every slope step of the code table */
+#define AUCR_CHECK_SEGMENT_EXTENT ( 2 * AUCR_CODE_TABLE_SLOPES )
+
+/* the compiled alphabet file the file checks write, and remove */
+#define AUCR_CHECK_FILE "AUCRCheck.cal"
+
+/* largest change in x or y of the vectors whose lengths recognition takes the
+	square root of: the sums of two directional code map vectors, and the
+	segments of strokes on the screen, are all within it */
+#define AUCR_CHECK_PEN_EXTENT 1024
+
+/* most bits of the divisors checked, so that AUCR_Rounding_Divide(), whose
+	remainder is multiplied by AUCR_SCALE in an unsigned long, is exact even
+	where a long is 32 bits, and random divisors and dividends checked */
+#define AUCR_CHECK_DIVISOR_BITS 22
+#define AUCR_CHECK_DIVISORS 2000
+#define AUCR_CHECK_DIVIDENDS 200
+
+/* characters published, and those removed and added before publishing again */
+#define AUCR_CHECK_PUBLISHED 40
+#define AUCR_CHECK_REPUBLISHED 3
+
+
+/* ==============================================
+	TYPE DEFINITIONS
+   ============================================== */
+
+/* the random alphabet a check runs against, and its latest query */
+typedef struct _AUCR_Check_Fixture
+{
+	/* state of the generator the strokes are made with */
+	unsigned long state;
+	AUCR_Alphabet_Ptr alphabet_ptr;
+	AUCR_Compiled_Alphabet_Ptr compiled_alphabet_ptr;
+	/* the latest query, and its character in the alphabet */
+	AUCR_Interpolated_Character_Ptr interpolated_character_ptr;
+	AUCR_Character_Ptr character_ptr;
+	/* every character of the alphabet scored against the query, closest first */
+	AUCR_Candidate sorted[AUCR_CHECK_CHARACTERS];
+} AUCR_Check_Fixture;
+	
+/* ==============================================
+	STATIC FUNCTION DEFINITIONS
+   ============================================== */
+	
+/*
+ *	Name:
+ *		AUCR_Check_Random()
+ *	Description:
+ *		steps a linear congruential generator, so that every run checks the same
+ *		strokes on every host
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		i_range -> number of values to pick from
+ *	Preconditions:
+ *		i_range is positive
+ *	Postconditions:
+ *		the state has stepped
+ *	Returns:
+ *		a value from 0 up to but not including i_range
+ */
+static int AUCR_Check_Random( unsigned long * io_state_ptr, int i_range )
+{
+	( *io_state_ptr ) = ( ( ( *io_state_ptr ) * 1103515245UL ) + 12345UL ) & 0xFFFFFFFFUL;
+	
+	return( (int)( ( ( *io_state_ptr ) >> 8 ) % (unsigned long)i_range ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Stroke()
+ *	Description:
+ *		makes a stroke of random raw coordinates
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		o_coordinates <- array of AUCR_CHECK_COORDINATES coordinates to fill in
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the stroke's coordinates are filled in
+ *	Returns:
+ *		the number of coordinates in the stroke
+ */
+static int AUCR_Check_Stroke( unsigned long * io_state_ptr, AUCR_Coordinate * o_coordinates )
+{
+	//local variables
+	int i, num_coordinates;
+	
+	num_coordinates = 2 + AUCR_Check_Random( io_state_ptr, AUCR_CHECK_COORDINATES - 1 );
+	for( i = 0; i < num_coordinates; i++ )
+	{
+		o_coordinates[i].x = AUCR_Check_Random( io_state_ptr, AUCR_CHECK_EXTENT );
+		o_coordinates[i].y = AUCR_Check_Random( io_state_ptr, AUCR_CHECK_EXTENT );
+	}
+	
+	return( num_coordinates );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Alphabet()
+ *	Description:
+ *		makes an alphabet in the geometry aucrEdit::newAlphabet creates, of
+ *		random strokes spread over a few unicode values
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		i_num_characters -> number of characters to add
+ *		o_alphabet_ptr_ptr <- address of the AUCR_Alphabet_Ptr to be populated
+ *	Preconditions:
+ *		the AUCR_Alphabet_Ptr at o_alphabet_ptr_ptr is NULL
+ *	Postconditions:
+ *		o_alphabet_ptr_ptr points to the new alphabet
+ *	Returns:
+ *		AUCR_ERR_SUCCESS, or the error that stopped the alphabet being made
+ */
+static AUCR_Error AUCR_Check_Alphabet(
+									  unsigned long * io_state_ptr,
+									  int i_num_characters,
+									  AUCR_Alphabet_Ptr * o_alphabet_ptr_ptr )
+{
+	//local variables
+	static const int x[AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES] =
+	{ 490, 490, 415, 278, 98, -98, -278, -415, -490, -490, -415, -278, -98, 98, 278, 415 };
+	static const int y[AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES] =
+	{ -98, 98, 278, 415, 490, 490, 415, 278, 98, -98, -278, -415, -490, -490, -415, -278 };
+	static const int start[AUCR_CHECK_ACTIVITY_REGIONS] = { 0, 0, 32, 0, 16, 32, 48 };
+	static const int stop[AUCR_CHECK_ACTIVITY_REGIONS] = { 63, 31, 63, 15, 31, 47, 63 };
+	AUCR_Directional_Code_Map_Ptr tempmap = NULL;
+	AUCR_Coordinate coordinates[AUCR_CHECK_COORDINATES];
+	AUCR_Error temperror;
+	int i, num_coordinates;
+	
+	temperror = AUCR_DIRECTIONAL_CODE_MAP_Init( AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES, &tempmap );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	for( i = 0; i < AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES; i++ )
+	{
+		tempmap->x[i] = x[i];
+		tempmap->y[i] = y[i];
+	}
+	temperror = AUCR_ALPHABET_Init( tempmap, AUCR_CHECK_ACTIVITY_REGIONS,
+								   AUCR_CHECK_DIRECTIONAL_CODES, o_alphabet_ptr_ptr );
+	AUCR_DIRECTIONAL_CODE_MAP_Release( &tempmap );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	for( i = 0; i < AUCR_CHECK_ACTIVITY_REGIONS; i++ )
+	{
+		( *o_alphabet_ptr_ptr )->activity_regions[i].start = start[i];
+		( *o_alphabet_ptr_ptr )->activity_regions[i].stop = stop[i];
+	}
+	
+	for( i = 0; i < i_num_characters; i++ )
+	{
+		num_coordinates = AUCR_Check_Stroke( io_state_ptr, coordinates );
+		temperror = AUCR_ALPHABET_Add_Raw( (wchar_t)( 'a' + AUCR_Check_Random( io_state_ptr, 26 ) ),
+										  num_coordinates, coordinates, ( *o_alphabet_ptr_ptr ) );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			return( temperror );
+		}
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Difference()
+ *	Description:
+ *		finds the difference between two characters the plain way, with every
+ *		activity measure difference found in 64 bit arithmetic and rounded half up
+ *	Parameters:
+ *		i_alphabet_ptr -> alphabet the characters agree with
+ *		i_character_ptr -> character being recognized
+ *		i_prototype_ptr -> character of the alphabet
+ *	Preconditions:
+ *		both characters agree with the alphabet in size, and its activity measures
+ *		are no more than a few million apart
+ *	Postconditions:
+ *		nothing has changed
+ *	Returns:
+ *		the difference
+ */
+static unsigned long AUCR_Check_Difference(
+										   const AUCR_Alphabet * i_alphabet_ptr,
+										   const AUCR_Character * i_character_ptr,
+										   const AUCR_Character * i_prototype_ptr )
+{
+	//local variables
+	int j, mappable;
+	long long int delta;
+	unsigned long long int difference = 0;
+	
+	for( j = 0; j < i_alphabet_ptr->num_activity_regions; j++ )
+	{
+		delta = (long long int)i_character_ptr->activity_measures[j] - i_prototype_ptr->activity_measures[j];
+		difference += ( ( delta * delta * i_alphabet_ptr->bias[j] ) +
+					   ( ( AUCR_SCALE * AUCR_SCALE ) / 2 ) ) / ( AUCR_SCALE * AUCR_SCALE );
+	}
+	
+	mappable = i_alphabet_ptr->directional_code_map_ptr->mappable_directional_codes;
+	for( j = 0; j < i_alphabet_ptr->num_directional_codes; j++ )
+	{
+		delta = i_character_ptr->directional_codes[j] - i_prototype_ptr->directional_codes[j];
+		delta = ( delta < 0 ) ? -delta : delta;
+		delta = ( delta < mappable - delta ) ? delta : ( mappable - delta );
+		difference += (unsigned long long int)( delta * delta * AUCR_SCALE );
+	}
+	
+	return( (unsigned long)difference );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Sort()
+ *	Description:
+ *		sorts candidates closest first, ties going to the lower index
+ *	Parameters:
+ *		io_candidates <-> array of candidates to sort
+ *		i_num_candidates -> number of candidates
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the candidates are sorted
+ *	Returns:
+ *		none
+ */
+static void AUCR_Check_Sort( AUCR_Candidate * io_candidates, int i_num_candidates )
+{
+	//local variables
+	int i, j;
+	AUCR_Candidate tempcandidate;
+	
+	for( i = 1; i < i_num_candidates; i++ )
+	{
+		tempcandidate = io_candidates[i];
+		for( j = i; j > 0 && ( io_candidates[j - 1].difference > tempcandidate.difference ||
+							  ( io_candidates[j - 1].difference == tempcandidate.difference &&
+							   io_candidates[j - 1].index > tempcandidate.index ) ); j-- )
+		{
+			io_candidates[j] = io_candidates[j - 1];
+		}
+		io_candidates[j] = tempcandidate;
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Same()
+ *	Description:
+ *		checks that a recognizer's candidates are the first of the sorted candidates
+ *	Parameters:
+ *		i_name -> name of the recognizer, to report a mismatch with
+ *		i_query -> number of the query, to report a mismatch with
+ *		i_candidates -> candidates the recognizer gave
+ *		i_num_candidates -> number of candidates it gave
+ *		i_sorted -> every character's candidate, sorted closest first
+ *		i_expected -> number of candidates it should have given
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		a mismatch has been reported
+ *	Returns:
+ *		zero if the candidates are the same, one otherwise
+ */
+static int AUCR_Check_Same(
+						   const char * i_name,
+						   int i_query,
+						   const AUCR_Candidate * i_candidates,
+						   int i_num_candidates,
+						   const AUCR_Candidate * i_sorted,
+						   int i_expected )
+{
+	//local variables
+	int i;
+	
+	if( i_num_candidates != i_expected )
+	{
+		printf( "  %s, query %d: %d candidates, not %d\n", i_name, i_query, i_num_candidates, i_expected );
+		return( 1 );
+	}
+	for( i = 0; i < i_num_candidates; i++ )
+	{
+		if( i_candidates[i].index != i_sorted[i].index ||
+		   i_candidates[i].difference != i_sorted[i].difference ||
+		   i_candidates[i].unicode != i_sorted[i].unicode )
+		{
+			printf( "  %s, query %d, candidate %d: index %d difference %lu, not index %d difference %lu\n",
+				   i_name, i_query, i, i_candidates[i].index, i_candidates[i].difference,
+				   i_sorted[i].index, i_sorted[i].difference );
+			return( 1 );
+		}
+	}
+	
+	return( 0 );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Setup()
+ *	Description:
+ *		makes the random alphabet every check runs against, compiles it, and
+ *		makes the character each query is found in
+ *	Parameters:
+ *		i_num_characters -> number of characters in the alphabet, no more than
+ *							AUCR_CHECK_CHARACTERS
+ *		o_fixture_ptr <- address of the fixture to fill in
+ *	Preconditions:
+ *		o_fixture_ptr is valid
+ *	Postconditions:
+ *		the fixture is filled in, and its generator is ready for the queries
+ *	Returns:
+ *		AUCR_ERR_SUCCESS, or the error that stopped the fixture being made
+ */
+static AUCR_Error AUCR_Check_Setup( int i_num_characters, AUCR_Check_Fixture * o_fixture_ptr )
+{
+	//local variables
+	AUCR_Error temperror;
+	
+	o_fixture_ptr->state = 1;
+	o_fixture_ptr->alphabet_ptr = NULL;
+	o_fixture_ptr->compiled_alphabet_ptr = NULL;
+	o_fixture_ptr->interpolated_character_ptr = NULL;
+	o_fixture_ptr->character_ptr = NULL;
+	
+	temperror = AUCR_Check_Alphabet( &( o_fixture_ptr->state ), i_num_characters,
+									&( o_fixture_ptr->alphabet_ptr ) );
+	if( temperror == AUCR_ERR_SUCCESS )
+	{
+		temperror = AUCR_ALPHABET_Compile( o_fixture_ptr->alphabet_ptr,
+										  &( o_fixture_ptr->compiled_alphabet_ptr ) );
+	}
+	if( temperror == AUCR_ERR_SUCCESS )
+	{
+		temperror = AUCR_INTERPOLATED_CHARACTER_Init( '?', AUCR_CHECK_DIRECTIONAL_CODES,
+													 &( o_fixture_ptr->interpolated_character_ptr ) );
+	}
+	if( temperror == AUCR_ERR_SUCCESS )
+	{
+		temperror = AUCR_CHARACTER_Init( '?', AUCR_CHECK_DIRECTIONAL_CODES, AUCR_CHECK_ACTIVITY_REGIONS,
+										&( o_fixture_ptr->character_ptr ) );
+	}
+	
+	return( temperror );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Teardown()
+ *	Description:
+ *		releases everything a fixture holds
+ *	Parameters:
+ *		io_fixture_ptr <-> address of the fixture to release
+ *	Preconditions:
+ *		the fixture was filled in by AUCR_Check_Setup(), even if it failed
+ *	Postconditions:
+ *		everything the fixture held has been released
+ *	Returns:
+ *		none
+ */
+static void AUCR_Check_Teardown( AUCR_Check_Fixture * io_fixture_ptr )
+{
+	if( io_fixture_ptr->character_ptr != NULL )
+	{
+		AUCR_CHARACTER_Release( &( io_fixture_ptr->character_ptr ) );
+	}
+	if( io_fixture_ptr->interpolated_character_ptr != NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &( io_fixture_ptr->interpolated_character_ptr ) );
+	}
+	AUCR_COMPILED_ALPHABET_Release( &( io_fixture_ptr->compiled_alphabet_ptr ) );
+	if( io_fixture_ptr->alphabet_ptr != NULL )
+	{
+		AUCR_ALPHABET_Release( &( io_fixture_ptr->alphabet_ptr ) );
+	}
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Query()
+ *	Description:
+ *		makes the next random query of a fixture, finds its character, and scores
+ *		every character of the alphabet against it the plain way, sorting them all
+ *	Parameters:
+ *		io_fixture_ptr <-> fixture to make the query for
+ *	Preconditions:
+ *		the fixture was made by AUCR_Check_Setup()
+ *	Postconditions:
+ *		the fixture's interpolated character and character are the query, and
+ *		sorted holds every character of the alphabet, closest first
+ *	Returns:
+ *		none
+ */
+static void AUCR_Check_Query( AUCR_Check_Fixture * io_fixture_ptr )
+{
+	//local variables
+	AUCR_Coordinate coordinates[AUCR_CHECK_COORDINATES];
+	AUCR_Alphabet_Ptr tempalphabet;
+	int i, num_coordinates;
+	
+	tempalphabet = io_fixture_ptr->alphabet_ptr;
+	num_coordinates = AUCR_Check_Stroke( &( io_fixture_ptr->state ), coordinates );
+	AUCR_INTERPOLATED_CHARACTER_From_Raw( num_coordinates, coordinates,
+										 io_fixture_ptr->interpolated_character_ptr, NULL );
+	AUCR_CHARACTER_From_Interpolated( io_fixture_ptr->interpolated_character_ptr, tempalphabet,
+									 io_fixture_ptr->character_ptr, NULL );
+	
+	for( i = 0; i < tempalphabet->num_characters; i++ )
+	{
+		io_fixture_ptr->sorted[i].unicode = tempalphabet->characters_ptr_ptr[i]->unicode;
+		io_fixture_ptr->sorted[i].index = i;
+		io_fixture_ptr->sorted[i].difference = AUCR_Check_Difference( tempalphabet,
+																	 io_fixture_ptr->character_ptr,
+																	 tempalphabet->characters_ptr_ptr[i] );
+	}
+	AUCR_Check_Sort( io_fixture_ptr->sorted, tempalphabet->num_characters );
+	
+	return;
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Candidates()
+ *	Description:
+ *		checks that the classic and compiled candidate recognizers give, for
+ *		random queries, exactly the closest characters of a full sort of every
+ *		character's difference, with those differences
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		every mismatch has been reported
+ *	Returns:
+ *		the number of queries that did not match
+ */
+static int AUCR_Check_Candidates( void )
+{
+	//local variables
+	static const int sizes[] = { 1, 2, 5, 16 };
+	AUCR_Check_Fixture fixture;
+	AUCR_Candidate candidates[16];
+	int q, s, num_candidates, expected, failures = 0;
+	
+	if( AUCR_Check_Setup( AUCR_CHECK_CHARACTERS, &fixture ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  could not set up\n" );
+		AUCR_Check_Teardown( &fixture );
+		return( 1 );
+	}
+	
+	for( q = 0; q < AUCR_CHECK_QUERIES; q++ )
+	{
+		AUCR_Check_Query( &fixture );
+		
+		for( s = 0; s < (int)( sizeof( sizes ) / sizeof( sizes[0] ) ); s++ )
+		{
+			expected = ( sizes[s] < AUCR_CHECK_CHARACTERS ) ? sizes[s] : AUCR_CHECK_CHARACTERS;
+			
+			AUCR_ALPHABET_Recognize_Candidates_From_Interpolated( fixture.interpolated_character_ptr,
+																 fixture.alphabet_ptr, sizes[s],
+																 candidates, &num_candidates, NULL );
+			if( AUCR_Check_Same( "alphabet", q, candidates, num_candidates, fixture.sorted, expected ) )
+			{
+				failures++;
+				break;
+			}
+			
+			AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated( fixture.interpolated_character_ptr,
+																		  fixture.compiled_alphabet_ptr,
+																		  sizes[s], candidates,
+																		  &num_candidates, NULL );
+			if( AUCR_Check_Same( "compiled", q, candidates, num_candidates, fixture.sorted, expected ) )
+			{
+				failures++;
+				break;
+			}
+		}
+	}
+	
+	AUCR_Check_Teardown( &fixture );
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Index()
+ *	Description:
+ *		checks that an index over the compiled alphabet gives, for random queries,
+ *		the unicode AUCR_ALPHABET_Recognize_From_Interpolated() gives, and exactly
+ *		the closest characters of a full sort of every character's difference
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		every mismatch has been reported
+ *	Returns:
+ *		the number of queries that did not match
+ */
+static int AUCR_Check_Index( void )
+{
+	//local variables
+	static const int sizes[] = { 1, 2, 5, 16 };
+	AUCR_Check_Fixture fixture;
+	AUCR_Index_Ptr tempindex = NULL;
+	AUCR_Candidate candidates[16];
+	wchar_t unicode = 0, indexunicode = 0;
+	int q, s, num_candidates, expected, failures = 0;
+	
+	if( AUCR_Check_Setup( AUCR_CHECK_CHARACTERS, &fixture ) != AUCR_ERR_SUCCESS ||
+	   AUCR_INDEX_Init( fixture.compiled_alphabet_ptr, &tempindex ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  could not set up\n" );
+		AUCR_Check_Teardown( &fixture );
+		return( 1 );
+	}
+	
+	for( q = 0; q < AUCR_CHECK_QUERIES; q++ )
+	{
+		AUCR_Check_Query( &fixture );
+		
+		AUCR_ALPHABET_Recognize_From_Interpolated( fixture.interpolated_character_ptr,
+												  fixture.alphabet_ptr, &unicode, NULL );
+		AUCR_INDEX_Recognize_From_Interpolated( fixture.interpolated_character_ptr,
+											   tempindex, &indexunicode, NULL );
+		if( indexunicode != unicode || unicode != fixture.sorted[0].unicode )
+		{
+			printf( "  index, query %d: unicode %d, alphabet gives %d, closest is %d\n",
+				   q, (int)indexunicode, (int)unicode, (int)fixture.sorted[0].unicode );
+			failures++;
+			continue;
+		}
+		
+		for( s = 0; s < (int)( sizeof( sizes ) / sizeof( sizes[0] ) ); s++ )
+		{
+			expected = ( sizes[s] < AUCR_CHECK_CHARACTERS ) ? sizes[s] : AUCR_CHECK_CHARACTERS;
+			
+			AUCR_INDEX_Recognize_Candidates_From_Interpolated( fixture.interpolated_character_ptr,
+															  tempindex, sizes[s], candidates,
+															  &num_candidates, NULL );
+			if( AUCR_Check_Same( "index", q, candidates, num_candidates, fixture.sorted, expected ) )
+			{
+				failures++;
+				break;
+			}
+		}
+	}
+	
+	AUCR_INDEX_Release( &tempindex );
+	AUCR_Check_Teardown( &fixture );
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Coarse()
+ *	Description:
+ *		checks that the coarse recognizer, with a shortlist as large as the alphabet,
+ *		gives for random queries exactly the closest characters of a full sort of
+ *		every character's difference, and as its closest the unicode the compiled
+ *		and classic recognizers give
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		every mismatch has been reported
+ *	Returns:
+ *		the number of queries that did not match
+ */
+static int AUCR_Check_Coarse( void )
+{
+	//local variables
+	static const int sizes[] = { 1, 2, 5, 16 };
+	AUCR_Check_Fixture fixture;
+	AUCR_Candidate candidates[16];
+	wchar_t unicode = 0, compiledunicode = 0;
+	int q, s, num_candidates, failures = 0;
+	
+	if( AUCR_Check_Setup( AUCR_COARSE_SHORTLIST, &fixture ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  could not set up\n" );
+		AUCR_Check_Teardown( &fixture );
+		return( 1 );
+	}
+	
+	for( q = 0; q < AUCR_CHECK_QUERIES; q++ )
+	{
+		AUCR_Check_Query( &fixture );
+		
+		for( s = 0; s < (int)( sizeof( sizes ) / sizeof( sizes[0] ) ); s++ )
+		{
+			AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Interpolated( fixture.interpolated_character_ptr,
+																	  fixture.compiled_alphabet_ptr,
+																	  AUCR_COARSE_SHORTLIST, sizes[s],
+																	  candidates, &num_candidates, NULL );
+			if( AUCR_Check_Same( "coarse", q, candidates, num_candidates, fixture.sorted, sizes[s] ) )
+			{
+				failures++;
+				break;
+			}
+		}
+		if( s < (int)( sizeof( sizes ) / sizeof( sizes[0] ) ) )
+		{
+			continue;
+		}
+		
+		//the closest of a full shortlist is the single best of the other recognizers
+		AUCR_COMPILED_ALPHABET_Recognize_Coarse_From_Interpolated( fixture.interpolated_character_ptr,
+																  fixture.compiled_alphabet_ptr,
+																  AUCR_COARSE_SHORTLIST, 1,
+																  candidates, &num_candidates, NULL );
+		AUCR_ALPHABET_Recognize_From_Interpolated( fixture.interpolated_character_ptr,
+												  fixture.alphabet_ptr, &unicode, NULL );
+		AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated( fixture.interpolated_character_ptr,
+														   fixture.compiled_alphabet_ptr,
+														   &compiledunicode, NULL );
+		if( candidates[0].unicode != unicode || candidates[0].unicode != compiledunicode )
+		{
+			printf( "  coarse, query %d: unicode %d, alphabet gives %d, compiled gives %d\n",
+				   q, (int)candidates[0].unicode, (int)unicode, (int)compiledunicode );
+			failures++;
+		}
+	}
+	
+	AUCR_Check_Teardown( &fixture );
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Code_Table()
+ *	Description:
+ *		checks that the directional codes looked up by octant and quantized slope
+ *		are those the search of the map gives, for every segment of a square of
+ *		AUCR_CHECK_SEGMENT_EXTENT steps around the origin, wide enough that every
+ *		slope step of the table is crossed, with the map aucrEdit::newAlphabet
+ *		creates and with one of uneven vectors.  the segments are the steps of
+ *		interpolated characters, found once by an alphabet whose map has a code
+ *		table and once by one whose code table has been taken away.
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		every mismatch has been reported
+ *	Returns:
+ *		the number of segments that did not match
+ */
+static int AUCR_Check_Code_Table( void )
+{
+	//local variables
+	static const int unevenx[AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES] =
+	{ 495, 728, 320, 584, 35, -44, -502, -334, -986, -297, -617, -360, -85, 75, 532, 460 };
+	static const int uneveny[AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES] =
+	{ -72, 54, 257, 812, 619, 347, 723, 309, 91, -43, -444, -403, -665, -413, -617, -369 };
+	unsigned long state = 1;
+	AUCR_Alphabet_Ptr tablealphabet = NULL;
+	AUCR_Alphabet_Ptr searchalphabet = NULL;
+	AUCR_Interpolated_Character_Ptr tempinterpolated = NULL;
+	AUCR_Character_Ptr tablecharacter = NULL;
+	AUCR_Character_Ptr searchcharacter = NULL;
+	AUCR_Coordinate * coordinates;
+	int m, i, j, dx, dy, failures = 0;
+	
+	if( AUCR_Check_Alphabet( &state, 0, &tablealphabet ) != AUCR_ERR_SUCCESS ||
+	   AUCR_Check_Alphabet( &state, 0, &searchalphabet ) != AUCR_ERR_SUCCESS ||
+	   AUCR_INTERPOLATED_CHARACTER_Init( '?', AUCR_CHECK_DIRECTIONAL_CODES,
+										&tempinterpolated ) != AUCR_ERR_SUCCESS ||
+	   AUCR_CHARACTER_Init( '?', AUCR_CHECK_DIRECTIONAL_CODES, AUCR_CHECK_ACTIVITY_REGIONS,
+						   &tablecharacter ) != AUCR_ERR_SUCCESS ||
+	   AUCR_CHARACTER_Init( '?', AUCR_CHECK_DIRECTIONAL_CODES, AUCR_CHECK_ACTIVITY_REGIONS,
+						   &searchcharacter ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  could not set up\n" );
+		failures = 1;
+	}
+	
+	for( m = 0; m < 2 && failures == 0; m++ )
+	{
+		//the second time round, give both maps the uneven vectors
+		if( m == 1 )
+		{
+			for( i = 0; i < AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES; i++ )
+			{
+				tablealphabet->directional_code_map_ptr->x[i] = unevenx[i];
+				tablealphabet->directional_code_map_ptr->y[i] = uneveny[i];
+				searchalphabet->directional_code_map_ptr->x[i] = unevenx[i];
+				searchalphabet->directional_code_map_ptr->y[i] = uneveny[i];
+			}
+			if( AUCR_DIRECTIONAL_CODE_MAP_Finalize( tablealphabet->directional_code_map_ptr ) !=
+			   AUCR_ERR_SUCCESS ||
+			   AUCR_DIRECTIONAL_CODE_MAP_Finalize( searchalphabet->directional_code_map_ptr ) !=
+			   AUCR_ERR_SUCCESS )
+			{
+				printf( "  could not finalize the uneven map\n" );
+				failures++;
+				break;
+			}
+		}
+		
+		//without a code table, every directional code is searched for
+		free( searchalphabet->directional_code_map_ptr->code_table );
+		searchalphabet->directional_code_map_ptr->code_table = NULL;
+		
+		//walk the segments of the square as the steps of interpolated characters
+		coordinates = tempinterpolated->coordinates;
+		coordinates[0].x = 0;
+		coordinates[0].y = 0;
+		j = 0;
+		for( dy = -AUCR_CHECK_SEGMENT_EXTENT; dy <= AUCR_CHECK_SEGMENT_EXTENT; dy++ )
+		{
+			for( dx = -AUCR_CHECK_SEGMENT_EXTENT; dx <= AUCR_CHECK_SEGMENT_EXTENT; dx++ )
+			{
+				coordinates[j + 1].x = coordinates[j].x + dx;
+				coordinates[j + 1].y = coordinates[j].y + dy;
+				j++;
+				if( j < AUCR_CHECK_DIRECTIONAL_CODES &&
+				   !( dy == AUCR_CHECK_SEGMENT_EXTENT && dx == AUCR_CHECK_SEGMENT_EXTENT ) )
+				{
+					continue;
+				}
+				
+				//the last character is filled out with repeats of its last segment
+				for( ; j < AUCR_CHECK_DIRECTIONAL_CODES; j++ )
+				{
+					coordinates[j + 1].x = coordinates[j].x + dx;
+					coordinates[j + 1].y = coordinates[j].y + dy;
+				}
+				AUCR_CHARACTER_From_Interpolated( tempinterpolated, tablealphabet, tablecharacter, NULL );
+				AUCR_CHARACTER_From_Interpolated( tempinterpolated, searchalphabet, searchcharacter, NULL );
+				for( i = 0; i < AUCR_CHECK_DIRECTIONAL_CODES; i++ )
+				{
+					if( tablecharacter->directional_codes[i] != searchcharacter->directional_codes[i] )
+					{
+						printf( "  map %d, segment %d %d: table gives %d, search gives %d\n", m,
+							   coordinates[i + 1].x - coordinates[i].x,
+							   coordinates[i + 1].y - coordinates[i].y,
+							   (int)tablecharacter->directional_codes[i],
+							   (int)searchcharacter->directional_codes[i] );
+						failures++;
+					}
+				}
+				
+				//start the next character where this one ended
+				coordinates[0] = coordinates[AUCR_CHECK_DIRECTIONAL_CODES];
+				j = 0;
+			}
+		}
+	}
+	
+	if( searchcharacter != NULL )
+	{
+		AUCR_CHARACTER_Release( &searchcharacter );
+	}
+	if( tablecharacter != NULL )
+	{
+		AUCR_CHARACTER_Release( &tablecharacter );
+	}
+	if( tempinterpolated != NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpolated );
+	}
+	if( searchalphabet != NULL )
+	{
+		AUCR_ALPHABET_Release( &searchalphabet );
+	}
+	if( tablealphabet != NULL )
+	{
+		AUCR_ALPHABET_Release( &tablealphabet );
+	}
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_File_Value()
+ *	Description:
+ *		saves a compiled alphabet, opens it mapped without checking the block's
+ *		checksum, writes a value into the file where one of its bytes was mapped,
+ *		and checks that the file is then refused
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to save
+ *		i_name -> name of the value, to report a mismatch with
+ *		i_member_offset -> offset, from the start of the compiled alphabet, of the
+ *							pointer to the section the value is written in
+ *		i_value -> two byte value to write at the start of the section
+ *	Preconditions:
+ *		all pointers are valid, and AUCR_CHECK_FILE may be written
+ *	Postconditions:
+ *		AUCR_CHECK_FILE has been removed, and a mismatch has been reported
+ *	Returns:
+ *		zero if the file was refused or this host does not map files, one otherwise
+ */
+static int AUCR_Check_File_Value(
+								 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+								 const char * i_name,
+								 unsigned long i_member_offset,
+								 unsigned int i_value )
+{
+	//local variables
+	AUCR_Compiled_Alphabet_Ptr tempcompiled = NULL;
+	unsigned char bytes[2];
+	long offset;
+	FILE * tempfp;
+	int failures = 0;
+	
+	if( AUCR_COMPILED_ALPHABET_Save_To_File( AUCR_CHECK_FILE, i_compiled_alphabet_ptr ) != AUCR_ERR_SUCCESS ||
+	   AUCR_COMPILED_ALPHABET_Open_From_File( AUCR_CHECK_FILE, 0, &tempcompiled ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  %s: could not save and open the file\n", i_name );
+		remove( AUCR_CHECK_FILE );
+		return( 1 );
+	}
+	
+	//only a mapped file is recognized against without its checksum checked
+	if( tempcompiled->mapping == NULL )
+	{
+		AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+		remove( AUCR_CHECK_FILE );
+		return( 0 );
+	}
+	offset = (long)( *(const unsigned char * const *)( (const unsigned char *)tempcompiled + i_member_offset ) -
+					(const unsigned char *)tempcompiled->mapping );
+	AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+	
+	bytes[0] = (unsigned char)( i_value & 0xFF );
+	bytes[1] = (unsigned char)( ( i_value >> 8 ) & 0xFF );
+	tempfp = fopen( AUCR_CHECK_FILE, "r+b" );
+	if( tempfp == NULL || fseek( tempfp, offset, SEEK_SET ) != 0 || fwrite( bytes, 1, 2, tempfp ) != 2 )
+	{
+		printf( "  %s: could not write the file\n", i_name );
+		failures = 1;
+	}
+	if( tempfp != NULL )
+	{
+		fclose( tempfp );
+	}
+	
+	if( failures == 0 &&
+	   AUCR_COMPILED_ALPHABET_Open_From_File( AUCR_CHECK_FILE, 0, &tempcompiled ) != AUCR_ERR_FAILED )
+	{
+		printf( "  %s: a file with %u there was opened\n", i_name, i_value );
+		AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+		failures = 1;
+	}
+	remove( AUCR_CHECK_FILE );
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_File()
+ *	Description:
+ *		checks that a compiled alphabet file, opened mapped without checking the
+ *		block's checksum, is refused if a value recognition indexes arrays with is
+ *		out of range: a code table entry, an activity region's start or stop, or
+ *		an index
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		AUCR_CHECK_FILE may be written
+ *	Postconditions:
+ *		every mismatch has been reported
+ *	Returns:
+ *		the number of out of range values that were not refused
+ */
+static int AUCR_Check_File( void )
+{
+	//local variables
+	AUCR_Check_Fixture fixture;
+	int failures = 0;
+	
+	if( AUCR_Check_Setup( 20, &fixture ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  could not set up\n" );
+		AUCR_Check_Teardown( &fixture );
+		return( 1 );
+	}
+	
+	//a code of the map's own size, and of -2, are past either end
+	failures += AUCR_Check_File_Value( fixture.compiled_alphabet_ptr, "code table",
+									  offsetof( AUCR_Compiled_Alphabet, directional_code_map.code_table ),
+									  AUCR_CHECK_MAPPABLE_DIRECTIONAL_CODES );
+	failures += AUCR_Check_File_Value( fixture.compiled_alphabet_ptr, "code table",
+									  offsetof( AUCR_Compiled_Alphabet, directional_code_map.code_table ),
+									  0xFFFE );
+	
+	//the low bytes of the first region's start, and of the first index
+	failures += AUCR_Check_File_Value( fixture.compiled_alphabet_ptr, "activity region",
+									  offsetof( AUCR_Compiled_Alphabet, activity_regions ),
+									  AUCR_CHECK_DIRECTIONAL_CODES );
+	failures += AUCR_Check_File_Value( fixture.compiled_alphabet_ptr, "index",
+									  offsetof( AUCR_Compiled_Alphabet, indices ), 20 );
+	
+	AUCR_Check_Teardown( &fixture );
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Square_Root()
+ *	Description:
+ *		checks that AUCR_Integer_Square_Root() and
+ *		AUCR_Un_Scaled_Integer_Square_Root() give the floating point square root,
+ *		rounded to the nearest integer, for every squared length of a vector of
+ *		up to AUCR_CHECK_PEN_EXTENT in x and y.  double holds these roots closely
+ *		enough that rounding it cannot differ from rounding the exact root.
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		the first mismatch of each root has been reported
+ *	Returns:
+ *		the number of numbers whose roots did not match
+ */
+static int AUCR_Check_Square_Root( void )
+{
+	//local variables
+	int n, root, expected, failures = 0;
+	
+	for( n = 0; n <= 2 * AUCR_CHECK_PEN_EXTENT * AUCR_CHECK_PEN_EXTENT; n++ )
+	{
+		root = AUCR_Integer_Square_Root( n );
+		expected = (int)floor( sqrt( (double)n * AUCR_SCALE * AUCR_SCALE ) + 0.5 );
+		if( root != expected )
+		{
+			if( failures == 0 )
+			{
+				printf( "  scaled root of %d is %d, not %d\n", n, root, expected );
+			}
+			failures++;
+		}
+		
+		root = AUCR_Un_Scaled_Integer_Square_Root( n );
+		expected = (int)floor( sqrt( (double)n ) + 0.5 );
+		if( root != expected )
+		{
+			if( failures == 0 )
+			{
+				printf( "  root of %d is %d, not %d\n", n, root, expected );
+			}
+			failures++;
+		}
+	}
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Divide_By()
+ *	Description:
+ *		checks that AUCR_Reciprocal_Rounding_Divide() by one divisor gives what
+ *		AUCR_Rounding_Divide() gives, for dividends around zero, around the
+ *		divisor and its half, around where the two highest quotients under 2^31
+ *		start and round up, of either sign, and random ones.  when the divisor
+ *		is AUCR_SCALE, AUCR_Scale_Rounding_Divide() is checked too.
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		i_divisor -> the divisor, positive
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the first mismatch has been reported
+ *	Returns:
+ *		the number of dividends that did not match
+ */
+static int AUCR_Check_Divide_By( unsigned long * io_state_ptr, int i_divisor )
+{
+	//local variables
+	static const int near[] = { -2, -1, 0, 1, 2 };
+	AUCR_Reciprocal reciprocal;
+	int dividends[( 4 * 5 ) + 2 + ( 2 * 2 * 2 * 5 ) + 2 + AUCR_CHECK_DIVIDENDS];
+	int i, j, num_dividends, expected, failures = 0;
+	long long int top, k, dividend;
+	
+	AUCR_Reciprocal_Init( i_divisor, &reciprocal );
+	
+	//the dividends around zero, the divisor, and half the divisor, of either sign
+	num_dividends = 0;
+	for( i = 0; i < 5; i++ )
+	{
+		dividends[num_dividends++] = near[i];
+		dividends[num_dividends++] = ( i_divisor / 2 ) + near[i];
+		dividends[num_dividends++] = i_divisor + near[i];
+		dividends[num_dividends++] = -( i_divisor + near[i] );
+	}
+	dividends[num_dividends++] = -( i_divisor / 2 );
+	dividends[num_dividends++] = -( i_divisor / 2 ) - 1;
+	
+	//the dividends around the start of the two highest quotients under 2^31, and
+	//around where they round up, and 2^31 - 1, of either sign.  -2^31 itself is
+	//left out, as AUCR_Rounding_Divide() cannot take its magnitude
+	top = ( INT_MAX / i_divisor ) * (long long int)i_divisor;
+	for( k = top - i_divisor; k <= top; k += i_divisor )
+	{
+		for( i = 0; i < 5; i++ )
+		{
+			for( j = 0; j < 2; j++ )
+			{
+				dividend = k + ( j * ( ( i_divisor + 1 ) / 2 ) ) + near[i];
+				dividends[num_dividends] = (int)( ( dividend > INT_MAX ) ? INT_MAX : dividend );
+				dividends[num_dividends + 1] = -dividends[num_dividends];
+				num_dividends += 2;
+			}
+		}
+	}
+	dividends[num_dividends++] = INT_MAX;
+	dividends[num_dividends++] = -INT_MAX;
+	for( i = 0; i < AUCR_CHECK_DIVIDENDS; i++ )
+	{
+		dividends[num_dividends++] = (int)( ( (unsigned long)AUCR_Check_Random( io_state_ptr, 0x10000 ) << 16 ) |
+										   (unsigned long)AUCR_Check_Random( io_state_ptr, 0x10000 ) ) & INT_MAX;
+		if( AUCR_Check_Random( io_state_ptr, 2 ) )
+		{
+			dividends[num_dividends - 1] = -dividends[num_dividends - 1];
+		}
+	}
+	
+	for( j = 0; j < num_dividends; j++ )
+	{
+		expected = AUCR_Rounding_Divide( dividends[j], i_divisor );
+		if( AUCR_Reciprocal_Rounding_Divide( dividends[j], &reciprocal ) != expected ||
+		   ( i_divisor == AUCR_SCALE && AUCR_Scale_Rounding_Divide( dividends[j] ) != expected ) )
+		{
+			if( failures == 0 )
+			{
+				printf( "  %d / %d is not %d\n", dividends[j], i_divisor, expected );
+			}
+			failures++;
+		}
+	}
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Divide()
+ *	Description:
+ *		checks the reciprocal divisions, with AUCR_Check_Divide_By(), for every
+ *		divisor up to 64, every power of two and the divisors either side of it up
+ *		to AUCR_CHECK_DIVISOR_BITS bits, AUCR_SCALE, and random divisors.  a
+ *		reciprocal of 0 is checked to divide everything to 0, as
+ *		AUCR_Rounding_Divide() does.
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		the first mismatch of each divisor has been reported
+ *	Returns:
+ *		the number of divisions that did not match
+ */
+static int AUCR_Check_Divide( void )
+{
+	//local variables
+	AUCR_Reciprocal reciprocal;
+	unsigned long state = 1;
+	int i, failures = 0;
+	
+	AUCR_Reciprocal_Init( 0, &reciprocal );
+	if( AUCR_Reciprocal_Rounding_Divide( INT_MAX, &reciprocal ) != 0 ||
+	   AUCR_Reciprocal_Rounding_Divide( -INT_MAX, &reciprocal ) != 0 )
+	{
+		printf( "  a reciprocal of 0 does not divide to 0\n" );
+		failures++;
+	}
+	
+	for( i = 1; i <= 64; i++ )
+	{
+		failures += AUCR_Check_Divide_By( &state, i );
+	}
+	for( i = 7; i <= AUCR_CHECK_DIVISOR_BITS; i++ )
+	{
+		failures += AUCR_Check_Divide_By( &state, ( 1 << i ) - 1 );
+		failures += AUCR_Check_Divide_By( &state, 1 << i );
+		failures += AUCR_Check_Divide_By( &state, ( 1 << i ) + 1 );
+	}
+	failures += AUCR_Check_Divide_By( &state, AUCR_SCALE );
+	for( i = 0; i < AUCR_CHECK_DIVISORS; i++ )
+	{
+		failures += AUCR_Check_Divide_By( &state, 1 + AUCR_Check_Random( &state, 1 << AUCR_CHECK_DIVISOR_BITS ) );
+	}
+	
+	return( failures );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Check_Publish()
+ *	Description:
+ *		publishes an alphabet, removes characters from the middle of it, which
+ *		moves others to new indices, and adds characters, which go in the freed
+ *		slots, then publishes it again.  checks that every character kept is
+ *		shared with the snapshot before wherever it has moved to, that every
+ *		character added is a new copy, that each matches the alphabet, and that
+ *		filtered recognition refuses the snapshot's alphabet.
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		every mismatch has been reported
+ *	Returns:
+ *		the number of characters and recognitions that did not match
+ */
+static int AUCR_Check_Publish( void )
+{
+	//local variables
+	static const wchar_t unicodes[1] = { 'a' };
+	unsigned long state = 1;
+	AUCR_Alphabet_Ptr tempalphabet = NULL;
+	AUCR_Publisher_Ptr temppublisher = NULL;
+	AUCR_Snapshot_Ptr oldsnapshot = NULL;
+	AUCR_Snapshot_Ptr newsnapshot = NULL;
+	AUCR_Class_Filter_Ptr tempfilter = NULL;
+	AUCR_Character_Ptr published[AUCR_CHECK_PUBLISHED];
+	AUCR_Character_Ptr kept[AUCR_CHECK_PUBLISHED];
+	AUCR_Character_Ptr live, shared;
+	AUCR_Coordinate coordinates[AUCR_CHECK_COORDINATES];
+	wchar_t unicode = 0x0000;
+	int i, j, num_kept, num_coordinates, failures = 0;
+	
+	if( AUCR_Check_Alphabet( &state, AUCR_CHECK_PUBLISHED, &tempalphabet ) != AUCR_ERR_SUCCESS ||
+	   AUCR_PUBLISHER_Init( &temppublisher ) != AUCR_ERR_SUCCESS ||
+	   AUCR_CLASS_FILTER_Init( 1, unicodes, &tempfilter ) != AUCR_ERR_SUCCESS ||
+	   AUCR_PUBLISHER_Publish( tempalphabet, temppublisher ) != AUCR_ERR_SUCCESS ||
+	   AUCR_PUBLISHER_Pin( temppublisher, &oldsnapshot ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  could not set up\n" );
+		AUCR_SNAPSHOT_Unpin( &oldsnapshot );
+		AUCR_PUBLISHER_Release( &temppublisher );
+		AUCR_CLASS_FILTER_Release( &tempfilter );
+		AUCR_ALPHABET_Release( &tempalphabet );
+		return( 1 );
+	}
+	for( i = 0; i < AUCR_CHECK_PUBLISHED; i++ )
+	{
+		published[i] = tempalphabet->characters_ptr_ptr[i];
+	}
+	
+	//remove from the middle, and note which copy each character kept was
+	//published with
+	for( i = 0; i < AUCR_CHECK_REPUBLISHED; i++ )
+	{
+		AUCR_ALPHABET_Remove_Character( 3 + 7 * i, tempalphabet );
+	}
+	num_kept = tempalphabet->num_characters;
+	for( i = 0; i < num_kept; i++ )
+	{
+		for( j = 0; published[j] != tempalphabet->characters_ptr_ptr[i]; j++ )
+		{
+		}
+		kept[i] = oldsnapshot->alphabet_ptr->characters_ptr_ptr[j];
+	}
+	
+	//add into the freed slots and publish again
+	for( i = 0; i < AUCR_CHECK_REPUBLISHED; i++ )
+	{
+		num_coordinates = AUCR_Check_Stroke( &state, coordinates );
+		AUCR_ALPHABET_Add_Raw( 'a', num_coordinates, coordinates, tempalphabet );
+	}
+	if( AUCR_PUBLISHER_Publish( tempalphabet, temppublisher ) != AUCR_ERR_SUCCESS ||
+	   AUCR_PUBLISHER_Pin( temppublisher, &newsnapshot ) != AUCR_ERR_SUCCESS ||
+	   newsnapshot->version != 2 ||
+	   newsnapshot->alphabet_ptr->num_characters != tempalphabet->num_characters )
+	{
+		printf( "  could not publish again\n" );
+		failures++;
+	}
+	else
+	{
+		for( i = 0; i < tempalphabet->num_characters; i++ )
+		{
+			live = tempalphabet->characters_ptr_ptr[i];
+			shared = newsnapshot->alphabet_ptr->characters_ptr_ptr[i];
+			if( i < num_kept && shared != kept[i] )
+			{
+				printf( "  character %d kept was copied again\n", i );
+				failures++;
+			}
+			for( j = 0; i >= num_kept && j < AUCR_CHECK_PUBLISHED; j++ )
+			{
+				if( shared == oldsnapshot->alphabet_ptr->characters_ptr_ptr[j] )
+				{
+					printf( "  character %d added shares character %d before\n", i, j );
+					failures++;
+				}
+			}
+			if( shared->unicode != live->unicode ||
+			   memcmp( shared->directional_codes, live->directional_codes,
+					  AUCR_CHECK_DIRECTIONAL_CODES * sizeof( int ) ) != 0 ||
+			   memcmp( shared->activity_measures, live->activity_measures,
+					  AUCR_CHECK_ACTIVITY_REGIONS * sizeof( int ) ) != 0 )
+			{
+				printf( "  character %d does not match the alphabet\n", i );
+				failures++;
+			}
+		}
+		
+		//a snapshot has no table of classes to filter with
+		num_coordinates = AUCR_Check_Stroke( &state, coordinates );
+		if( AUCR_ALPHABET_Recognize_Filtered( num_coordinates, coordinates, tempalphabet, tempfilter,
+											 &unicode, NULL ) != AUCR_ERR_SUCCESS ||
+		   AUCR_ALPHABET_Recognize_Filtered( num_coordinates, coordinates, newsnapshot->alphabet_ptr,
+											 tempfilter, &unicode, NULL ) != AUCR_ERR_FAILED )
+		{
+			printf( "  filtered recognition does not refuse only the snapshot\n" );
+			failures++;
+		}
+	}
+	
+	AUCR_SNAPSHOT_Unpin( &newsnapshot );
+	AUCR_SNAPSHOT_Unpin( &oldsnapshot );
+	AUCR_PUBLISHER_Release( &temppublisher );
+	AUCR_CLASS_FILTER_Release( &tempfilter );
+	AUCR_ALPHABET_Release( &tempalphabet );
+	
+	return( failures );
+}
+
+
+/* ==============================================
+	FUNCTION DEFINITIONS
+   ============================================== */
+
+int main( void )
+{
+	//local variables
+	int failures, total = 0;
+	
+	failures = AUCR_Check_Candidates();
+	printf( "candidates match a full sort: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	failures = AUCR_Check_Index();
+	printf( "index matches the linear recognizers: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	failures = AUCR_Check_Coarse();
+	printf( "coarse with a full shortlist matches a full sort: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	failures = AUCR_Check_Code_Table();
+	printf( "code table matches the directional code search: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	failures = AUCR_Check_File();
+	printf( "compiled files with values out of range are refused: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	failures = AUCR_Check_Square_Root();
+	printf( "integer square roots match floating point: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	failures = AUCR_Check_Divide();
+	printf( "reciprocal divisions match the rounding divide: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	failures = AUCR_Check_Publish();
+	printf( "publishing again shares the characters kept: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	total += failures;
+	
+	return( ( total == 0 ) ? 0 : 1 );
+}
@@ -0,0 +1,201 @@
+//AUCRTemplate.cpp
+
+#include "AUCRTemplate.h"
+
+
+/* ==============================================
+ FUNCTION IMPLEMENTATIONS
+ ============================================== */
+
+/*
+ *	Name:
+ *		AUCR_FIXED_Recognize_From_Interpolated()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character given as an argument and returns the unicode of
+ *		this found character.  a compiled alphabet of the geometry of
+ *		AUCR_FIXED_DIRECTIONAL_CODES, AUCR_FIXED_ACTIVITY_REGIONS and
+ *		AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES is scanned by the specialized
+ *		AUCR_Fixed_Scan(), and any other by
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated(), which gives the same
+ *		unicode either way.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the character in
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at least
+ *		one character, num_directional_codes between the compiled alphabet and the
+ *		character is in agreement
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_FIXED_Recognize_From_Interpolated(
+												  const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+												  const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+												  wchar_t * o_unicode_ptr,
+												  AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Workspace_Ptr tempworkspace = NULL;
+	AUCR_Candidate tempcandidate;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_interpolated_character_ptr == NULL || i_compiled_alphabet_ptr == NULL ||
+	   o_unicode_ptr == NULL || i_compiled_alphabet_ptr->num_characters < 1 )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//fall back to the generic recognizer for any other geometry
+	if( i_compiled_alphabet_ptr->num_directional_codes != AUCR_FIXED_DIRECTIONAL_CODES ||
+	   i_compiled_alphabet_ptr->num_activity_regions != AUCR_FIXED_ACTIVITY_REGIONS ||
+	   i_compiled_alphabet_ptr->directional_code_map.mappable_directional_codes !=
+	   AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES )
+	{
+		return( AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated( i_interpolated_character_ptr,
+																   i_compiled_alphabet_ptr, o_unicode_ptr,
+																   io_workspace_ptr ) );
+	}
+	
+	//use the workspace given, or create one for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempworkspace = io_workspace_ptr;
+	}
+	else
+	{
+		temperror = AUCR_WORKSPACE_Init_From_Compiled( i_compiled_alphabet_ptr, &tempworkspace );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	
+	//find the features of the interpolated character
+	temperror = AUCR_COMPILED_ALPHABET_Query_From_Interpolated( i_interpolated_character_ptr,
+															   i_compiled_alphabet_ptr, tempworkspace );
+	if( temperror == AUCR_ERR_SUCCESS )
+	{
+		//find the closest row with the specialized scan
+		AUCR_Fixed_Scan< AUCR_FIXED_DIRECTIONAL_CODES, AUCR_FIXED_ACTIVITY_REGIONS,
+		AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES >( i_compiled_alphabet_ptr, tempworkspace->row,
+												tempworkspace->character.activity_measures,
+												&tempcandidate );
+	
+		//place unicode value of closest row in o_unicode_ptr
+		( *o_unicode_ptr ) = tempcandidate.unicode;
+	}
+	
+	//free workspace memory unless it was given
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_WORKSPACE_Release( &tempworkspace );
+	}
+	
+	return( temperror );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_FIXED_Recognize_From_Raw()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		using the specialized recognizer when the compiled alphabet's geometry
+ *		has one
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at
+ *		least one character
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_FIXED_Recognize_From_Raw(
+										 int i_num_coordinates,
+										 const AUCR_Coordinate * i_coordinates,
+										 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+										 wchar_t * o_unicode_ptr,
+										 AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Interpolated_Character_Ptr tempinterpchar = NULL;
+	AUCR_Error temperror;
+	
+	//check for valid input
+	if( i_num_coordinates < 1 || i_coordinates == NULL || i_compiled_alphabet_ptr == NULL )
+	{
+		return( AUCR_ERR_FAILED );
+	}
+	
+	//take interpolated character from the workspace, or create it for this call
+	if( io_workspace_ptr != NULL )
+	{
+		tempinterpchar = &( io_workspace_ptr->interpolated_character );
+	}
+	else
+	{
+		temperror = AUCR_INTERPOLATED_CHARACTER_Init( 0x0001,
+													 i_compiled_alphabet_ptr->num_directional_codes, &tempinterpchar );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			//if creation returns an error, throw it up
+			return( temperror );
+		}
+	}
+	
+	//convert raw coordinates to interpolated character
+	temperror = AUCR_INTERPOLATED_CHARACTER_From_Raw(
+													 i_num_coordinates, i_coordinates, tempinterpchar,
+													 io_workspace_ptr );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		//if conversion returns an error, throw it up
+		if( io_workspace_ptr == NULL )
+		{
+			AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		}
+		return( temperror );
+	}
+	
+	//call interpolated_recognize
+	temperror = AUCR_FIXED_Recognize_From_Interpolated( tempinterpchar, i_compiled_alphabet_ptr,
+													   o_unicode_ptr, io_workspace_ptr );
+	
+	//free interpolated character memory unless it belongs to the workspace
+	if( io_workspace_ptr == NULL )
+	{
+		AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+	}
+	
+	//return value returned by interpolated_recognize
+	return( temperror );
+}
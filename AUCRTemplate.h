@@ -0,0 +1,289 @@
+//AUCRTemplate.h
+
+#ifndef AUCRTEMPLATE_H
+#define AUCRTEMPLATE_H
+
+#include "AUCR.h"
+
+/* ==============================================
+	MACRO / CONSTANT DEFINITIONS
+   ============================================== */
+
+/* the geometry of the alphabets aucrEdit::newAlphabet creates, which the
+	dispatchers below have a specialized recognizer for */
+#define AUCR_FIXED_DIRECTIONAL_CODES 64
+#define AUCR_FIXED_ACTIVITY_REGIONS 7
+#define AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES 16
+
+/* number of directional codes AUCR_Fixed_Scan() sums between checks of
+	whether a row can still be the closest.  where the compiler vectorizes the
+	sum, a whole row costs about as much as one check, so it is summed at once */
+#if defined( __AVX2__ ) || defined( __SSE2__ )
+#define AUCR_FIXED_BLOCK_CODES AUCR_FIXED_DIRECTIONAL_CODES
+#else
+#define AUCR_FIXED_BLOCK_CODES 16
+#endif
+
+
+/* ==============================================
+	TEMPLATE DEFINITIONS
+   ============================================== */
+
+/* the templates are only for C++ units; the recognizers below them are also
+	declared for C, so that C programs such as AUCRBench.c can call them */
+#ifdef __cplusplus
+
+/*
+ *	Name:
+ *		AUCR_Fixed_Activity_Difference()
+ *	Description:
+ *		finds the biased, squared difference between two activity measures exactly
+ *		as the compiled recognizers do, in 64 bit arithmetic that never wraps around
+ *		and held to AUCR_ACTIVITY_DIFFERENCE_LIMIT, with every division by a constant
+ *		so that the compiler can turn it into a multiplication
+ *	Parameters:
+ *		i_activity_measure -> activity measure of the character being recognized
+ *		i_prototype_activity_measure -> activity measure of the row
+ *		i_bias -> the bias of the activity region the measures are from
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		none
+ *	Returns:
+ *		the difference the compiled recognizers add for the region
+ */
+inline unsigned long int AUCR_Fixed_Activity_Difference(
+														int i_activity_measure,
+														int i_prototype_activity_measure,
+														int i_bias )
+{
+	//local variables
+	unsigned long long int delta, square, whole, part;
+	
+	if( i_bias <= 0 )
+	{
+		return( 0 );
+	}
+	
+	delta = ( i_activity_measure < i_prototype_activity_measure ) ?
+	(unsigned long long int)( (long long int)i_prototype_activity_measure - i_activity_measure ) :
+	(unsigned long long int)( (long long int)i_activity_measure - i_prototype_activity_measure );
+	square = delta * delta;
+	
+	whole = square / ( AUCR_SCALE * AUCR_SCALE );
+	if( whole > AUCR_ACTIVITY_DIFFERENCE_LIMIT / (unsigned long long int)i_bias )
+	{
+		return( AUCR_ACTIVITY_DIFFERENCE_LIMIT );
+	}
+	part = ( square - ( whole * ( AUCR_SCALE * AUCR_SCALE ) ) ) * (unsigned long long int)i_bias;
+	whole = ( whole * i_bias ) + ( part / ( AUCR_SCALE * AUCR_SCALE ) );
+	
+	//round up when the remainder is at least half the divisor
+	if( 2 * ( part % ( AUCR_SCALE * AUCR_SCALE ) ) >= AUCR_SCALE * AUCR_SCALE )
+	{
+		whole++;
+	}
+	
+	return( ( whole > AUCR_ACTIVITY_DIFFERENCE_LIMIT ) ?
+		   AUCR_ACTIVITY_DIFFERENCE_LIMIT : (unsigned long int)whole );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Fixed_Scan()
+ *	Description:
+ *		finds the row of a compiled alphabet that is closest to the packed
+ *		directional codes and activity measures given, for a compiled alphabet of
+ *		the geometry given as template arguments.  with every loop bound known
+ *		while compiling, the compiler can unroll the activity measure loop and
+ *		vectorize the directional code loop.  rows are scored, skipped and tie
+ *		broken exactly as AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated() does.
+ *	Parameters:
+ *		i_compiled_alphabet_ptr -> compiled alphabet to scan
+ *		i_directional_codes -> packed directional codes of the character being recognized
+ *		i_activity_measures -> activity measures of the character being recognized
+ *		o_candidate_ptr <- address of the candidate to store the closest row in
+ *	Preconditions:
+ *		i_compiled_alphabet_ptr is a valid compiled alphabet of at least one character
+ *		whose num_directional_codes, num_activity_regions and mappable_directional_codes
+ *		are the template arguments
+ *	Postconditions:
+ *		the closest row is stored at o_candidate_ptr
+ *	Returns:
+ *		none
+ */
+template< int NUM_DIRECTIONAL_CODES, int NUM_ACTIVITY_REGIONS, int MAPPABLE_DIRECTIONAL_CODES >
+void AUCR_Fixed_Scan(
+					 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+					 const unsigned char * i_directional_codes,
+					 const int * i_activity_measures,
+					 AUCR_Candidate * o_candidate_ptr )
+{
+	//local variables
+	int i, j, k;
+	const unsigned char * tempcodes;
+	const int * tempmeasures;
+	unsigned int delta, tempmin, tempmax, direction;
+	unsigned long int difference;
+	
+	for( i = 0; i < i_compiled_alphabet_ptr->num_characters; i++ )
+	{
+		tempcodes = i_compiled_alphabet_ptr->directional_codes +
+		( i * i_compiled_alphabet_ptr->directional_code_stride );
+		tempmeasures = i_compiled_alphabet_ptr->activity_measures +
+		( i * i_compiled_alphabet_ptr->activity_measure_stride );
+	
+		//check all activity measure differences
+		difference = 0;
+		for( j = 0; j < NUM_ACTIVITY_REGIONS; j++ )
+		{
+			difference += AUCR_Fixed_Activity_Difference( i_activity_measures[j], tempmeasures[j],
+														 i_compiled_alphabet_ptr->bias[j] );
+		}
+	
+		//skip the directional codes if this row
+		//already cannot be the closest
+		if( ( i != 0 ) && ( difference > o_candidate_ptr->difference ) )
+		{
+			continue;
+		}
+	
+		//check the directional code differences a block at a time, with no
+		//branches inside a block so that it can be vectorized, and stop as
+		//soon as this row cannot be the closest
+		direction = 0;
+		for( k = 0; k < NUM_DIRECTIONAL_CODES; k += AUCR_FIXED_BLOCK_CODES )
+		{
+			for( j = k; j < k + AUCR_FIXED_BLOCK_CODES && j < NUM_DIRECTIONAL_CODES; j++ )
+			{
+				tempmin = ( i_directional_codes[j] < tempcodes[j] ) ? i_directional_codes[j] : tempcodes[j];
+				tempmax = ( i_directional_codes[j] < tempcodes[j] ) ? tempcodes[j] : i_directional_codes[j];
+				delta = tempmax - tempmin;
+				delta = ( delta < MAPPABLE_DIRECTIONAL_CODES - delta ) ?
+				delta : ( MAPPABLE_DIRECTIONAL_CODES - delta );
+				direction += delta * delta;
+			}
+			if( ( i != 0 ) &&
+			   ( difference + AUCR_SCALE * (unsigned long int)direction > o_candidate_ptr->difference ) )
+			{
+				break;
+			}
+		}
+		if( k < NUM_DIRECTIONAL_CODES )
+		{
+			continue;
+		}
+		difference += AUCR_SCALE * (unsigned long int)direction;
+	
+		//keep this row if it is closer than the closest so far
+		if( ( i == 0 ) || ( difference < o_candidate_ptr->difference ) ||
+		   ( ( difference == o_candidate_ptr->difference ) &&
+			( i_compiled_alphabet_ptr->indices[i] < o_candidate_ptr->index ) ) )
+		{
+			o_candidate_ptr->unicode = i_compiled_alphabet_ptr->unicodes[i];
+			o_candidate_ptr->index = i_compiled_alphabet_ptr->indices[i];
+			o_candidate_ptr->difference = difference;
+		}
+	}
+	
+	return;
+}
+
+
+#endif // __cplusplus
+
+
+/* ==============================================
+	FUNCTION DEFINITIONS
+   ============================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *	Name:
+ *		AUCR_FIXED_Recognize_From_Interpolated()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character given as an argument and returns the unicode of
+ *		this found character.  a compiled alphabet of the geometry of
+ *		AUCR_FIXED_DIRECTIONAL_CODES, AUCR_FIXED_ACTIVITY_REGIONS and
+ *		AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES is scanned by the specialized
+ *		AUCR_Fixed_Scan(), and any other by
+ *		AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated(), which gives the same
+ *		unicode either way.
+ *	Parameters:
+ *			i_interpolated_character_ptr -> interpolated character that we will look
+ *														for a match for
+ *			i_compiled_alphabet_ptr -> address of the compiled alphabet to find the character in
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_interpolated_character_ptr is a valid pointer to a valid interpolated character,
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at least
+ *		one character, num_directional_codes between the compiled alphabet and the
+ *		character is in agreement
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ *		AUCR_ERR_CONFLICTING_PARAMETERS if all preconditions except the agreement of
+ *													num_directional_codes are met
+ */
+AUCR_Error AUCR_FIXED_Recognize_From_Interpolated(
+	const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+/*
+ *	Name:
+ *		AUCR_FIXED_Recognize_From_Raw()
+ *	Description:
+ *		finds the character in the compiled alphabet that is closest to the
+ *		interpolated character that is created from the raw data that is given,
+ *		using the specialized recognizer when the compiled alphabet's geometry
+ *		has one
+ *	Parameters:
+ *			i_num_coordinates -> number of raw coordinates supplied
+ *			i_coordinates -> array of raw coordinates of length i_num_coordinate
+ *			i_compiled_alphabet_ptr -> pointer to compiled alphabet to search against
+ *			o_unicode_ptr <- address of wchar_t variable to store unicode in
+ *			io_workspace_ptr <-> workspace to take scratch memory from, or NULL to
+ *									allocate it for this call only
+ *	Preconditions:
+ *		i_num coordinates is positive integer
+ *		i_coordinates is non NULL and points to a valid array of
+ *							of i_num_coordinates coordinates
+ *		i_compiled_alphabet_ptr is a valid pointer to a compiled alphabet with at
+ *		least one character
+ *	Postconditions:
+ *		the closest character in the compiled alphabet has been found, and its unicode
+ *		value is stored in the variable pointed to by o_unicode_ptr
+ *	Returns:
+ *		AUCR_ERR_SUCCESS
+ *		AUCR_ERR_FAILED if preconditions are unmet.
+ *		AUCR_ERR_NO_MEMORY if the structure or array memories could not be allocated
+ */
+AUCR_Error AUCR_FIXED_Recognize_From_Raw(
+	int i_num_coordinates,
+	const AUCR_Coordinate * i_coordinates,
+	const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+	wchar_t * o_unicode_ptr,
+	AUCR_Workspace_Ptr io_workspace_ptr
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AUCRTEMPLATE_H
@@ -0,0 +1,363 @@
+//AUCRTemplateCheck.cpp
+
+/*
+ *	checks that the fixed geometry recognizer of AUCRTemplate.h finds, for
+ *	random queries, the same closest row as the generic compiled recognizer,
+ *	with the same index and difference, over alphabets made from random strokes
+ *	and random biases in the geometry it is specialized for.  some strokes are
+ *	added twice under different unicodes and some queries are strokes of the
+ *	alphabet, so that rows tie and the lower index has to win.  run by "make
+ *	check", which builds it for the host; it exits non-zero if any query differs.
+ */
+
+#include "AUCRTemplate.h"
+
+/* ==============================================
+	MACRO / CONSTANT DEFINITIONS
+   ============================================== */
+
+/* alphabets checked, most characters in each, and queries checked against each */
+#define AUCR_TEMPLATE_CHECK_ALPHABETS 8
+#define AUCR_TEMPLATE_CHECK_CHARACTERS 200
+#define AUCR_TEMPLATE_CHECK_QUERIES 300
+
+/* most raw coordinates in a random stroke, and the size of the square they are in */
+#define AUCR_TEMPLATE_CHECK_COORDINATES 40
+#define AUCR_TEMPLATE_CHECK_EXTENT 200
+
+/* largest random bias, in units of AUCR_SCALE */
+#define AUCR_TEMPLATE_CHECK_BIAS 4
+
+
+/* ==============================================
+	TYPE DEFINITIONS
+   ============================================== */
+
+/* the strokes an alphabet was made of, so that they can be added again and queried */
+typedef struct _AUCR_Template_Check_Strokes
+{
+	int num_strokes;
+	int num_coordinates[AUCR_TEMPLATE_CHECK_CHARACTERS];
+	AUCR_Coordinate coordinates[AUCR_TEMPLATE_CHECK_CHARACTERS][AUCR_TEMPLATE_CHECK_COORDINATES];
+} AUCR_Template_Check_Strokes;
+	
+/* ==============================================
+	STATIC FUNCTION DEFINITIONS
+   ============================================== */
+	
+/*
+ *	Name:
+ *		AUCR_Template_Check_Random()
+ *	Description:
+ *		steps a linear congruential generator, so that every run checks the same
+ *		strokes on every host
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		i_range -> number of values to pick from
+ *	Preconditions:
+ *		i_range is positive
+ *	Postconditions:
+ *		the state has stepped
+ *	Returns:
+ *		a value from 0 up to but not including i_range
+ */
+static int AUCR_Template_Check_Random( unsigned long * io_state_ptr, int i_range )
+{
+	( *io_state_ptr ) = ( ( ( *io_state_ptr ) * 1103515245UL ) + 12345UL ) & 0xFFFFFFFFUL;
+	
+	return( (int)( ( ( *io_state_ptr ) >> 8 ) % (unsigned long)i_range ) );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Template_Check_Stroke()
+ *	Description:
+ *		makes a stroke of random raw coordinates
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		o_coordinates <- array of AUCR_TEMPLATE_CHECK_COORDINATES coordinates to fill in
+ *	Preconditions:
+ *		all pointers are valid
+ *	Postconditions:
+ *		the stroke's coordinates are filled in
+ *	Returns:
+ *		the number of coordinates in the stroke
+ */
+static int AUCR_Template_Check_Stroke( unsigned long * io_state_ptr, AUCR_Coordinate * o_coordinates )
+{
+	//local variables
+	int i, num_coordinates;
+	
+	num_coordinates = 2 + AUCR_Template_Check_Random( io_state_ptr, AUCR_TEMPLATE_CHECK_COORDINATES - 1 );
+	for( i = 0; i < num_coordinates; i++ )
+	{
+		o_coordinates[i].x = AUCR_Template_Check_Random( io_state_ptr, AUCR_TEMPLATE_CHECK_EXTENT );
+		o_coordinates[i].y = AUCR_Template_Check_Random( io_state_ptr, AUCR_TEMPLATE_CHECK_EXTENT );
+	}
+	
+	return( num_coordinates );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Template_Check_Alphabet()
+ *	Description:
+ *		makes an alphabet in the geometry of AUCR_FIXED_DIRECTIONAL_CODES,
+ *		AUCR_FIXED_ACTIVITY_REGIONS and AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES, of
+ *		random strokes spread over the lower case letters and random biases.
+ *		about one stroke in four is a stroke added before, under another letter.
+ *	Parameters:
+ *		io_state_ptr <-> state of the generator
+ *		i_num_characters -> number of characters to add
+ *		o_strokes_ptr <- address of the strokes to fill in with the new strokes
+ *		o_alphabet_ptr_ptr <- address of the AUCR_Alphabet_Ptr to be populated
+ *	Preconditions:
+ *		the AUCR_Alphabet_Ptr at o_alphabet_ptr_ptr is NULL, i_num_characters is
+ *		between one and AUCR_TEMPLATE_CHECK_CHARACTERS
+ *	Postconditions:
+ *		o_alphabet_ptr_ptr points to the new alphabet
+ *	Returns:
+ *		AUCR_ERR_SUCCESS, or the error that stopped the alphabet being made
+ */
+static AUCR_Error AUCR_Template_Check_Alphabet(
+											   unsigned long * io_state_ptr,
+											   int i_num_characters,
+											   AUCR_Template_Check_Strokes * o_strokes_ptr,
+											   AUCR_Alphabet_Ptr * o_alphabet_ptr_ptr )
+{
+	//local variables
+	static const int x[AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES] =
+	{ 490, 490, 415, 278, 98, -98, -278, -415, -490, -490, -415, -278, -98, 98, 278, 415 };
+	static const int y[AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES] =
+	{ -98, 98, 278, 415, 490, 490, 415, 278, 98, -98, -278, -415, -490, -490, -415, -278 };
+	static const int start[AUCR_FIXED_ACTIVITY_REGIONS] = { 0, 0, 32, 0, 16, 32, 48 };
+	static const int stop[AUCR_FIXED_ACTIVITY_REGIONS] = { 63, 31, 63, 15, 31, 47, 63 };
+	AUCR_Directional_Code_Map_Ptr tempmap = NULL;
+	AUCR_Error temperror;
+	int i, stroke;
+	
+	temperror = AUCR_DIRECTIONAL_CODE_MAP_Init( AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES, &tempmap );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	for( i = 0; i < AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES; i++ )
+	{
+		tempmap->x[i] = x[i];
+		tempmap->y[i] = y[i];
+	}
+	temperror = AUCR_ALPHABET_Init( tempmap, AUCR_FIXED_ACTIVITY_REGIONS,
+								   AUCR_FIXED_DIRECTIONAL_CODES, o_alphabet_ptr_ptr );
+	AUCR_DIRECTIONAL_CODE_MAP_Release( &tempmap );
+	if( temperror != AUCR_ERR_SUCCESS )
+	{
+		return( temperror );
+	}
+	for( i = 0; i < AUCR_FIXED_ACTIVITY_REGIONS; i++ )
+	{
+		( *o_alphabet_ptr_ptr )->activity_regions[i].start = start[i];
+		( *o_alphabet_ptr_ptr )->activity_regions[i].stop = stop[i];
+		( *o_alphabet_ptr_ptr )->bias[i] =
+		AUCR_Template_Check_Random( io_state_ptr, AUCR_TEMPLATE_CHECK_BIAS * AUCR_SCALE + 1 );
+	}
+	
+	o_strokes_ptr->num_strokes = 0;
+	for( i = 0; i < i_num_characters; i++ )
+	{
+		//add a stroke added before, or a new one
+		if( i > 0 && AUCR_Template_Check_Random( io_state_ptr, 4 ) == 0 )
+		{
+			stroke = AUCR_Template_Check_Random( io_state_ptr, o_strokes_ptr->num_strokes );
+		}
+		else
+		{
+			stroke = o_strokes_ptr->num_strokes;
+			o_strokes_ptr->num_coordinates[stroke] =
+			AUCR_Template_Check_Stroke( io_state_ptr, o_strokes_ptr->coordinates[stroke] );
+			o_strokes_ptr->num_strokes++;
+		}
+		temperror = AUCR_ALPHABET_Add_Raw( (wchar_t)( 'a' + AUCR_Template_Check_Random( io_state_ptr, 26 ) ),
+										  o_strokes_ptr->num_coordinates[stroke],
+										  o_strokes_ptr->coordinates[stroke], ( *o_alphabet_ptr_ptr ) );
+		if( temperror != AUCR_ERR_SUCCESS )
+		{
+			return( temperror );
+		}
+	}
+	
+	return( AUCR_ERR_SUCCESS );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Template_Check_Query()
+ *	Description:
+ *		checks one query of a compiled alphabet: that AUCR_Fixed_Scan() finds the
+ *		candidate AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated()
+ *		finds first, and that AUCR_FIXED_Recognize_From_Interpolated() gives the
+ *		unicode AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated() gives
+ *	Parameters:
+ *		i_alphabet -> number of the alphabet, to report a mismatch with
+ *		i_query -> number of the query, to report a mismatch with
+ *		i_interpolated_character_ptr -> the query
+ *		i_compiled_alphabet_ptr -> compiled alphabet to recognize the query in
+ *		io_workspace_ptr <-> workspace sized for the compiled alphabet
+ *	Preconditions:
+ *		all pointers are valid, the compiled alphabet has the geometry of
+ *		AUCR_Fixed_Scan< 64, 7, 16 >
+ *	Postconditions:
+ *		a mismatch has been reported
+ *	Returns:
+ *		zero if the recognizers agree, one otherwise
+ */
+static int AUCR_Template_Check_Query(
+									 int i_alphabet,
+									 int i_query,
+									 const AUCR_Interpolated_Character * i_interpolated_character_ptr,
+									 const AUCR_Compiled_Alphabet * i_compiled_alphabet_ptr,
+									 AUCR_Workspace_Ptr io_workspace_ptr )
+{
+	//local variables
+	AUCR_Candidate expected, scanned;
+	wchar_t unicode, fixedunicode;
+	int num_candidates;
+	
+	if( AUCR_COMPILED_ALPHABET_Recognize_Candidates_From_Interpolated( i_interpolated_character_ptr,
+																	  i_compiled_alphabet_ptr, 1,
+																	  &expected, &num_candidates,
+																	  io_workspace_ptr ) != AUCR_ERR_SUCCESS ||
+	   num_candidates != 1 ||
+	   AUCR_COMPILED_ALPHABET_Query_From_Interpolated( i_interpolated_character_ptr,
+													  i_compiled_alphabet_ptr,
+													  io_workspace_ptr ) != AUCR_ERR_SUCCESS )
+	{
+		printf( "  alphabet %d, query %d: could not recognize\n", i_alphabet, i_query );
+		return( 1 );
+	}
+	
+	AUCR_Fixed_Scan< AUCR_FIXED_DIRECTIONAL_CODES, AUCR_FIXED_ACTIVITY_REGIONS,
+	AUCR_FIXED_MAPPABLE_DIRECTIONAL_CODES >( i_compiled_alphabet_ptr, io_workspace_ptr->row,
+											io_workspace_ptr->character.activity_measures,
+											&scanned );
+	if( scanned.index != expected.index || scanned.difference != expected.difference ||
+	   scanned.unicode != expected.unicode )
+	{
+		printf( "  alphabet %d, query %d: scan found index %d difference %lu, not index %d difference %lu\n",
+			   i_alphabet, i_query, scanned.index, scanned.difference, expected.index, expected.difference );
+		return( 1 );
+	}
+	
+	AUCR_COMPILED_ALPHABET_Recognize_From_Interpolated( i_interpolated_character_ptr, i_compiled_alphabet_ptr,
+													   &unicode, io_workspace_ptr );
+	AUCR_FIXED_Recognize_From_Interpolated( i_interpolated_character_ptr, i_compiled_alphabet_ptr,
+										   &fixedunicode, io_workspace_ptr );
+	if( fixedunicode != unicode )
+	{
+		printf( "  alphabet %d, query %d: fixed recognizer gave unicode %d, not %d\n",
+			   i_alphabet, i_query, (int)fixedunicode, (int)unicode );
+		return( 1 );
+	}
+	
+	return( 0 );
+}
+
+
+/*
+ *	Name:
+ *		AUCR_Template_Check_Scan()
+ *	Description:
+ *		checks every query of every random alphabet, half of the queries new
+ *		random strokes and half strokes the alphabet was made of
+ *	Parameters:
+ *		none
+ *	Preconditions:
+ *		none
+ *	Postconditions:
+ *		every mismatch has been reported
+ *	Returns:
+ *		the number of queries that did not match
+ */
+static int AUCR_Template_Check_Scan( void )
+{
+	//local variables
+	static AUCR_Template_Check_Strokes strokes;
+	AUCR_Coordinate coordinates[AUCR_TEMPLATE_CHECK_COORDINATES];
+	AUCR_Alphabet_Ptr tempalphabet;
+	AUCR_Compiled_Alphabet_Ptr tempcompiled;
+	AUCR_Interpolated_Character_Ptr tempinterpchar;
+	AUCR_Workspace_Ptr tempworkspace;
+	unsigned long state = 1;
+	int a, q, stroke, num_characters, failures = 0;
+	
+	for( a = 0; a < AUCR_TEMPLATE_CHECK_ALPHABETS; a++ )
+	{
+		tempalphabet = NULL;
+		tempcompiled = NULL;
+		tempinterpchar = NULL;
+		tempworkspace = NULL;
+	
+		//the sizes run from one character, where the only row always wins, up to the most
+		num_characters = ( a == 0 ) ? 1 : ( 1 + AUCR_Template_Check_Random( &state, AUCR_TEMPLATE_CHECK_CHARACTERS ) );
+		if( AUCR_Template_Check_Alphabet( &state, num_characters, &strokes, &tempalphabet ) != AUCR_ERR_SUCCESS ||
+		   AUCR_ALPHABET_Compile( tempalphabet, &tempcompiled ) != AUCR_ERR_SUCCESS ||
+		   AUCR_INTERPOLATED_CHARACTER_Init( '?', AUCR_FIXED_DIRECTIONAL_CODES, &tempinterpchar ) != AUCR_ERR_SUCCESS ||
+		   AUCR_WORKSPACE_Init_From_Compiled( tempcompiled, &tempworkspace ) != AUCR_ERR_SUCCESS )
+		{
+			printf( "  alphabet %d: could not set up\n", a );
+			failures++;
+		}
+		else
+		{
+			for( q = 0; q < AUCR_TEMPLATE_CHECK_QUERIES; q++ )
+			{
+				if( ( q % 2 ) == 0 )
+				{
+					AUCR_INTERPOLATED_CHARACTER_From_Raw( AUCR_Template_Check_Stroke( &state, coordinates ),
+														 coordinates, tempinterpchar, NULL );
+				}
+				else
+				{
+					stroke = AUCR_Template_Check_Random( &state, strokes.num_strokes );
+					AUCR_INTERPOLATED_CHARACTER_From_Raw( strokes.num_coordinates[stroke],
+														 strokes.coordinates[stroke], tempinterpchar, NULL );
+				}
+				failures += AUCR_Template_Check_Query( a, q, tempinterpchar, tempcompiled, tempworkspace );
+			}
+		}
+	
+		if( tempworkspace != NULL )
+		{
+			AUCR_WORKSPACE_Release( &tempworkspace );
+		}
+		if( tempinterpchar != NULL )
+		{
+			AUCR_INTERPOLATED_CHARACTER_Release( &tempinterpchar );
+		}
+		AUCR_COMPILED_ALPHABET_Release( &tempcompiled );
+		if( tempalphabet != NULL )
+		{
+			AUCR_ALPHABET_Release( &tempalphabet );
+		}
+	}
+	
+	return( failures );
+}
+
+
+/* ==============================================
+	FUNCTION DEFINITIONS
+   ============================================== */
+
+int main( void )
+{
+	//local variables
+	int failures;
+	
+	failures = AUCR_Template_Check_Scan();
+	printf( "fixed scan against compiled scan: %s\n", ( failures == 0 ) ? "ok" : "FAILED" );
+	
+	return( ( failures == 0 ) ? 0 : 1 );
+}
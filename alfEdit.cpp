@@ -533,49 +533,17 @@ void alfEdit::setCurrent( int n )
 	
 void alfEdit::dispCurrent()
 {  
-	/*search through alphabet, looking for all instances of current character*/
-	int i, found = 0;
+	/*look up the first three instances of current character in its class*/
+	AUCR_Character_Ptr found[3];
+	int num = 0;
 	if( myAlf != NULL )
 	{
-		for( i = 0; i < myAlf->num_characters; i++ )
-		{
-			if( current == myAlf->characters_ptr_ptr[i]->unicode )
-			{
-				if( found == 2 )
-				{
-					entry3->dispLetter( myAlf->characters_ptr_ptr[i] );
-					found++;
-					break;
-				}
-				else if( found == 1 )
-				{
-					entry2->dispLetter( myAlf->characters_ptr_ptr[i] );
-					found++;
-				}
-				else if( found == 0 )
-				{
-					entry1->dispLetter( myAlf->characters_ptr_ptr[i] );
-					found++;
-				}
-			}
-		}
+		AUCR_ALPHABET_Get_Class( myAlf, current, 3, found, &num );
 	}
 	
-	if( found == 0 )
-	{
-		entry1->dispLetter( NULL );
-		entry2->dispLetter( NULL );
-		entry3->dispLetter( NULL );
-	}
-	else if( found == 1 )
-	{
-		entry2->dispLetter( NULL );
-		entry3->dispLetter( NULL );
-	}
-	else if( found == 2 )
-	{
-		entry3->dispLetter( NULL );
-	}
+	entry1->dispLetter( ( num > 0 ) ? found[0] : NULL );
+	entry2->dispLetter( ( num > 1 ) ? found[1] : NULL );
+	entry3->dispLetter( ( num > 2 ) ? found[2] : NULL );
 }
 
 void alfEdit::setShift( bool on )
@@ -116,6 +116,19 @@ aucrEdit::aucrEdit( QWidget* parent, const char* name, WFlags f ) : QMainWindow(
 	entry2 = AlfWidget->getEditArea2();
 	entry3 = AlfWidget->getEditArea3();
 	
+	//edits publish snapshots of the alphabet, which strokes are recognized against
+	myPublisher = NULL;
+	error = AUCR_PUBLISHER_Init( &myPublisher );
+	if( error != AUCR_ERR_SUCCESS )
+	{
+		aucrEdit::errorDialog( error );
+		qApp->closeAllWindows();
+	}
+	entry->setPublisher( myPublisher );
+	entry1->setPublisher( myPublisher );
+	entry2->setPublisher( myPublisher );
+	entry3->setPublisher( myPublisher );
+	
 	myAlf = NULL;
 	myAlfFile = NULL;
 	myTextFile = NULL;
@@ -236,6 +249,7 @@ aucrEdit::~aucrEdit()
 		delete whichAlfFile;
 	}
 	
+	AUCR_PUBLISHER_Release( &myPublisher );
 	AUCR_ALPHABET_Release( &myAlf );
 }
 
@@ -311,6 +325,16 @@ void aucrEdit::setDocument( const QString& applnk_filename )
 
 void aucrEdit::alfChanged( AUCR_Alphabet_Ptr thisAlf )
 {
+	if( thisAlf != NULL )
+	{
+		error = AUCR_PUBLISHER_Publish( thisAlf, myPublisher );
+		if( error != AUCR_ERR_SUCCESS )
+		{
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();
+		}
+	}
+	
 	entry1->setAlphabet( thisAlf );
 	entry2->setAlphabet( thisAlf );
 	entry3->setAlphabet( thisAlf );
@@ -150,6 +150,7 @@ private:
 	DocLnk* myAlfFile;
 	DocLnk* myTextFile;
 	AUCR_Alphabet_Ptr myAlf;
+	AUCR_Publisher_Ptr myPublisher;
 	AUCR_Error error;
 	QString* myTextString;
 	
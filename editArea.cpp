@@ -5,6 +5,7 @@
 editArea::editArea( QWidget *parent, const char *name ) : QWidget( parent, name )
 {
 	myCharacter = NULL;
+	myPublisher = NULL;
 	myStart = false;
 	dirty = false;
 	charChanged = false;
@@ -16,11 +17,12 @@ editArea::editArea( QWidget *parent, const char *name ) : QWidget( parent, name
 		aucrEdit::errorDialog( error );
 		qApp->closeAllWindows();
 	}
-	numCords = 1000;
-	myCords = (AUCR_Coordinate_Ptr)malloc( numCords * sizeof( AUCR_Coordinate ) );
-	if( myCords == NULL )
+	//the stroke keeps every coordinate, so that the characters added
+	//are those of the raw coordinates
+	myStroke = NULL;
+	error = AUCR_STROKE_Init( &myStroke );
+	if( error != AUCR_ERR_SUCCESS )
 	{
-		error = AUCR_ERR_NO_MEMORY;
 		aucrEdit::errorDialog( error );
 		qApp->closeAllWindows();
 	}
@@ -30,7 +32,7 @@ editArea::editArea( QWidget *parent, const char *name ) : QWidget( parent, name
 
 editArea::~editArea()
 {
-	free( myCords );
+	AUCR_STROKE_Release( &myStroke );
 	AUCR_INTERPOLATED_CHARACTER_Release( &myInterpolated );
 }
 
@@ -100,10 +102,13 @@ void editArea::mousePressEvent( QMouseEvent* e )
 	{
 		mousePressed = TRUE;
 		clear();
-		n = 0;
-		myCords[n].x=(e->pos()).x();
-		myCords[n].y=(this->height() - (e->pos()).y() );
-		n++;
+		AUCR_STROKE_Clear( myStroke );
+		error = AUCR_STROKE_Add_Coordinate( (e->pos()).x(), (this->height() - (e->pos()).y() ), myStroke );
+		if( error != AUCR_ERR_SUCCESS )
+		{
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();
+		}
 		QPainter painter( this );
 		painter.setPen( QPen( Qt::black, 1, SolidLine ) );
 		painter.setBrush( Qt::darkGray );
@@ -117,19 +122,24 @@ void editArea::mouseReleaseEvent( QMouseEvent* e )
 	if( mousePressed && myStart )
 	{
 		mousePressed = FALSE;
-		myCords[n].x=(e->pos()).x();
-		myCords[n].y=(this->height() - (e->pos()).y() );
 	
 		QPainter painter( this );
 		painter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );
-		painter.drawLine( myCords[n-1].x, this->height() - myCords[n-1].y, (e->pos()).x(), (e->pos()).y() );
+		painter.drawLine( myStroke->coordinates[myStroke->num_coordinates - 1].x,
+			this->height() - myStroke->coordinates[myStroke->num_coordinates - 1].y, (e->pos()).x(), (e->pos()).y() );
 		painter.end();
 	
-		n++;
+		error = AUCR_STROKE_Add_Coordinate( (e->pos()).x(), (this->height() - (e->pos()).y() ), myStroke );
+		if( error != AUCR_ERR_SUCCESS )
+		{
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();
+			return;
+		}
 
 		if( myCharacter == NULL )
 		{
-			error = AUCR_ALPHABET_Add_Raw( myCurrent, n, myCords, myAlf);
+			error = AUCR_ALPHABET_Add_Raw( myCurrent, myStroke->num_coordinates, myStroke->coordinates, myAlf);
 			if( error != AUCR_ERR_SUCCESS )
 			{
 				aucrEdit::errorDialog( error );
@@ -143,8 +153,7 @@ void editArea::mouseReleaseEvent( QMouseEvent* e )
 		}
 		else
 		{
-			error = AUCR_INTERPOLATED_CHARACTER_From_Raw(
-				n, myCords, myInterpolated );
+			error = AUCR_INTERPOLATED_CHARACTER_From_Stroke( myStroke, myInterpolated );
 			if( error != AUCR_ERR_SUCCESS )
 			{
 				aucrEdit::errorDialog( error );
@@ -155,7 +164,7 @@ void editArea::mouseReleaseEvent( QMouseEvent* e )
 			charChanged = true;
 			
 			error = AUCR_CHARACTER_From_Interpolated(
-				myInterpolated, myAlf, myCharacter );
+				myInterpolated, myAlf, myCharacter, NULL );
 			if( error != AUCR_ERR_SUCCESS )
 			{
 				aucrEdit::errorDialog( error );
@@ -163,6 +172,17 @@ void editArea::mouseReleaseEvent( QMouseEvent* e )
 			}
 		}
 
+		//strokes begun from now on are recognized with the change
+		if( myPublisher != NULL )
+		{
+			error = AUCR_PUBLISHER_Publish( myAlf, myPublisher );
+			if( error != AUCR_ERR_SUCCESS )
+			{
+				aucrEdit::errorDialog( error );
+				qApp->closeAllWindows();
+			}
+		}
+
 		//timer calls dispLetter when it times out [.5 second]
 		timer->start( 500, TRUE );
 	}
@@ -172,27 +192,17 @@ void editArea::mouseMoveEvent( QMouseEvent* e )
 {
 	if ( mousePressed && myStart )
 	{
-		myCords[n].x=(e->pos()).x();
-		myCords[n].y=(this->height() - (e->pos()).y() );
 		QPainter painter( this );
 		painter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );
-		painter.drawLine( myCords[n - 1].x, this->height() - myCords[n - 1].y, (e->pos()).x(), (e->pos()).y() );
+		painter.drawLine( myStroke->coordinates[myStroke->num_coordinates - 1].x,
+			this->height() - myStroke->coordinates[myStroke->num_coordinates - 1].y, (e->pos()).x(), (e->pos()).y() );
 		painter.end();
-		n++;
-		if( numCords <= n + 2 )
+		error = AUCR_STROKE_Add_Coordinate( (e->pos()).x(), (this->height() - (e->pos()).y() ), myStroke );
+		if( error != AUCR_ERR_SUCCESS )
 		{
-			numCords *= 2;
-
-			myCords = (AUCR_Coordinate_Ptr)realloc( myCords, numCords * sizeof( AUCR_Coordinate ) );
-
-			if( myCords == NULL )
-			{
-				error = AUCR_ERR_NO_MEMORY;
-				aucrEdit::errorDialog( error );
-				qApp->closeAllWindows();			
-			}
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();			
 		}
-
 	}
 }
 
@@ -228,6 +238,11 @@ void editArea::setAlphabet( AUCR_Alphabet_Ptr newalf )
 	}
 }
 
+void editArea::setPublisher( AUCR_Publisher_Ptr newpublisher )
+{
+	myPublisher = newpublisher;
+}
+
 bool editArea::isDirty()
 {
 	return dirty;
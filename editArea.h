@@ -26,6 +26,7 @@ public slots:
 	void setCurrent( wchar_t );
 	void setStart( bool );
 	void setAlphabet( AUCR_Alphabet_Ptr );
+	void setPublisher( AUCR_Publisher_Ptr );
 	
 signals:        
 
@@ -48,10 +49,9 @@ private:
 	wchar_t myCurrent;
 	bool myStart;
 	AUCR_Alphabet_Ptr myAlf;
-	AUCR_Coordinate_Ptr myCords;
+	AUCR_Publisher_Ptr myPublisher;
+	AUCR_Stroke_Ptr myStroke;
 	AUCR_Error error;
-	int numCords;
-	int n;
 	QTimer * timer;
 };
 
@@ -8,14 +8,19 @@ recogArea::recogArea( QWidget *parent, const char *name ) : QWidget( parent, nam
 	clear = true;
 	begin = true;
 	graffiti = false;
-	numCords = 1000;
 	xMax = 0;
 	xMin = 0;
 	myPixmap = NULL;
-	myCords = (AUCR_Coordinate_Ptr)malloc( numCords * sizeof( AUCR_Coordinate ) );
-	if( myCords == NULL )
+	myProgressive = NULL;
+	myPublisher = NULL;
+	mySnapshot = NULL;
+	myStroke = NULL;
+	
+	//the stroke keeps its arc length as it is drawn.  it keeps every
+	//coordinate, so that it is recognized as the raw coordinates would be
+	error = AUCR_STROKE_Init( &myStroke );
+	if( error != AUCR_ERR_SUCCESS )
 	{
-		error = AUCR_ERR_NO_MEMORY;
 		aucrEdit::errorDialog( error );
 		qApp->closeAllWindows();
 	}
@@ -26,13 +31,28 @@ recogArea::recogArea( QWidget *parent, const char *name ) : QWidget( parent, nam
 
 recogArea::~recogArea()
 {
-	free( myCords );
+	AUCR_STROKE_Release( &myStroke );
+	AUCR_PROGRESSIVE_Release( &myProgressive );
+	AUCR_SNAPSHOT_Unpin( &mySnapshot );
 	delete myPixmap;
 }
 
 void recogArea::setAlphabet( AUCR_Alphabet_Ptr newalf )
 {
 	myAlf = newalf;
+	
+	//strokes are recognized while they are drawn, against the new alphabet
+	AUCR_PROGRESSIVE_Release( &myProgressive );
+	if( myAlf != NULL )
+	{
+		error = AUCR_PROGRESSIVE_Init( myAlf, AUCR_PROGRESSIVE_INTERVAL, &myProgressive );
+		if( error != AUCR_ERR_SUCCESS )
+		{
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();
+		}
+	}
+	
 	if( !begin )
 	{
 		clear = true;
@@ -50,6 +70,11 @@ void recogArea::setText()
 	}
 }
 
+void recogArea::setPublisher( AUCR_Publisher_Ptr newpublisher )
+{
+	myPublisher = newpublisher;
+}
+
 void recogArea::setStart( bool newstart )
 {
 	if( ( myAlf != NULL ) && newstart )
@@ -113,10 +138,29 @@ void recogArea::mousePressEvent( QMouseEvent* e )
 		}
 		xMax = (e->pos()).x();
 		xMin = (e->pos()).x();
-		n = 0;
-		myCords[n].x=(e->pos()).x();
-		myCords[n].y=(this->height() - (e->pos()).y() );
-		n++;
+		AUCR_STROKE_Clear( myStroke );
+		//the stroke is recognized against the alphabet as last published, which
+		//stays as it is until the stroke is finished however it is edited meanwhile
+		AUCR_SNAPSHOT_Unpin( &mySnapshot );
+		if( myPublisher != NULL )
+		{
+			AUCR_PUBLISHER_Pin( myPublisher, &mySnapshot );
+		}
+		if( mySnapshot != NULL )
+		{
+			myProgressive->alphabet_ptr = mySnapshot->alphabet_ptr;
+		}
+		else
+		{
+			myProgressive->alphabet_ptr = myAlf;
+		}
+		AUCR_PROGRESSIVE_Begin( myProgressive );
+		error = AUCR_STROKE_Add_Coordinate( (e->pos()).x(), (this->height() - (e->pos()).y() ), myStroke );
+		if( error != AUCR_ERR_SUCCESS )
+		{
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();
+		}
 		QPainter wPainter, bPainter;
 		wPainter.begin( this );
 		bPainter.begin( myPixmap );
@@ -132,6 +176,8 @@ void recogArea::mousePressEvent( QMouseEvent* e )
 void recogArea::mouseReleaseEvent( QMouseEvent* e )
 {
 	int i;
+	AUCR_Coordinate_Ptr cords;
+	AUCR_Coordinate last;
 	
 	if( mousePressed && myStart )
 	{
@@ -146,8 +192,18 @@ void recogArea::mouseReleaseEvent( QMouseEvent* e )
 			xMin = (e->pos()).x();
 		}
 		
-		myCords[n].x=(e->pos()).x();
-		myCords[n].y=(this->height() - (e->pos()).y() );
+		//the last line is drawn from the coordinate before this one, kept
+		//here since the stroke may put this one in its place
+		last = myStroke->coordinates[myStroke->num_coordinates - 1];
+		error = AUCR_STROKE_Add_Coordinate( (e->pos()).x(), (this->height() - (e->pos()).y() ), myStroke );
+		if( error != AUCR_ERR_SUCCESS )
+		{
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();
+			return;
+		}
+		cords = myStroke->coordinates;
+		
 		if( (e->pos()).x() < xOld )
 		{
 			clear = true;
@@ -157,10 +213,10 @@ void recogArea::mouseReleaseEvent( QMouseEvent* e )
 			bPainter.begin( myPixmap );
 			wPainter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );
 			bPainter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );
-			for( i = 1; i <= n; i++ )
+			for( i = 1; i < myStroke->num_coordinates; i++ )
 			{
-				wPainter.drawLine( myCords[i-1].x, this->height() - myCords[i-1].y, myCords[i].x, this->height() - myCords[i].y );
-				bPainter.drawLine( myCords[i-1].x, this->height() - myCords[i-1].y, myCords[i].x, this->height() - myCords[i].y );
+				wPainter.drawLine( cords[i-1].x, this->height() - cords[i-1].y, cords[i].x, this->height() - cords[i].y );
+				bPainter.drawLine( cords[i-1].x, this->height() - cords[i-1].y, cords[i].x, this->height() - cords[i].y );
 			}
 			wPainter.end();		
 			bPainter.end();
@@ -172,17 +228,18 @@ void recogArea::mouseReleaseEvent( QMouseEvent* e )
 			bPainter.begin( myPixmap );
 			wPainter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );
 			bPainter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );	
-			wPainter.drawLine( myCords[n-1].x, this->height() - myCords[n-1].y, (e->pos()).x(), (e->pos()).y() );
-			bPainter.drawLine( myCords[n-1].x, this->height() - myCords[n-1].y, (e->pos()).x(), (e->pos()).y() );
+			wPainter.drawLine( last.x, this->height() - last.y, (e->pos()).x(), (e->pos()).y() );
+			bPainter.drawLine( last.x, this->height() - last.y, (e->pos()).x(), (e->pos()).y() );
 			wPainter.end();		
 			bPainter.end();
 		}
 		
 		xOld = ( xMax - ( ( xMax - xMin ) / 4 ) );
-	
-		n++;
 
-		error = AUCR_ALPHABET_Recognize_From_Raw( n,	myCords,	myAlf, &uni );
+		//the shortlist kept while drawing bounds the final recognition
+		error = AUCR_PROGRESSIVE_Finalize( myStroke, myProgressive, &uni );
+		myProgressive->alphabet_ptr = myAlf;
+		AUCR_SNAPSHOT_Unpin( &mySnapshot );
 
 		if( error != AUCR_ERR_SUCCESS )
 		{
@@ -198,6 +255,8 @@ void recogArea::mouseReleaseEvent( QMouseEvent* e )
 
 void recogArea::mouseMoveEvent( QMouseEvent* e )
 {
+	AUCR_Coordinate_Ptr last;
+	
 	if ( mousePressed && myStart )
 	{
 		if( (e->pos()).x() > xMax )
@@ -209,32 +268,30 @@ void recogArea::mouseMoveEvent( QMouseEvent* e )
 			xMin = (e->pos()).x();
 		}
 		
-		myCords[n].x=(e->pos()).x();
-		myCords[n].y=(this->height() - (e->pos()).y() );
+		last = &( myStroke->coordinates[myStroke->num_coordinates - 1] );
 		QPainter wPainter, bPainter;
 		wPainter.begin( this );
 		bPainter.begin( myPixmap );
 		wPainter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );
 		bPainter.setPen( QPen( Qt::darkGray, 1, SolidLine ) );
-		wPainter.drawLine( myCords[n - 1].x, this->height() - myCords[n - 1].y, (e->pos()).x(), (e->pos()).y() );
-		bPainter.drawLine( myCords[n - 1].x, this->height() - myCords[n - 1].y, (e->pos()).x(), (e->pos()).y() );
+		wPainter.drawLine( last->x, this->height() - last->y, (e->pos()).x(), (e->pos()).y() );
+		bPainter.drawLine( last->x, this->height() - last->y, (e->pos()).x(), (e->pos()).y() );
 		wPainter.end();		
 		bPainter.end();
-		n++;
-		if( numCords <= n + 2 )
+		
+		//the arc length grows with each coordinate, so lifting the pen
+		//leaves only the resampling to do, and the stroke so far is
+		//recognized every AUCR_PROGRESSIVE_INTERVAL coordinates
+		error = AUCR_STROKE_Add_Coordinate( (e->pos()).x(), (this->height() - (e->pos()).y() ), myStroke );
+		if( error == AUCR_ERR_SUCCESS )
 		{
-			numCords *= 2;
-
-			myCords = (AUCR_Coordinate_Ptr)realloc( myCords, numCords * sizeof( AUCR_Coordinate ) );
-
-			if( myCords == NULL )
-			{
-				error = AUCR_ERR_NO_MEMORY;
-				aucrEdit::errorDialog( error );
-				qApp->closeAllWindows();			
-			}
+			error = AUCR_PROGRESSIVE_Update( myStroke, myProgressive );
+		}
+		if( error != AUCR_ERR_SUCCESS )
+		{
+			aucrEdit::errorDialog( error );
+			qApp->closeAllWindows();			
 		}
-
 	}
 }
 
@@ -20,6 +20,7 @@ class recogArea : public QWidget
 
 public slots:
 	void setAlphabet( AUCR_Alphabet_Ptr newalf );
+	void setPublisher( AUCR_Publisher_Ptr newpublisher );
 	void setStart( bool newstart );
 	void setText();
 	void setClear( bool );
@@ -46,10 +47,11 @@ private:
 		bool graffiti;
 		AUCR_Error error;
 		AUCR_Alphabet_Ptr myAlf;
-      AUCR_Coordinate_Ptr myCords;
+		AUCR_Progressive_Ptr myProgressive;
+		AUCR_Publisher_Ptr myPublisher;
+		AUCR_Snapshot_Ptr mySnapshot;
+		AUCR_Stroke_Ptr myStroke;
 		QPixmap* myPixmap;
-      int numCords;
-		int n;
 		int xMax;
 		int xMin;
 		int xOld;